@@ -0,0 +1,95 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../include/s21_matrix.h"
+
+#define DENSE_ORDER 2000
+#define BAND_ORDER 1000000
+#define REPEATS 5
+
+static double _now(void) {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Spline-style tridiagonal system: 4 on the diagonal, 1 beside it. */
+static int _spline(int n, s21_band_t *A, matrix_t *b) {
+  int rc = s21_band_create(n, 1, 1, A);
+  if (!rc) {
+    rc = s21_create_matrix(n, 1, b);
+    if (rc) {
+      s21_band_free(A);
+    }
+  }
+  for (int i = 0; !rc && i < n; i++) {
+    s21_band_set(A, i, i, 4.0);
+    if (i > 0) s21_band_set(A, i, i - 1, 1.0);
+    if (i < n - 1) s21_band_set(A, i, i + 1, 1.0);
+    b->matrix[i][0] = 1.0 / (1.0 + i % 7);
+  }
+  return rc;
+}
+
+int main(void) {
+  printf("isa level %d, %d thread(s)\n", s21_get_isa(),
+         s21_get_num_threads());
+
+  s21_band_t A = {0, 0, 0, NULL};
+  matrix_t b, D, x;
+  int rc = _spline(DENSE_ORDER, &A, &b);
+  if (!rc) {
+    rc = s21_band_to_dense(&A, &D);
+  }
+  if (!rc) {
+    double t0 = _now();
+    rc = s21_solve(&D, &b, &x);
+    double dense = _now() - t0;
+    if (!rc) {
+      s21_remove_matrix(&x);
+      t0 = _now();
+      rc = s21_tridiagonal_solve(&A, &b, &x);
+      double thomas = _now() - t0;
+      printf("n = %d: dense solve %.1f ms, tridiagonal %.3f ms\n",
+             DENSE_ORDER, dense * 1e3, thomas * 1e3);
+    }
+    if (!rc) {
+      s21_remove_matrix(&x);
+    }
+    s21_remove_matrix(&D);
+  }
+  if (A.data != NULL) {
+    s21_band_free(&A);
+    s21_remove_matrix(&b);
+  }
+
+  rc = rc ? rc : _spline(BAND_ORDER, &A, &b);
+  if (!rc) {
+    double t0 = _now();
+    for (int r = 0; !rc && r < REPEATS; r++) {
+      rc = s21_tridiagonal_solve(&A, &b, &x);
+      if (!rc) {
+        s21_remove_matrix(&x);
+      }
+    }
+    double thomas = (_now() - t0) / REPEATS;
+    t0 = _now();
+    for (int r = 0; !rc && r < REPEATS; r++) {
+      rc = s21_band_solve(&A, &b, &x);
+      if (!rc) {
+        s21_remove_matrix(&x);
+      }
+    }
+    double band = (_now() - t0) / REPEATS;
+    printf("n = %d: tridiagonal %.1f ms, band LU %.1f ms\n", BAND_ORDER,
+           thomas * 1e3, band * 1e3);
+    s21_band_free(&A);
+    s21_remove_matrix(&b);
+  }
+
+  if (rc) {
+    fprintf(stderr, "band benchmark failed: %d\n", rc);
+  }
+  return rc ? EXIT_FAILURE : EXIT_SUCCESS;
+}
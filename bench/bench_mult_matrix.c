@@ -0,0 +1,86 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../include/s21_matrix.h"
+
+#define MIN_SIZE 256
+#define MAX_SIZE 4096
+#define NAIVE_MAX_SIZE 1024
+
+static double _now(void) {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void _fill(matrix_t *M, int seed) {
+  for (int i = 0; i < M->rows; i++) {
+    for (int j = 0; j < M->columns; j++) {
+      M->matrix[i][j] = (double)((i * 31 + j * 17 + seed) % 97) / 97.0 - 0.5;
+    }
+  }
+}
+
+/* The textbook i-j-k product the library used before blocking. */
+static void _mult_naive(const matrix_t *A, const matrix_t *B, matrix_t *C) {
+  for (int i = 0; i < A->rows; i++) {
+    for (int j = 0; j < B->columns; j++) {
+      for (int k = 0; k < A->columns; k++) {
+        C->matrix[i][j] += A->matrix[i][k] * B->matrix[k][j];
+      }
+    }
+  }
+}
+
+static double _gflops(int n, double seconds) {
+  return 2.0 * n * n * (double)n / seconds * 1e-9;
+}
+
+int main(int argc, char **argv) {
+  int max_size = argc > 1 ? atoi(argv[1]) : MAX_SIZE;
+  int naive_max = argc > 2 ? atoi(argv[2]) : NAIVE_MAX_SIZE;
+
+  printf("isa level %d, %d thread(s)\n", s21_get_isa(),
+         s21_get_num_threads());
+  printf("%6s %14s %14s %8s\n", "n", "naive GFLOP/s", "s21 GFLOP/s",
+         "speedup");
+
+  for (int n = MIN_SIZE; n <= max_size; n *= 2) {
+    matrix_t A, B, C;
+    if (s21_create_matrix(n, n, &A) || s21_create_matrix(n, n, &B)) {
+      fprintf(stderr, "allocation failed for n = %d\n", n);
+      return EXIT_FAILURE;
+    }
+    _fill(&A, 1);
+    _fill(&B, 2);
+
+    double t0 = _now();
+    int rc = s21_mult_matrix(&A, &B, &C);
+    double fast = _now() - t0;
+    if (rc != S21_OK) {
+      fprintf(stderr, "s21_mult_matrix failed for n = %d\n", n);
+      return EXIT_FAILURE;
+    }
+
+    if (n <= naive_max) {
+      matrix_t R;
+      s21_create_matrix(n, n, &R);
+      t0 = _now();
+      _mult_naive(&A, &B, &R);
+      double naive = _now() - t0;
+      printf("%6d %14.2f %14.2f %7.1fx%s\n", n, _gflops(n, naive),
+             _gflops(n, fast), naive / fast,
+             s21_eq_matrix(&R, &C) ? "" : "  MISMATCH");
+      s21_remove_matrix(&R);
+    } else {
+      printf("%6d %14s %14.2f %8s\n", n, "-", _gflops(n, fast), "-");
+    }
+
+    s21_remove_matrix(&C);
+    s21_remove_matrix(&B);
+    s21_remove_matrix(&A);
+  }
+
+  return EXIT_SUCCESS;
+}
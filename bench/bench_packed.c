@@ -0,0 +1,118 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../include/s21_matrix.h"
+
+#define ORDER 2000
+#define RHS 500
+
+static double _now(void) {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Covariance-like SPD matrix: decaying correlations, heavy diagonal. */
+static int _covariance(int n, matrix_t *A) {
+  int rc = s21_create_matrix(n, n, A);
+  for (int i = 0; !rc && i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      int d = abs(i - j);
+      A->matrix[i][j] = (i == j ? n : 0.0) + 1.0 / (1.0 + d * d);
+    }
+  }
+  return rc;
+}
+
+static int _rhs(int n, int k, matrix_t *B) {
+  int rc = s21_create_matrix(n, k, B);
+  for (int i = 0; !rc && i < n; i++) {
+    for (int j = 0; j < k; j++) {
+      B->matrix[i][j] = 1.0 / (1.0 + (i + 3 * j) % 17);
+    }
+  }
+  return rc;
+}
+
+static double _megabytes(int n, int packed) {
+  double count = packed ? (double)n * (n + 1) / 2 : (double)n * n;
+  return count * sizeof(double) / 1e6;
+}
+
+int main(void) {
+  printf("isa level %d, %d thread(s)\n", s21_get_isa(),
+         s21_get_num_threads());
+
+  matrix_t A, B, C;
+  s21_packed_t S, L;
+  s21_cholesky_t chol;
+  int rc = _covariance(ORDER, &A);
+  rc = rc ? rc : _rhs(ORDER, RHS, &B);
+  rc = rc ? rc
+          : s21_packed_from_dense(&A, S21_PACKED_SYMMETRIC, S21_PACKED_LOWER,
+                                  &S);
+  if (!rc) {
+    printf("%d x %d: dense %.0f MB, packed %.0f MB\n", ORDER, ORDER,
+           _megabytes(ORDER, 0), _megabytes(ORDER, 1));
+
+    double t0 = _now();
+    rc = s21_mult_matrix(&A, &B, &C);
+    double dense = _now() - t0;
+    if (!rc) {
+      s21_remove_matrix(&C);
+      t0 = _now();
+      rc = s21_packed_mult_dense(&S, S21_NO_TRANS, &B, &C);
+    }
+    double symm = _now() - t0;
+    if (!rc) {
+      s21_remove_matrix(&C);
+      printf("x %d columns: dense %.0f ms, SYMM %.0f ms\n", RHS, dense * 1e3,
+             symm * 1e3);
+    }
+    s21_packed_free(&S);
+  }
+
+  rc = rc ? rc : s21_cholesky_factor(&A, &chol);
+  if (!rc) {
+    rc = s21_packed_from_cholesky(&chol, &L);
+    double t0 = _now();
+    if (!rc) {
+      rc = s21_packed_mult_dense(&L, S21_NO_TRANS, &B, &C);
+    }
+    double trmm = _now() - t0;
+    if (!rc) {
+      s21_remove_matrix(&C);
+      t0 = _now();
+      rc = s21_packed_trsm(&L, S21_NO_TRANS, &B, &C);
+    }
+    double trsm = _now() - t0;
+    if (!rc) {
+      s21_remove_matrix(&C);
+      t0 = _now();
+      rc = s21_cholesky_solve(&chol, &B, &C);
+    }
+    double solve = _now() - t0;
+    if (!rc) {
+      s21_remove_matrix(&C);
+      printf("TRMM %.0f ms, TRSM %.0f ms, Cholesky solve %.0f ms\n",
+             trmm * 1e3, trsm * 1e3, solve * 1e3);
+      s21_packed_free(&L);
+    }
+    s21_cholesky_free(&chol);
+  }
+
+  if (!rc) {
+    double t0 = _now();
+    rc = s21_inverse_matrix(&A, &C);
+    if (!rc) {
+      printf("inverse: %.0f ms\n", (_now() - t0) * 1e3);
+      s21_remove_matrix(&C);
+    }
+  }
+
+  if (rc) {
+    fprintf(stderr, "packed benchmark failed: %d\n", rc);
+  }
+  return rc ? EXIT_FAILURE : EXIT_SUCCESS;
+}
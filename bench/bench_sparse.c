@@ -0,0 +1,104 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../include/s21_matrix.h"
+
+#define ORDER 1000000
+#define NNZ 10000000
+#define SPGEMM_ORDER 100000
+#define SPGEMM_NNZ 1000000
+#define REPEATS 5
+
+static double _now(void) {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Random pattern with a heavier diagonal, like an adjacency matrix plus
+   self loops. */
+static int _random_sparse(int n, int nnz, int format, s21_sparse_t *S) {
+  int *rows = (int *)malloc((size_t)nnz * sizeof(int));
+  int *cols = (int *)malloc((size_t)nnz * sizeof(int));
+  double *vals = (double *)malloc((size_t)nnz * sizeof(double));
+  int rc = rows && cols && vals ? S21_OK : S21_INCORRECT_MATRIX;
+  unsigned long long seed = 88172645463325252ull;
+  for (int t = 0; !rc && t < nnz; t++) {
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+    rows[t] = (int)(seed % (unsigned)n);
+    cols[t] = t % 10 == 0 ? rows[t] : (int)((seed >> 32) % (unsigned)n);
+    vals[t] = (double)(seed % 1000) / 1000.0;
+  }
+  if (!rc) {
+    rc = s21_sparse_from_triplets(n, n, nnz, rows, cols, vals, format, S);
+  }
+  free(vals);
+  free(cols);
+  free(rows);
+  return rc;
+}
+
+static double _megabytes(const s21_sparse_t *S) {
+  int major = S->format == S21_SPARSE_CSR ? S->rows : S->columns;
+  return ((double)S->nnz * (sizeof(double) + sizeof(int)) +
+          (double)(major + 1) * sizeof(int)) /
+         1e6;
+}
+
+int main(void) {
+  printf("isa level %d, %d thread(s)\n", s21_get_isa(),
+         s21_get_num_threads());
+
+  s21_sparse_t A, C;
+  double t0 = _now();
+  if (_random_sparse(ORDER, NNZ, S21_SPARSE_CSR, &A)) {
+    fprintf(stderr, "allocation failed\n");
+    return EXIT_FAILURE;
+  }
+  printf("%d x %d, %d entries: %.0f MB, built in %.0f ms\n", A.rows,
+         A.columns, A.nnz, _megabytes(&A), (_now() - t0) * 1e3);
+
+  matrix_t x, y;
+  int rc = s21_create_matrix(ORDER, 1, &x);
+  for (int i = 0; !rc && i < ORDER; i++) {
+    x.matrix[i][0] = 1.0 / (1.0 + i % 7);
+  }
+  for (int format = S21_SPARSE_CSR; !rc && format <= S21_SPARSE_CSC;
+       format++) {
+    rc = s21_sparse_convert(&A, format, &C);
+    t0 = _now();
+    for (int r = 0; !rc && r < REPEATS; r++) {
+      rc = s21_sparse_mult_dense(&C, &x, &y);
+      if (!rc) {
+        s21_remove_matrix(&y);
+      }
+    }
+    double spmv = (_now() - t0) / REPEATS;
+    printf("SpMV %s: %.1f ms, %.2f GFLOP/s\n", format ? "CSC" : "CSR",
+           spmv * 1e3, 2.0 * A.nnz / spmv * 1e-9);
+    s21_sparse_free(&C);
+  }
+  s21_remove_matrix(&x);
+  s21_sparse_free(&A);
+
+  rc = rc ? rc : _random_sparse(SPGEMM_ORDER, SPGEMM_NNZ, S21_SPARSE_CSR, &A);
+  if (!rc) {
+    t0 = _now();
+    rc = s21_sparse_mult(&A, &A, &C);
+    double spgemm = _now() - t0;
+    if (!rc) {
+      printf("SpGEMM %d x %d, %d entries squared: %d entries in %.0f ms\n",
+             A.rows, A.columns, A.nnz, C.nnz, spgemm * 1e3);
+      s21_sparse_free(&C);
+    }
+    s21_sparse_free(&A);
+  }
+
+  if (rc) {
+    fprintf(stderr, "sparse benchmark failed: %d\n", rc);
+  }
+  return rc ? EXIT_FAILURE : EXIT_SUCCESS;
+}
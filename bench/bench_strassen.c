@@ -0,0 +1,117 @@
+#include <float.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../include/s21_matrix.h"
+
+#define MIN_SIZE 1024
+#define MAX_SIZE 4096
+#define SAMPLE_ROWS 32
+
+static double _now(void) {
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+static void _fill(matrix_t *M, int seed) {
+  for (int i = 0; i < M->rows; i++) {
+    for (int j = 0; j < M->columns; j++) {
+      M->matrix[i][j] = (double)((i * 31 + j * 17 + seed) % 97) / 97.0 - 0.5;
+    }
+  }
+}
+
+static double _max_abs(const matrix_t *M) {
+  double max = 0.0;
+  for (int i = 0; i < M->rows; i++) {
+    for (int j = 0; j < M->columns; j++) {
+      max = fmax(max, fabs(M->matrix[i][j]));
+    }
+  }
+  return max;
+}
+
+/* Largest deviation from an extended-precision product over sampled rows. */
+static double _max_error(const matrix_t *A, const matrix_t *B,
+                         const matrix_t *C) {
+  double max = 0.0;
+  int step = A->rows / SAMPLE_ROWS > 0 ? A->rows / SAMPLE_ROWS : 1;
+  for (int i = 0; i < A->rows; i += step) {
+    for (int j = 0; j < B->columns; j++) {
+      long double exact = 0.0L;
+      for (int k = 0; k < A->columns; k++) {
+        exact += (long double)A->matrix[i][k] * B->matrix[k][j];
+      }
+      max = fmax(max, fabs((double)(C->matrix[i][j] - exact)));
+    }
+  }
+  return max;
+}
+
+/* Max-norm error bounds in units of u * |A|max * |B|max (Higham, Accuracy
+   and Stability of Numerical Algorithms, 2nd ed., section 23.2). */
+static double _bound_classic(int n) { return (double)n * n; }
+
+/* The recursion halves while every dimension is at least twice the
+   cutover. */
+static double _bound_winograd(int n) {
+  int cutover = s21_get_strassen_cutover();
+  int n0 = n;
+  while (n0 >= 2 * cutover) {
+    n0 /= 2;
+  }
+  double levels = pow((double)n / n0, log2(18.0));
+  return levels * ((double)n0 * n0 + 6.0 * n0) - 6.0 * n;
+}
+
+int main(int argc, char **argv) {
+  int max_size = argc > 1 ? atoi(argv[1]) : MAX_SIZE;
+  if (argc > 2 && s21_set_strassen_cutover(atoi(argv[2])) != S21_OK) {
+    fprintf(stderr, "usage: %s [max_size [cutover]]\n", argv[0]);
+    return EXIT_FAILURE;
+  }
+
+  printf("isa level %d, %d thread(s), cutover %d; errors in units of "
+         "u*|A|*|B|\n",
+         s21_get_isa(), s21_get_num_threads(), s21_get_strassen_cutover());
+  printf("%6s %11s %11s %8s %10s %10s %10s %10s\n", "n", "classic ms",
+         "winograd ms", "speedup", "err cls", "bound cls", "err win",
+         "bound win");
+
+  for (int n = MIN_SIZE; n <= max_size; n *= 2) {
+    matrix_t A, B, C, W;
+    if (s21_create_matrix(n, n, &A) || s21_create_matrix(n, n, &B)) {
+      fprintf(stderr, "allocation failed for n = %d\n", n);
+      return EXIT_FAILURE;
+    }
+    _fill(&A, 1);
+    _fill(&B, 2);
+
+    double t0 = _now();
+    int rc = s21_mult_matrix(&A, &B, &C);
+    double classic = _now() - t0;
+    t0 = _now();
+    rc = rc ? rc : s21_mult_matrix_strassen(&A, &B, &W);
+    double winograd = _now() - t0;
+    if (rc != S21_OK) {
+      fprintf(stderr, "product failed for n = %d\n", n);
+      return EXIT_FAILURE;
+    }
+
+    double unit = DBL_EPSILON / 2 * _max_abs(&A) * _max_abs(&B);
+    printf("%6d %11.0f %11.0f %7.2fx %10.2f %10.3g %10.2f %10.3g\n", n,
+           classic * 1e3, winograd * 1e3, classic / winograd,
+           _max_error(&A, &B, &C) / unit, _bound_classic(n),
+           _max_error(&A, &B, &W) / unit, _bound_winograd(n));
+
+    s21_remove_matrix(&W);
+    s21_remove_matrix(&C);
+    s21_remove_matrix(&B);
+    s21_remove_matrix(&A);
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -3,19 +3,42 @@
 
 #include "../include/s21_matrix.h"
 
-/*
- * @brief Creates a minor matrix by crossing out a specified row and column.
+/**
+ * @brief Row alignment of `S21_ALLOC_ALIGNED` matrices, in bytes.
+ */
+#define S21_ALIGNMENT 64
+
+/**
+ * @brief Largest order handled by the closed-form small-matrix kernels.
+ */
+#define S21_SMALL_MAX 4
+
+/**
+ * @brief Element-wise kernel `c[i] = a[i] op b[i]` over `n` doubles.
+ */
+typedef void (*binary_kernel_t)(const double *a, const double *b, double *c,
+                                int n);
+
+/**
+ * @brief Element-wise kernel `c[i] = a[i] * number` over `n` doubles.
+ */
+typedef void (*scale_kernel_t)(const double *a, double number, double *c,
+                               int n);
+
+/**
+ * @brief Copies a minor (one row and one column crossed out) into a buffer.
  * @param A Pointer to the original matrix.
- * @param result Pointer to the resulting matrix (minor).
+ * @param dst Row-major buffer of at least `(rows - 1) * (columns - 1)`
+ * doubles.
  * @param skip_row Index of the row to exclude.
  * @param skip_col Index of the column to exclude.
  * @return None (void function).
- * @note Used for determinant and algebraic complements calculation.
+ * @note Used by the algebraic complements fallback for singular matrices.
  * @author s21: tyananai
- * @date September 21, 2025
+ * @date October 18, 2026
  */
-void _crossing_out_matrix_element(matrix_t *A, matrix_t *result, int skip_row,
-                                  int skip_col);
+void _minor_to_buffer(const matrix_t *A, double *dst, int skip_row,
+                      int skip_col);
 
 /**
  * @brief Validates if the matrix is correctly initialized.
@@ -27,4 +50,684 @@ void _crossing_out_matrix_element(matrix_t *A, matrix_t *result, int skip_row,
  */
 int _validation_matrix(const matrix_t *A);
 
+/**
+ * @brief Checks whether the matrix storage is one contiguous allocation.
+ * @param A Pointer to a valid matrix.
+ * @return `1` if the row pointers and the elements share a single block made
+ * by `s21_create_matrix` (packed or aligned), `0` for per-row allocated
+ * matrices.
+ * @note A single-block matrix is released with exactly one `free` call.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _is_single_block(const matrix_t *A);
+
+/**
+ * @brief Checks whether all elements form one row-major run without gaps.
+ * @param A Pointer to a valid matrix.
+ * @return `1` if element `(i, j)` lives at `matrix[0][i * columns + j]`,
+ * `0` otherwise.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _is_dense(const matrix_t *A);
+
+/**
+ * @brief Checks whether the elements of two matrices may share memory.
+ * @param A Pointer to a valid matrix.
+ * @param B Pointer to a valid matrix.
+ * @return `1` if the address ranges spanned by the rows of A and B
+ * intersect, `0` if writing one cannot change the other.
+ * @note Per-row allocated matrices are treated as the hull of their rows, so
+ * the test may report overlaps that do not exist, never the reverse.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _shares_storage(const matrix_t *A, const matrix_t *B);
+
+/**
+ * @brief Returns the distance between consecutive rows of a single block.
+ * @param A Pointer to a valid matrix.
+ * @return Stride in doubles if the matrix is one block whose rows are evenly
+ * spaced (`columns` for one-row matrices), `0` otherwise.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+long long _stride(const matrix_t *A);
+
+/**
+ * @brief Runs an element-wise kernel over three same-shaped matrices.
+ * @param op Kernel to apply.
+ * @param A Pointer to the first operand.
+ * @param B Pointer to the second operand.
+ * @param C Pointer to the destination.
+ * @return None (void function).
+ * @note Single-block operands with a common stride are processed with one
+ * call spanning all rows (row padding included), other layouts row by row.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void _apply_binary(binary_kernel_t op, const matrix_t *A, const matrix_t *B,
+                   matrix_t *C);
+
+/**
+ * @brief Runs a scaling kernel over two same-shaped matrices.
+ * @param op Kernel to apply.
+ * @param A Pointer to the source matrix.
+ * @param number Scalar multiplier.
+ * @param C Pointer to the destination.
+ * @return None (void function).
+ * @note Single-block operands with a common stride are processed with one
+ * call spanning all rows (row padding included), other layouts row by row.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void _apply_scale(scale_kernel_t op, const matrix_t *A, double number,
+                  matrix_t *C);
+
+/**
+ * @brief Copies matrix elements into a dense row-major buffer.
+ * @param A Pointer to a valid matrix.
+ * @param dst Buffer of at least `rows * columns` doubles.
+ * @return None (void function).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void _copy_to_buffer(const matrix_t *A, double *dst);
+
+/**
+ * @brief Copies the elements of a matrix into a matrix of the same shape.
+ * @param A Pointer to the source matrix.
+ * @param result Pointer to the destination matrix; rows may be the very same
+ * rows as the source.
+ * @return None (void function).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void _copy_rows(const matrix_t *A, matrix_t *result);
+
+/**
+ * @brief Dot product of two contiguous arrays.
+ * @param a First array.
+ * @param b Second array.
+ * @param n Number of elements; `0` gives `0.0`.
+ * @return Sum of `a[k] * b[k]`.
+ * @note Accumulates into four partial sums to hide the add latency.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+double _dot(const double *a, const double *b, int n);
+
+/**
+ * @brief LU factorization with partial pivoting, performed in place.
+ * @param lu Dense row-major `n x n` buffer; on return holds the unit lower
+ * factor L below the diagonal and the upper factor U on and above it.
+ * @param n Order of the matrix.
+ * @param pivots Array of `n` ints; row `k` was swapped with `pivots[k]`.
+ * @return Sign of the row permutation: `1` or `-1`.
+ * @note A zero pivot column is left as is, so singular input yields a zero on
+ * the diagonal of U instead of an error.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _lu_decompose(double *lu, int n, int *pivots);
+
+/**
+ * @brief Product of the diagonal of a square buffer without overflow.
+ * @param a Row-major `n x n` buffer.
+ * @param n Order of the matrix.
+ * @param exponent Receives the binary exponent of the product.
+ * @return Mantissa `m` with `0.5 <= |m| < 1` (or `0`), the product being
+ * `m * 2^exponent`.
+ * @note The running product is renormalized with `frexp` after every factor,
+ * which is exact, so no intermediate value overflows or underflows.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+double _diagonal_product(const double *a, int n, int *exponent);
+
+/**
+ * @brief Pivot-based nonsingularity test of a triangular factorization.
+ * @param a Row-major `n x n` factorized buffer.
+ * @param n Order of the matrix.
+ * @param squared `1` for a Cholesky factor (pivots are the squared diagonal),
+ * `0` for an LU factor.
+ * @return `1` if all pivots are finite and the smallest one in magnitude
+ * exceeds `n * DBL_EPSILON` times the largest, `0` otherwise.
+ * @note Unlike a threshold on the determinant, this does not depend on the
+ * order or the scale of the matrix.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _well_conditioned(const double *a, int n, int squared);
+
+/**
+ * @brief Pivot-based nonsingularity test over pivots `a[0]`, `a[stride]`,
+ * ..., `a[(n - 1) * stride]`.
+ * @param a First pivot.
+ * @param n Number of pivots.
+ * @param stride Distance between consecutive pivots in doubles.
+ * @param squared `1` when the pivots are the squares of the stored values.
+ * @return Same as `_well_conditioned`, which is this test with stride
+ * `n + 1`; band and tridiagonal factors pass their own layout.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _pivots_well_conditioned(const double *a, int n, size_t stride,
+                             int squared);
+
+/**
+ * @brief Determinant from a factorization made by `_lu_decompose`.
+ * @param lu Factorized row-major `n x n` buffer.
+ * @param n Order of the matrix.
+ * @param sign Permutation sign returned by `_lu_decompose`.
+ * @return Product of the diagonal of U with the permutation sign applied;
+ * over- or underflows only when the determinant itself does.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+double _lu_determinant(const double *lu, int n, int sign);
+
+/**
+ * @brief Logarithm of the absolute determinant of an LU factorization.
+ * @param lu Factorized row-major `n x n` buffer.
+ * @param n Order of the matrix.
+ * @param sign Permutation sign returned by `_lu_decompose`.
+ * @param det_sign Receives the sign of the determinant: `1`, `-1` or `0`.
+ * @return `log|det|`, `-INFINITY` for a zero pivot.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+double _lu_log_determinant(const double *lu, int n, int sign, int *det_sign);
+
+/**
+ * @brief Solves `A * X = B` in place using a factorization of A.
+ * @param lu Row-major `n x n` buffer factorized by `_lu_decompose`.
+ * @param n Order of the matrix.
+ * @param pivots Row interchanges produced by `_lu_decompose`.
+ * @param x Row pointers of the `n x nrhs` right-hand side; overwritten by X.
+ * @param nrhs Number of right-hand side columns.
+ * @return None (void function).
+ * @note Works row by row, so every inner loop runs over contiguous memory;
+ * with many right-hand sides both substitutions go through `_trsm_dense`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void _lu_solve(const double *lu, int n, const int *pivots, double **x,
+               int nrhs);
+
+/**
+ * @brief Solves `A * x = b` in place for one contiguous right-hand side.
+ * @param lu Row-major `n x n` buffer factorized by `_lu_decompose`.
+ * @param n Order of the matrix.
+ * @param pivots Row interchanges produced by `_lu_decompose`.
+ * @param x Array of `n` doubles holding b; overwritten by x.
+ * @return None (void function).
+ * @note Substitutions are written as dot products along the rows of the
+ * factors, which avoids the per-row loop overhead of `_lu_solve` for a
+ * single column.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void _lu_solve_vector(const double *lu, int n, const int *pivots, double *x);
+
+/**
+ * @brief Cholesky factorization `A = L * L^T`, performed in place.
+ * @param a Dense row-major `n x n` buffer; only the lower triangle is read.
+ * On success the lower triangle holds L; the strict upper triangle is
+ * scratch.
+ * @param n Order of the matrix.
+ * @return Error code: `0` (OK), `1` (scratch allocation failure), `2` (the
+ * matrix is not positive definite).
+ * @note Right-looking and blocked: each 96-column panel is factored with dot
+ * products along rows, and the trailing matrix is updated through `_gemm`
+ * one block row at a time, so only its lower block triangle is computed.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _cholesky_decompose(double *a, int n);
+
+/**
+ * @brief Determinant from a factor made by `_cholesky_decompose`.
+ * @param l Factorized row-major `n x n` buffer.
+ * @param n Order of the matrix.
+ * @return Square of the product of the diagonal of L.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+double _cholesky_determinant(const double *l, int n);
+
+/**
+ * @brief Logarithm of the determinant from a Cholesky factor.
+ * @param l Factorized row-major `n x n` buffer.
+ * @param n Order of the matrix.
+ * @return `log(det)`; the determinant of an SPD matrix is positive.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+double _cholesky_log_determinant(const double *l, int n);
+
+/**
+ * @brief Solves `L * L^T * X = B` in place.
+ * @param l Row-major `n x n` buffer factorized by `_cholesky_decompose`.
+ * @param n Order of the matrix.
+ * @param x Row pointers of the `n x nrhs` right-hand side; overwritten by X.
+ * @param nrhs Number of right-hand side columns.
+ * @return None (void function).
+ * @note Both substitutions walk rows of L, the second one column-oriented,
+ * so every inner loop runs over contiguous memory; with many right-hand sides
+ * they go through `_trsm_dense`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void _cholesky_solve(const double *l, int n, double **x, int nrhs);
+
+/**
+ * @brief Solves `L * L^T * x = b` in place for one contiguous right-hand
+ * side.
+ * @param l Row-major `n x n` buffer factorized by `_cholesky_decompose`.
+ * @param n Order of the matrix.
+ * @param x Array of `n` doubles holding b; overwritten by x.
+ * @return None (void function).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void _cholesky_solve_vector(const double *l, int n, double *x);
+
+/**
+ * @brief Cholesky-factors a matrix that looks symmetric positive definite.
+ * @param A Pointer to a valid square matrix.
+ * @param buffer Buffer of at least `rows * rows` doubles.
+ * @return `1` if SPD detection is enabled, A is of order 32 or more, exactly
+ * symmetric with a positive diagonal, and the factorization succeeded (L is
+ * in `buffer`); `0` otherwise (`buffer` content is undefined).
+ * @note The symmetry check costs `O(n^2)` comparisons and stops at the first
+ * mismatch; a failed factorization costs at most what it completed.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _spd_factor(const matrix_t *A, double *buffer);
+
+/**
+ * @brief Blocked matrix product `C += A * B` on row-pointer storage.
+ * @param m Number of rows of A and C.
+ * @param n Number of columns of B and C.
+ * @param k Number of columns of A and rows of B.
+ * @param a Row pointers of A.
+ * @param b Row pointers of B.
+ * @param c Row pointers of C.
+ * @return Error code: `0` (OK), `1` (packing buffer allocation failure).
+ * @note Large products pack A and B into cache-sized panels and run a
+ * register-blocked micro-kernel; small ones use a plain i-k-j loop.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _gemm(int m, int n, int k, double *const *a, double *const *b,
+          double **c);
+
+/**
+ * @brief Blocked matrix product `C = alpha * A * B + beta * C` on row-pointer
+ * storage.
+ * @param m Number of rows of A and C.
+ * @param n Number of columns of B and C.
+ * @param k Number of columns of A and rows of B, at least `1`.
+ * @param alpha Scale applied to the product, folded into the packed A panels.
+ * @param a Row pointers of A.
+ * @param b Row pointers of B.
+ * @param beta Scale applied to C when the first k panel is written back;
+ * `0` stores without reading C.
+ * @param c Row pointers of C, not overlapping A or B.
+ * @return Error code: `0` (OK), `1` (packing buffer allocation failure).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _gemm_scaled(int m, int n, int k, double alpha, double *const *a,
+                 double *const *b, double beta, double **c);
+
+/**
+ * @brief Matrix-vector product for `_gemm_trans` when op(B) is one column or
+ * op(A) is one row.
+ * @param trans_a Nonzero when A is stored transposed.
+ * @param trans_b Nonzero when B is stored transposed.
+ * @param m Number of rows of op(A) and C.
+ * @param n Number of columns of op(B) and C; `m` or `n` is `1`.
+ * @param k Number of columns of op(A) and rows of op(B).
+ * @param alpha Scale applied to the product.
+ * @param a Row pointers of A as stored.
+ * @param b Row pointers of B as stored.
+ * @param beta Scale applied to C; `0` stores without reading C.
+ * @param c Row pointers of C, not overlapping A or B.
+ * @return Error code: `0` (OK), `1` (scratch allocation failure).
+ * @note Rows of the stored matrix that meet the vector element-wise are
+ * reduced four at a time by the `dot4` kernel; otherwise the result is
+ * accumulated from four scaled rows at a time by `axpy4`, one L1-sized block
+ * of it at a time. A vector scattered over row pointers is gathered into the
+ * arena.
+ * Large products split the result across the worker pool.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _gemv(int trans_a, int trans_b, int m, int n, int k, double alpha,
+          double *const *a, double *const *b, double beta, double **c);
+
+/**
+ * @brief Blocked matrix product `C = alpha * op(A) * op(B) + beta * C`.
+ * @param trans_a Nonzero when A is stored transposed, as a `k x m` matrix.
+ * @param trans_b Nonzero when B is stored transposed, as an `n x k` matrix.
+ * @param m Number of rows of op(A) and C.
+ * @param n Number of columns of op(B) and C.
+ * @param k Number of columns of op(A) and rows of op(B), at least `1`.
+ * @param alpha Scale applied to the product.
+ * @param a Row pointers of A as stored.
+ * @param b Row pointers of B as stored.
+ * @param beta Scale applied to C; `0` stores without reading C.
+ * @param c Row pointers of C, not overlapping A or B.
+ * @return Error code: `0` (OK), `1` (packing buffer allocation failure).
+ * @note Transposition happens while packing panels, so no transposed copy
+ * of an operand is formed.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _gemm_trans(int trans_a, int trans_b, int m, int n, int k, double alpha,
+                double *const *a, double *const *b, double beta, double **c);
+
+/**
+ * @brief Matrix product `C = A * B` by Strassen-Winograd recursion.
+ * @param m Number of rows of A and C.
+ * @param n Number of columns of B and C.
+ * @param k Number of columns of A and rows of B.
+ * @param a Row pointers of A.
+ * @param b Row pointers of B.
+ * @param c Row pointers of C, not overlapping A or B; overwritten.
+ * @return Error code: `0` (OK), `1` (workspace allocation failure).
+ * @note Halves every dimension while all of them are at least twice the
+ * cutover, then calls `_gemm_scaled`; odd dimensions are peeled off and
+ * finished with thin products. The workspace for the whole recursion is
+ * sized up front and taken from the arena in one allocation.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _strassen(int m, int n, int k, double *const *a, double *const *b,
+              double **c);
+
+/**
+ * @brief Checks whether a product is routed to Strassen-Winograd.
+ * @param m Number of rows of the product.
+ * @param n Number of columns of the product.
+ * @param k Inner dimension.
+ * @return `1` if a threshold is set with `s21_set_strassen_threshold` and all
+ * three dimensions reach it, `0` otherwise.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _use_strassen(int m, int n, int k);
+
+/**
+ * @brief Arena for temporaries of the calling thread.
+ * @return The arena selected with `s21_set_arena`, otherwise the per-thread
+ * default arena; `NULL` only if the default arena cannot be allocated.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+s21_arena_t *_arena(void);
+
+/**
+ * @brief Creates a zeroed matrix with 64-byte aligned, padded rows.
+ * @param rows Number of rows (positive).
+ * @param columns Number of columns (positive).
+ * @param result Pointer to store the created matrix.
+ * @return Error code: `0` (OK), `1` (size overflow or allocation failure).
+ * @note A header line between the row pointers and the rows carries a tag
+ * that `_is_aligned_block` recognises; release the block with
+ * `_aligned_free`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _aligned_create(int rows, int columns, matrix_t *result);
+
+/**
+ * @brief Checks whether a matrix is a block made by `_aligned_create`.
+ * @param A Pointer to a valid matrix.
+ * @return `1` for a live aligned block, `0` otherwise.
+ * @note The row layout is checked first and the header tag only read when
+ * it matches, so packed matrices are rejected without touching the header.
+ * No lock is taken.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _is_aligned_block(const matrix_t *A);
+
+/**
+ * @brief Clears the tag of a block made by `_aligned_create` and frees it.
+ * @param block Row pointer array of the matrix.
+ * @param rows Number of rows of the matrix.
+ * @return None (void function).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void _aligned_free(double **block, int rows);
+
+/**
+ * @brief Creates a single-block matrix, optionally without zeroing it.
+ * @param rows Number of rows.
+ * @param columns Number of columns.
+ * @param result Pointer to store the created matrix.
+ * @param zero Non-zero to clear the elements, `0` when the caller overwrites
+ * every element.
+ * @return Error code: `0` (OK), `1` (incorrect size or allocation failure).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _create_matrix(int rows, int columns, matrix_t *result, int zero);
+
+/**
+ * @brief Takes a cached block of the given shape from the calling thread's
+ * recycling pool.
+ * @param rows Number of rows.
+ * @param columns Number of columns.
+ * @return Block with row pointer slots and element storage (contents
+ * undefined), or `NULL` when the pool is disabled or holds no such block.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+double **_recycle_take(int rows, int columns);
+
+/**
+ * @brief Offers a freed single-block matrix to the calling thread's
+ * recycling pool.
+ * @param block Block allocated by `_create_matrix`.
+ * @param rows Number of rows.
+ * @param columns Number of columns.
+ * @return `1` if the pool kept the block, `0` if the caller must free it.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _recycle_put(double **block, int rows, int columns);
+
+/**
+ * @brief Determinant of a matrix of order 1 to 4 in closed form.
+ * @param a Row pointers of the matrix.
+ * @param n Order, `1 <= n <= S21_SMALL_MAX`.
+ * @return Determinant.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+double _det_small(double *const *a, int n);
+
+/**
+ * @brief Adjugate and determinant of a matrix of order 1 to 4 in closed form.
+ * @param a Row pointers of the matrix.
+ * @param n Order, `1 <= n <= S21_SMALL_MAX`.
+ * @param adj Row-major `n x n` buffer receiving the adjugate (the transposed
+ * matrix of algebraic complements).
+ * @return Determinant.
+ * @note No allocation and no pivoting; the inverse is `adj / det`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+double _adjugate_small(double *const *a, int n, double *adj);
+
+/**
+ * @brief Singularity test for the closed-form small-matrix kernels.
+ * @param a Row pointers of a matrix of order 1 to 4.
+ * @param n Order of the matrix.
+ * @param det Determinant of the matrix.
+ * @return `1` if `|det|` is not above `n * DBL_EPSILON` times the product of
+ * the row 1-norms (an upper bound of `|det|`) or is not finite, `0`
+ * otherwise.
+ * @note Relative to the entries, so uniformly scaled matrices are judged
+ * alike, unlike an absolute threshold on the determinant.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _small_singular(double *const *a, int n, double det);
+
+/**
+ * @brief Product `C = A * B` of two square matrices of order 2 to 4.
+ * @param a Row pointers of A.
+ * @param b Row pointers of B.
+ * @param c Row pointers of C, which may alias A or B.
+ * @param n Order, `2 <= n <= S21_SMALL_MAX`.
+ * @return None (void function).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void _mult_small(double *const *a, double *const *b, double **c, int n);
+
+/**
+ * @brief Checks a sparse matrix for missing storage or impossible fields.
+ * @param A Pointer to the sparse matrix.
+ * @return `1` if the matrix is invalid, `0` otherwise.
+ * @note The order of the indices is trusted, not checked.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _sparse_invalid(const s21_sparse_t *A);
+
+/**
+ * @brief Number of compressed rows (CSR) or columns (CSC).
+ * @param A Pointer to a valid sparse matrix.
+ * @return Length of `offsets` minus one.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _sparse_major(const s21_sparse_t *A);
+
+/**
+ * @brief Allocates a sparse matrix in one block.
+ * @param rows Number of rows.
+ * @param columns Number of columns.
+ * @param format `S21_SPARSE_CSR` or `S21_SPARSE_CSC`.
+ * @param nnz Number of entries.
+ * @param result Pointer to the sparse matrix to fill; offsets and entries
+ * are left uninitialized.
+ * @return Error code: `0` (OK), `1` (allocation failure).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _sparse_alloc(int rows, int columns, int format, int nnz,
+                  s21_sparse_t *result);
+
+/**
+ * @brief Transposes compressed arrays: turns CSR arrays into CSC arrays of
+ * the same matrix and vice versa.
+ * @param major Number of compressed rows of the source.
+ * @param minor Number of columns of the source.
+ * @param offsets Source offsets, `major + 1` of them.
+ * @param indices Source indices.
+ * @param values Source values.
+ * @param t_offsets Receives `minor + 1` offsets.
+ * @param t_indices Receives the indices, ascending within each row.
+ * @param t_values Receives the values.
+ * @return None (void function).
+ * @note One counting pass; `t_offsets` doubles as the insertion cursor.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void _sparse_transpose(int major, int minor, const int *offsets,
+                       const int *indices, const double *values,
+                       int *t_offsets, int *t_indices, double *t_values);
+
+/**
+ * @brief Presents a sparse matrix in the given format.
+ * @param A Pointer to a valid sparse matrix.
+ * @param format Wanted format.
+ * @param arena Arena receiving converted arrays.
+ * @param result Pointer to store A itself, or a copy in `format` whose
+ * arrays live in `arena` and must not be freed.
+ * @return Error code: `0` (OK), `1` (arena allocation failure).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _sparse_in_format(const s21_sparse_t *A, int format, s21_arena_t *arena,
+                      s21_sparse_t *result);
+
+/**
+ * @brief Checks a band matrix for missing storage or an impossible shape.
+ * @param A Pointer to the band matrix.
+ * @return `1` if the matrix is invalid, `0` otherwise.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _band_invalid(const s21_band_t *A);
+
+/**
+ * @brief Solves `op(T) * X = B` in place for a triangular T (TRSM).
+ * @param n Order of T.
+ * @param t Row pointers of T: `t[i][j]` is element `(i, j)` for every
+ * `(i, j)` in the stored triangle; nothing outside it is read.
+ * @param upper Nonzero when T is upper triangular.
+ * @param trans Nonzero to solve with T^T.
+ * @param unit Nonzero to take the diagonal of T as ones without reading it.
+ * @param x Row pointers of the `n x nrhs` right-hand side; overwritten by X.
+ * @param nrhs Number of right-hand side columns.
+ * @return Error code: `0` (OK), `1` (scratch allocation failure, X is left
+ * untouched).
+ * @note With 8 or more right-hand sides the solve is blocked: each 64-row
+ * diagonal block is solved by substitution and the remaining rows of X are
+ * updated through `_gemm_trans`, which carries most of the flops.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _trsm(int n, double *const *t, int upper, int trans, int unit,
+          double **x, int nrhs);
+
+/**
+ * @brief Runs `_trsm` on a dense row-major `n x n` factor when blocking pays.
+ * @param a Row-major buffer holding T in one triangle.
+ * @param n Order of T.
+ * @param upper Nonzero when T is upper triangular.
+ * @param trans Nonzero to solve with T^T.
+ * @param unit Nonzero for an implicit unit diagonal.
+ * @param x Row pointers of the `n x nrhs` right-hand side.
+ * @param nrhs Number of right-hand side columns.
+ * @return `1` if X was overwritten by the solution, `0` if X is untouched
+ * because the system is too small to block or scratch allocation failed.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _trsm_dense(const double *a, int n, int upper, int trans, int unit,
+                double **x, int nrhs);
+
+/**
+ * @brief Checks a packed matrix for missing storage, an invalid order, kind
+ * or triangle.
+ * @param A Pointer to the packed matrix.
+ * @return `1` if the matrix is invalid, `0` otherwise.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _packed_invalid(const s21_packed_t *A);
+
+/**
+ * @brief Fills row pointers addressing a packed matrix like a dense one.
+ * @param A Pointer to a valid packed matrix.
+ * @param rows Array of `n` pointers; `rows[i][j]` becomes element `(i, j)`
+ * for every `(i, j)` in the stored triangle.
+ * @return None (void function).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void _packed_rows(const s21_packed_t *A, double **rows);
+
 #endif
@@ -0,0 +1,74 @@
+#ifndef S21_KERNELS_H
+#define S21_KERNELS_H
+
+/**
+ * @brief Largest register block (rows x columns) of any GEMM micro-kernel.
+ */
+#define S21_KERNEL_MR_MAX 8
+#define S21_KERNEL_NR_MAX 16
+
+/**
+ * @brief Number of rows handled together by the matrix-vector kernels.
+ */
+#define S21_KERNEL_GEMV_ROWS 4
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define S21_HAVE_X86_SIMD 1
+#define S21_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define S21_TARGET_AVX512 __attribute__((target("avx512f,avx2,fma")))
+#else
+#define S21_HAVE_X86_SIMD 0
+#endif
+
+/**
+ * @brief Table of the innermost loops used by the matrix operations.
+ *
+ * One table exists per instruction set; the active one is chosen from CPUID
+ * when the library is loaded and can be overridden with `s21_set_isa`.
+ */
+typedef struct kernels_struct {
+  int isa;
+  int mr;
+  int nr;
+  void (*add)(const double *a, const double *b, double *c, int n);
+  void (*sub)(const double *a, const double *b, double *c, int n);
+  void (*scale)(const double *a, double number, double *c, int n);
+  int (*eq)(const double *a, const double *b, int n);
+  void (*gemm)(int kc, const double *a, const double *b, double *ab);
+  void (*dot4)(const double *const *a, const double *x, int n, double *out);
+  void (*axpy4)(const double *const *x, const double *alpha, double *y,
+                int n);
+} kernels_t;
+
+/**
+ * @brief Returns the kernel table of the active instruction set.
+ * @return Pointer to a static table, never `NULL`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+const kernels_t *_kernels(void);
+
+/**
+ * @brief Portable kernels, always available.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+extern const kernels_t _kernels_scalar;
+
+#if S21_HAVE_X86_SIMD
+/**
+ * @brief AVX2 + FMA kernels (4-wide, 6x8 GEMM register block).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+extern const kernels_t _kernels_avx2;
+
+/**
+ * @brief AVX-512F kernels (8-wide, 8x16 GEMM register block).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+extern const kernels_t _kernels_avx512;
+#endif
+
+#endif
@@ -15,6 +15,11 @@
  * matrix - pointer to an array of row pointers; each row is an array of double
  * rows   - number of rows
  * columns- number of columns
+ *
+ * Matrices made by `s21_create_matrix` keep the row pointers and all elements
+ * in one row-major block, so `matrix[0]` addresses `rows * columns` contiguous
+ * doubles. Matrices with individually allocated rows are still accepted by
+ * every function and released correctly by `s21_remove_matrix`.
  */
 typedef struct matrix_struct {
   double **matrix;
@@ -22,6 +27,205 @@ typedef struct matrix_struct {
   int columns;
 } matrix_t;
 
+/**
+ * @brief Scratch arena (bump allocator) for temporary buffers
+ *
+ * head    - first memory chunk
+ * current - chunk allocations are currently taken from
+ * used    - bytes taken from the current chunk
+ *
+ * Chunks of a caller-owned arena are never returned to the heap before
+ * `s21_arena_destroy`, so once an arena has grown to the working-set size
+ * of an algorithm, repeated calls do not touch the heap. Fields are managed
+ * by the `s21_arena_*` functions.
+ */
+typedef struct arena_struct {
+  struct s21_arena_chunk *head;
+  struct s21_arena_chunk *current;
+  size_t used;
+} s21_arena_t;
+
+/**
+ * @brief Arena position saved by `s21_arena_mark`
+ */
+typedef struct arena_mark_struct {
+  struct s21_arena_chunk *chunk;
+  size_t used;
+} s21_arena_mark_t;
+
+/**
+ * @brief LU factorization of a square matrix, made by `s21_lu_factor`
+ *
+ * n      - order of the factorized matrix
+ * sign   - sign of the row permutation (`1` or `-1`)
+ * lu     - row-major `n x n` factors: unit lower L below the diagonal, upper U
+ *          on and above it
+ * pivots - row interchanges: row `k` was swapped with row `pivots[k]`
+ *
+ * Owns its memory; release it with `s21_lu_free`.
+ */
+typedef struct lu_struct {
+  int n;
+  int sign;
+  double *lu;
+  int *pivots;
+} s21_lu_t;
+
+/**
+ * @brief Cholesky factor of a symmetric positive-definite matrix, made by
+ * `s21_cholesky_factor`
+ *
+ * n - order of the factorized matrix
+ * l - row-major `n x n` buffer whose lower triangle holds L, `A = L * L^T`;
+ *     the strict upper triangle is unspecified
+ *
+ * Owns its memory; release it with `s21_cholesky_free`.
+ */
+typedef struct cholesky_struct {
+  int n;
+  double *l;
+} s21_cholesky_t;
+
+/**
+ * @brief Counters of the calling thread's matrix recycling pool
+ *
+ * hits            - creations served from the pool
+ * misses          - creations that had to allocate while the pool was enabled
+ * retained_bytes  - bytes currently cached
+ * retained_blocks - matrices currently cached
+ */
+typedef struct matrix_pool_stats_struct {
+  unsigned long long hits;
+  unsigned long long misses;
+  size_t retained_bytes;
+  size_t retained_blocks;
+} s21_matrix_pool_stats_t;
+
+/**
+ * @brief Read-only view of (part of) a matrix without copying its elements
+ *
+ * matrix        - row pointers of the viewed matrix (the base)
+ * rows          - number of rows of the view
+ * columns       - number of columns of the view
+ * row_offset    - first source row
+ * column_offset - first source column
+ * row_step      - source row stride between consecutive view rows
+ * column_step   - source column stride between consecutive view columns
+ * skip_row      - source row left out (minors), `-1` for none
+ * skip_column   - source column left out (minors), `-1` for none
+ * row_map       - explicit source row indices, overrides offset and step
+ * column_map    - explicit source column indices, overrides offset and step
+ * transposed    - non-zero when the view is the transpose of the mapping
+ *
+ * Views are built by the `s21_view_*` constructors in O(1) (index maps are
+ * referenced, not copied) and stay valid as long as the viewed matrix and the
+ * maps do.
+ */
+typedef struct view_struct {
+  double **matrix;
+  int rows;
+  int columns;
+  int row_offset;
+  int column_offset;
+  int row_step;
+  int column_step;
+  int skip_row;
+  int skip_column;
+  const int *row_map;
+  const int *column_map;
+  int transposed;
+} s21_view_t;
+
+/**
+ * @brief Sparse matrix in compressed sparse row (CSR) or column (CSC) form
+ *
+ * rows    - number of rows
+ * columns - number of columns
+ * format  - `S21_SPARSE_CSR` or `S21_SPARSE_CSC`
+ * nnz     - number of stored entries
+ * offsets - `rows + 1` (CSR) or `columns + 1` (CSC) positions: the entries
+ *           of row (column) `i` are `offsets[i] .. offsets[i + 1] - 1`
+ * indices - column (CSR) or row (CSC) of every entry, strictly ascending
+ *           within each row (column)
+ * values  - value of every entry
+ *
+ * Takes `12 * nnz + 4 * (offsets length)` bytes: a 1M x 1M matrix with 10M
+ * entries needs about 124 MB. Owns its memory; release it with
+ * `s21_sparse_free`.
+ */
+typedef struct sparse_struct {
+  int rows;
+  int columns;
+  int format;
+  int nnz;
+  int *offsets;
+  int *indices;
+  double *values;
+} s21_sparse_t;
+
+/**
+ * @brief Square band matrix with `kl` subdiagonals and `ku` superdiagonals
+ *
+ * n    - order of the matrix
+ * kl   - number of subdiagonals
+ * ku   - number of superdiagonals
+ * data - row-major `n x (kl + ku + 1)` band: element `(i, j)` with
+ *        `i - kl <= j <= i + ku` is `data[i * (kl + ku + 1) + j - i + kl]`;
+ *        slots that fall outside the matrix hold zero
+ *
+ * Owns its memory; release it with `s21_band_free`.
+ */
+typedef struct band_struct {
+  int n;
+  int kl;
+  int ku;
+  double *data;
+} s21_band_t;
+
+/**
+ * @brief LU factorization of a band matrix with partial pivoting, made by
+ * `s21_band_lu_factor`
+ *
+ * n, kl, ku - shape of the factorized matrix
+ * lu        - row-major `n x (2 * kl + ku + 1)` band: row `i` holds columns
+ *             `i - kl .. i + kl + ku`; U, whose bandwidth grows by `kl`
+ *             through the interchanges, from the diagonal on, and the
+ *             multipliers of L to its left
+ * pivots    - row interchanges: row `k` was swapped with row `pivots[k]`
+ *
+ * Owns its memory; release it with `s21_band_lu_free`.
+ */
+typedef struct band_lu_struct {
+  int n;
+  int kl;
+  int ku;
+  double *lu;
+  int *pivots;
+} s21_band_lu_t;
+
+/**
+ * @brief Symmetric or triangular matrix with one triangle packed by rows
+ *
+ * n    - order of the matrix
+ * kind - `S21_PACKED_SYMMETRIC`, `S21_PACKED_TRIANGULAR` or
+ *        `S21_PACKED_UNIT_TRIANGULAR`
+ * uplo - `S21_PACKED_LOWER` or `S21_PACKED_UPPER`: the stored triangle
+ * data - `n * (n + 1) / 2` doubles, the stored triangle row after row:
+ *        lower row `i` holds columns `0 .. i` from `data[i * (i + 1) / 2]`,
+ *        upper row `i` holds columns `i .. n - 1` from
+ *        `data[i * n - i * (i - 1) / 2]`
+ *
+ * A symmetric matrix is the stored triangle mirrored, a triangular one is
+ * zero outside it; the diagonal of a unit triangular matrix is one whatever
+ * is stored there. Owns its memory; release it with `s21_packed_free`.
+ */
+typedef struct packed_struct {
+  int n;
+  int kind;
+  int uplo;
+  double *data;
+} s21_packed_t;
+
 /*======================================================================
     STATUS CODE DEFINITIONS
 ======================================================================*/
@@ -55,6 +259,101 @@ typedef struct matrix_struct {
  */
 #define S21_EPS 1e-6
 
+/*======================================================================
+    INSTRUCTION SET LEVELS
+======================================================================*/
+
+/**
+ * @brief Pick the best instruction set supported by the CPU.
+ */
+#define S21_ISA_AUTO -1
+
+/**
+ * @brief Portable C kernels.
+ */
+#define S21_ISA_SCALAR 0
+
+/**
+ * @brief AVX2 + FMA kernels.
+ */
+#define S21_ISA_AVX2 1
+
+/**
+ * @brief AVX-512F kernels.
+ */
+#define S21_ISA_AVX512 2
+
+/*======================================================================
+    TRANSPOSE FLAGS
+======================================================================*/
+
+/**
+ * @brief Use the operand as stored.
+ */
+#define S21_NO_TRANS 0
+
+/**
+ * @brief Use the transpose of the operand.
+ */
+#define S21_TRANS 1
+
+/*======================================================================
+    ALLOCATION MODES
+======================================================================*/
+
+/**
+ * @brief Rows packed back to back right after the row pointers (default).
+ */
+#define S21_ALLOC_PACKED 0
+
+/**
+ * @brief 64-byte aligned rows with a padded leading dimension.
+ */
+#define S21_ALLOC_ALIGNED 1
+
+/*======================================================================
+    SPARSE FORMATS
+======================================================================*/
+
+/**
+ * @brief Compressed sparse rows: entries grouped by row.
+ */
+#define S21_SPARSE_CSR 0
+
+/**
+ * @brief Compressed sparse columns: entries grouped by column.
+ */
+#define S21_SPARSE_CSC 1
+
+/*======================================================================
+    PACKED STRUCTURES
+======================================================================*/
+
+/**
+ * @brief Symmetric matrix: the stored triangle is mirrored.
+ */
+#define S21_PACKED_SYMMETRIC 0
+
+/**
+ * @brief Triangular matrix: zero outside the stored triangle.
+ */
+#define S21_PACKED_TRIANGULAR 1
+
+/**
+ * @brief Triangular matrix with an implicit unit diagonal.
+ */
+#define S21_PACKED_UNIT_TRIANGULAR 2
+
+/**
+ * @brief The lower triangle, diagonal included, is stored.
+ */
+#define S21_PACKED_LOWER 0
+
+/**
+ * @brief The upper triangle, diagonal included, is stored.
+ */
+#define S21_PACKED_UPPER 1
+
 /*======================================================================
     MATRIX OPERATIONS
 ======================================================================*/
@@ -65,11 +364,44 @@ typedef struct matrix_struct {
  * @param columns Number of columns.
  * @param result Pointer to the resulting matrix structure.
  * @return Error code: `0` (OK), `1` (incorrect matrix).
+ * @note Performs a single zero-initialized allocation holding both the row
+ * pointers and the row-major elements.
  * @author s21: tyananai
  * @date September 1, 2025
  */
 int s21_create_matrix(int rows, int columns, matrix_t *result);
 
+/**
+ * @brief Creates a matrix without clearing its elements.
+ * @param rows Number of rows in the matrix.
+ * @param columns Number of columns in the matrix.
+ * @param result Pointer to store the created matrix.
+ * @return Error code: `0` (OK), `1` (incorrect matrix).
+ * @note Element values are undefined; use it only when every element is
+ * written before being read. Saves the clearing pass, which dominates when
+ * the block comes from the recycling pool.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_create_matrix_uninit(int rows, int columns, matrix_t *result);
+
+/**
+ * @brief Creates a zeroed matrix with cache-line aligned, padded rows.
+ * @param rows Number of rows in the matrix.
+ * @param columns Number of columns in the matrix.
+ * @param result Pointer to store the created matrix.
+ * @return Error code: `0` (OK), `1` (incorrect matrix).
+ * @note Every row starts on a 64-byte boundary and rows are `stride` doubles
+ * apart, where `stride` is `columns` rounded up to a multiple of 8 plus one
+ * extra cache line when the row size is a multiple of 512 bytes, so that
+ * power-of-two widths do not map all rows onto the same cache sets. The
+ * stride is `matrix[1] - matrix[0]`. Still one allocation, released by
+ * `s21_remove_matrix`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_create_matrix_aligned(int rows, int columns, matrix_t *result);
+
 /**
  * @brief Frees memory and destroys the matrix.
  * @param A Pointer to the matrix to remove.
@@ -101,6 +433,21 @@ int s21_eq_matrix(matrix_t *A, matrix_t *B);
  */
 int s21_sum_matrix(matrix_t *A, matrix_t *B, matrix_t *result);
 
+/**
+ * @brief Adds two matrices into an existing result matrix.
+ * @param A Pointer to the first matrix.
+ * @param B Pointer to the second matrix.
+ * @param result Pointer to an allocated matrix of the same dimensions; may be
+ * `A` or `B` (`A += B`).
+ * @return Error code: `0` (OK), `1` (incorrect matrix), `2` (calculation error,
+ * e.g. mismatched sizes).
+ * @note Nothing is allocated. Other partial overlaps of `result` with the
+ * operands give undefined results.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_sum_matrix_into(matrix_t *A, matrix_t *B, matrix_t *result);
+
 /**
  * @brief Subtracts matrix B from matrix A.
  * @param A Pointer to the first matrix.
@@ -113,6 +460,20 @@ int s21_sum_matrix(matrix_t *A, matrix_t *B, matrix_t *result);
  */
 int s21_sub_matrix(matrix_t *A, matrix_t *B, matrix_t *result);
 
+/**
+ * @brief Subtracts matrix B from matrix A into an existing result matrix.
+ * @param A Pointer to the first matrix.
+ * @param B Pointer to the second matrix.
+ * @param result Pointer to an allocated matrix of the same dimensions; may be
+ * `A` or `B`.
+ * @return Error code: `0` (OK), `1` (incorrect matrix), `2` (calculation error,
+ * e.g. mismatched sizes).
+ * @note Nothing is allocated.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_sub_matrix_into(matrix_t *A, matrix_t *B, matrix_t *result);
+
 /**
  * @brief Multiplies a matrix by a scalar number.
  * @param A Pointer to the input matrix.
@@ -124,6 +485,20 @@ int s21_sub_matrix(matrix_t *A, matrix_t *B, matrix_t *result);
  */
 int s21_mult_number(matrix_t *A, double number, matrix_t *result);
 
+/**
+ * @brief Multiplies a matrix by a scalar into an existing result matrix.
+ * @param A Pointer to the input matrix.
+ * @param number Scalar multiplier.
+ * @param result Pointer to an allocated matrix of the same dimensions; may be
+ * `A`.
+ * @return Error code: `0` (OK), `1` (incorrect matrix), `2` (calculation error,
+ * mismatched sizes).
+ * @note Nothing is allocated.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_mult_number_into(matrix_t *A, double number, matrix_t *result);
+
 /**
  * @brief Multiplies two matrices (A × B).
  * @param A Pointer to the first matrix.
@@ -136,6 +511,124 @@ int s21_mult_number(matrix_t *A, double number, matrix_t *result);
  */
 int s21_mult_matrix(matrix_t *A, matrix_t *B, matrix_t *result);
 
+/**
+ * @brief Multiplies two matrices (A × B) into an existing result matrix.
+ * @param A Pointer to the first matrix.
+ * @param B Pointer to the second matrix.
+ * @param result Pointer to an allocated `A->rows x B->columns` matrix; may be
+ * `A` or `B`.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or scratch allocation
+ * failure), `2` (calculation error, e.g. mismatched sizes).
+ * @note The result is overwritten, not accumulated. When it shares storage with
+ * an operand the product is formed in the thread's scratch arena first and
+ * then copied back.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_mult_matrix_into(matrix_t *A, matrix_t *B, matrix_t *result);
+
+/**
+ * @brief General matrix multiply-accumulate `C = alpha * A × B + beta * C`.
+ * @param alpha Scale applied to the product.
+ * @param A Pointer to the first matrix.
+ * @param B Pointer to the second matrix.
+ * @param beta Scale applied to the previous contents of C.
+ * @param C Pointer to an allocated `A->rows x B->columns` matrix, updated in
+ * place; may be `A` or `B`.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or scratch allocation
+ * failure), `2` (calculation error, e.g. mismatched sizes).
+ * @note The scales are folded into the packed product and its write-back,
+ * so no temporary matrix is formed. `beta` is applied by the first 256-deep
+ * panel of the inner dimension; each further panel reads and adds to C
+ * again. With `beta == 0` the previous contents of C are not read, so they
+ * may be uninitialized or NaN. Products above 64^3 multiply-adds pack
+ * through a 4.4 MB buffer taken from the thread's scratch arena (from each
+ * worker's own buffer when threaded); when C aliases an operand, a copy of
+ * the result comes from the arena as well. Both are kept between calls.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_gemm(double alpha, matrix_t *A, matrix_t *B, double beta,
+             matrix_t *C);
+
+/**
+ * @brief Multiplies two matrices (A × B) by Strassen-Winograd recursion.
+ * @param A Pointer to the first matrix.
+ * @param B Pointer to the second matrix.
+ * @param result Pointer to store the resulting matrix.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or allocation failure),
+ * `2` (calculation error, e.g. mismatched sizes).
+ * @note Each level replaces 8 half-size products by 7 and 15 additions; the
+ * recursion halves while every dimension is at least twice the cutover
+ * (`s21_set_strassen_cutover`, 768 by default) and hands the blocks to the
+ * blocked product. The result is not bitwise equal to
+ * `s21_mult_matrix`: the normwise error bound grows like `n^log2(18)` instead
+ * of `n^2`, so entries far smaller than `|A| |B|` lose relative accuracy.
+ * `bench_strassen` prints the observed error next to both bounds.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_mult_matrix_strassen(matrix_t *A, matrix_t *B, matrix_t *result);
+
+/**
+ * @brief Multiplies two matrices, either of them optionally transposed
+ * (op(A) × op(B)).
+ * @param A Pointer to the first matrix.
+ * @param trans_a `S21_TRANS` to multiply by the transpose of A.
+ * @param B Pointer to the second matrix.
+ * @param trans_b `S21_TRANS` to multiply by the transpose of B.
+ * @param result Pointer to store the resulting matrix.
+ * @return Error code: `0` (OK), `1` (incorrect matrix), `2` (calculation
+ * error, e.g. mismatched sizes or an unknown flag).
+ * @note The transposed operand is read in transposed order while it is packed,
+ * so no transposed copy is formed.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_mult_matrix_trans(matrix_t *A, int trans_a, matrix_t *B, int trans_b,
+                          matrix_t *result);
+
+/**
+ * @brief General matrix multiply-accumulate with transpose flags,
+ * `C = alpha * op(A) × op(B) + beta * C`.
+ * @param trans_a `S21_TRANS` to multiply by the transpose of A.
+ * @param trans_b `S21_TRANS` to multiply by the transpose of B.
+ * @param alpha Scale applied to the product.
+ * @param A Pointer to the first matrix.
+ * @param B Pointer to the second matrix.
+ * @param beta Scale applied to the previous contents of C.
+ * @param C Pointer to an allocated matrix with the rows of op(A) and the
+ * columns of op(B), updated in place; may be `A` or `B`.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or scratch allocation
+ * failure), `2` (calculation error, e.g. mismatched sizes or an unknown flag).
+ * @note Behaves like `s21_gemm` on the transposed operands without forming
+ * them.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_gemm_trans(int trans_a, int trans_b, double alpha, matrix_t *A,
+                   matrix_t *B, double beta, matrix_t *C);
+
+/**
+ * @brief Multiplies a chain of matrices (A1 × A2 × ... × An) in the cheapest
+ * order.
+ * @param count Number of matrices in the chain, at least `1`.
+ * @param chain Array of `count` pointers to the matrices, in order.
+ * @param result Pointer to store the resulting matrix.
+ * @param flops Optional pointer to store the planned flop count (two per
+ * multiply-add), or `NULL`.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or allocation failure),
+ * `2` (calculation error, e.g. mismatched sizes).
+ * @note The parenthesization minimizing the flop count is found by dynamic
+ * programming over the chain dimensions (`O(count^3)` steps). Intermediate
+ * products live in the thread's scratch arena and are released as soon as
+ * they are consumed, so later products reuse their memory.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_mult_chain(int count, matrix_t **chain, matrix_t *result,
+                   double *flops);
+
 /**
  * @brief Transposes a matrix (swaps rows with columns).
  * @param A Pointer to the input matrix.
@@ -146,6 +639,21 @@ int s21_mult_matrix(matrix_t *A, matrix_t *B, matrix_t *result);
  */
 int s21_transpose(matrix_t *A, matrix_t *result);
 
+/**
+ * @brief Transposes a matrix into an existing result matrix.
+ * @param A Pointer to the input matrix.
+ * @param result Pointer to an allocated `A->columns x A->rows` matrix; may be
+ * `A` when it is square (transposition in place).
+ * @return Error code: `0` (OK), `1` (incorrect matrix or scratch allocation
+ * failure), `2` (calculation error, mismatched sizes).
+ * @note A square matrix passed as its own result is transposed in place. A
+ * result that may otherwise share storage with A is filled through scratch
+ * memory from the arena; all other calls allocate nothing.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_transpose_into(matrix_t *A, matrix_t *result);
+
 /**
  * @brief Calculates the matrix of algebraic complements.
  * @param A Pointer to the input matrix.
@@ -168,15 +676,1178 @@ int s21_calc_complements(matrix_t *A, matrix_t *result);
  */
 int s21_determinant(matrix_t *A, double *result);
 
+/**
+ * @brief Calculates the sign and the logarithm of the absolute determinant.
+ * @param A Pointer to the input matrix.
+ * @param sign Pointer to store the sign of the determinant: `1`, `-1` or `0`.
+ * @param result Pointer to store `log|det(A)|` (`-INFINITY` when singular).
+ * @return Error code: `0` (OK), `1` (incorrect matrix), `2` (calculation error,
+ * e.g. non-square matrix).
+ * @note Read from the same factorization as `s21_determinant`, but never
+ * overflows or underflows, so it stays usable for matrices whose determinant
+ * is outside the range of a double.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_log_determinant(matrix_t *A, int *sign, double *result);
+
 /**
  * @brief Calculates the inverse of a square matrix.
  * @param A Pointer to the input matrix.
  * @param result Pointer to store the inverse matrix.
  * @return Error code: `0` (OK), `1` (incorrect matrix), `2` (calculation error,
  * e.g. determinant is 0).
+ * @note A matrix counts as singular when its smallest pivot is below
+ * `n * DBL_EPSILON` times the largest, or, up to 4x4, when its determinant is
+ * below that fraction of the product of its row 1-norms. The test does not
+ * depend on the scale of the entries.
  * @author s21: tyananai
  * @date September 12, 2025
  */
 int s21_inverse_matrix(matrix_t *A, matrix_t *result);
 
+/*======================================================================
+    LINEAR SYSTEMS
+======================================================================*/
+
+/**
+ * @brief Factorizes a square matrix as `P * A = L * U` for repeated use.
+ * @param A Pointer to the input matrix.
+ * @param lu Pointer to the factorization to fill.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or allocation failure),
+ * `2` (calculation error, the matrix is not square).
+ * @note A singular matrix is factorized too: its determinant is available,
+ * while `s21_lu_solve` and `s21_lu_inverse` report it with `2`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_lu_factor(matrix_t *A, s21_lu_t *lu);
+
+/**
+ * @brief Solves `A * X = B` with a factorization of A.
+ * @param lu Pointer to a factorization made by `s21_lu_factor`.
+ * @param B Pointer to the `n x k` right-hand side matrix.
+ * @param result Pointer to store the `n x k` solution.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or factorization), `2`
+ * (calculation error, e.g. mismatched sizes or singular A).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_lu_solve(const s21_lu_t *lu, matrix_t *B, matrix_t *result);
+
+/**
+ * @brief Solves `A * X = B` with a factorization of A into an existing
+ * matrix.
+ * @param lu Pointer to a factorization made by `s21_lu_factor`.
+ * @param B Pointer to the `n x k` right-hand side matrix.
+ * @param result Pointer to an allocated `n x k` matrix; may be `B`.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or factorization), `2`
+ * (calculation error, e.g. mismatched sizes or singular A).
+ * @note Nothing is allocated, so solving a stream of right-hand sides
+ * against one factorization costs two triangular substitutions each.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_lu_solve_into(const s21_lu_t *lu, matrix_t *B, matrix_t *result);
+
+/**
+ * @brief Determinant of a factorized matrix.
+ * @param lu Pointer to a factorization made by `s21_lu_factor`.
+ * @param result Pointer to store the determinant.
+ * @return Error code: `0` (OK), `1` (incorrect factorization).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_lu_determinant(const s21_lu_t *lu, double *result);
+
+/**
+ * @brief Sign and logarithm of the absolute determinant of a factorized
+ * matrix.
+ * @param lu Pointer to a factorization made by `s21_lu_factor`.
+ * @param sign Pointer to store the sign of the determinant: `1`, `-1` or `0`.
+ * @param result Pointer to store `log|det(A)|` (`-INFINITY` when singular).
+ * @return Error code: `0` (OK), `1` (incorrect factorization).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_lu_log_determinant(const s21_lu_t *lu, int *sign, double *result);
+
+/**
+ * @brief Inverse of a factorized matrix.
+ * @param lu Pointer to a factorization made by `s21_lu_factor`.
+ * @param result Pointer to store the inverse matrix.
+ * @return Error code: `0` (OK), `1` (incorrect factorization), `2`
+ * (calculation error, the matrix is singular).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_lu_inverse(const s21_lu_t *lu, matrix_t *result);
+
+/**
+ * @brief Releases the memory of a factorization.
+ * @param lu Pointer to a factorization made by `s21_lu_factor`.
+ * @return None (void function).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void s21_lu_free(s21_lu_t *lu);
+
+/**
+ * @brief Factorizes a symmetric positive-definite matrix as `A = L * L^T`.
+ * @param A Pointer to the input matrix; only its lower triangle is read.
+ * @param factor Pointer to the factorization to fill.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or allocation failure),
+ * `2` (calculation error, the matrix is not square or not positive definite).
+ * @note Needs half the arithmetic of `s21_lu_factor`. The factorization is
+ * blocked: the trailing update runs on the matrix multiplication kernels.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_cholesky_factor(matrix_t *A, s21_cholesky_t *factor);
+
+/**
+ * @brief Solves `A * X = B` with a Cholesky factor of A.
+ * @param factor Pointer to a factorization made by `s21_cholesky_factor`.
+ * @param B Pointer to the `n x k` right-hand side matrix.
+ * @param result Pointer to store the `n x k` solution.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or factorization), `2`
+ * (calculation error, e.g. mismatched sizes or singular A).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_cholesky_solve(const s21_cholesky_t *factor, matrix_t *B,
+                       matrix_t *result);
+
+/**
+ * @brief Solves `A * X = B` with a Cholesky factor of A into an existing
+ * matrix.
+ * @param factor Pointer to a factorization made by `s21_cholesky_factor`.
+ * @param B Pointer to the `n x k` right-hand side matrix.
+ * @param result Pointer to an allocated `n x k` matrix; may be `B`.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or factorization), `2`
+ * (calculation error, e.g. mismatched sizes or singular A).
+ * @note Nothing is allocated.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_cholesky_solve_into(const s21_cholesky_t *factor, matrix_t *B,
+                            matrix_t *result);
+
+/**
+ * @brief Determinant of a Cholesky-factorized matrix.
+ * @param factor Pointer to a factorization made by `s21_cholesky_factor`.
+ * @param result Pointer to store the determinant.
+ * @return Error code: `0` (OK), `1` (incorrect factorization).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_cholesky_determinant(const s21_cholesky_t *factor, double *result);
+
+/**
+ * @brief Logarithm of the determinant of a Cholesky-factorized matrix.
+ * @param factor Pointer to a factorization made by `s21_cholesky_factor`.
+ * @param result Pointer to store `log(det(A))`; the determinant of an SPD
+ * matrix is positive.
+ * @return Error code: `0` (OK), `1` (incorrect factorization).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_cholesky_log_determinant(const s21_cholesky_t *factor,
+                                 double *result);
+
+/**
+ * @brief Inverse of a Cholesky-factorized matrix.
+ * @param factor Pointer to a factorization made by `s21_cholesky_factor`.
+ * @param result Pointer to store the inverse matrix.
+ * @return Error code: `0` (OK), `1` (incorrect factorization), `2`
+ * (calculation error, the matrix is singular).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_cholesky_inverse(const s21_cholesky_t *factor, matrix_t *result);
+
+/**
+ * @brief Releases the memory of a Cholesky factorization.
+ * @param factor Pointer to a factorization made by `s21_cholesky_factor`.
+ * @return None (void function).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void s21_cholesky_free(s21_cholesky_t *factor);
+
+/**
+ * @brief Solves `A * X = B` in one call.
+ * @param A Pointer to the square system matrix.
+ * @param B Pointer to the `n x k` right-hand side matrix.
+ * @param result Pointer to store the `n x k` solution.
+ * @return Error code: `0` (OK), `1` (incorrect matrix), `2` (calculation
+ * error, e.g. mismatched sizes or singular A).
+ * @note Factorizes A in the thread's scratch arena and substitutes directly,
+ * which is faster and more accurate than multiplying by the inverse. Use
+ * `s21_lu_factor` when A is reused. Symmetric positive-definite A is
+ * factorized by Cholesky while SPD detection is enabled.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_solve(matrix_t *A, matrix_t *B, matrix_t *result);
+
+/*======================================================================
+    MATRIX VIEWS
+======================================================================*/
+
+/**
+ * @brief Makes a view of a whole matrix.
+ * @param A Pointer to the viewed matrix.
+ * @param view Pointer to store the view.
+ * @return Error code: `0` (OK), `1` (incorrect matrix).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_view_matrix(matrix_t *A, s21_view_t *view);
+
+/**
+ * @brief Makes a view of a contiguous block of a matrix.
+ * @param A Pointer to the viewed matrix.
+ * @param row First row of the block.
+ * @param column First column of the block.
+ * @param rows Number of rows of the block.
+ * @param columns Number of columns of the block.
+ * @param view Pointer to store the view.
+ * @return Error code: `0` (OK), `1` (incorrect matrix), `2` (calculation error,
+ * block outside the matrix).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_view_block(matrix_t *A, int row, int column, int rows, int columns,
+                   s21_view_t *view);
+
+/**
+ * @brief Makes a view of every `row_step`-th row and `column_step`-th column
+ * of a matrix.
+ * @param A Pointer to the viewed matrix.
+ * @param row First source row.
+ * @param column First source column.
+ * @param rows Number of rows of the view.
+ * @param columns Number of columns of the view.
+ * @param row_step Row stride, may be negative to reverse the order.
+ * @param column_step Column stride, may be negative to reverse the order.
+ * @param view Pointer to store the view.
+ * @return Error code: `0` (OK), `1` (incorrect matrix), `2` (calculation error,
+ * indices outside the matrix).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_view_strided(matrix_t *A, int row, int column, int rows, int columns,
+                     int row_step, int column_step, s21_view_t *view);
+
+/**
+ * @brief Makes a view of the minor left after crossing out one row and one
+ * column.
+ * @param A Pointer to the viewed matrix (at least 2x2).
+ * @param row Row to cross out.
+ * @param column Column to cross out.
+ * @param view Pointer to store the view.
+ * @return Error code: `0` (OK), `1` (incorrect matrix), `2` (calculation error,
+ * matrix too small or index out of range).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_view_minor(matrix_t *A, int row, int column, s21_view_t *view);
+
+/**
+ * @brief Makes a view that picks rows and columns by index.
+ * @param A Pointer to the viewed matrix.
+ * @param rows Number of rows of the view.
+ * @param row_map Source row of each view row, or `NULL` for all rows in order.
+ * @param columns Number of columns of the view.
+ * @param column_map Source column of each view column, or `NULL` for all
+ * columns in order.
+ * @param view Pointer to store the view.
+ * @return Error code: `0` (OK), `1` (incorrect matrix), `2` (calculation error,
+ * index out of range).
+ * @note The maps are referenced, not copied, and must outlive the view.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_view_indexed(matrix_t *A, int rows, const int *row_map, int columns,
+                     const int *column_map, s21_view_t *view);
+
+/**
+ * @brief Makes the transpose of a view.
+ * @param view Pointer to the source view.
+ * @param result Pointer to store the transposed view (may be `view`).
+ * @return Error code: `0` (OK), `1` (incorrect view).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_view_transpose(const s21_view_t *view, s21_view_t *result);
+
+/**
+ * @brief Reads one element of a view.
+ * @param view Pointer to the view.
+ * @param row Row index in the view.
+ * @param column Column index in the view.
+ * @param value Pointer to store the element.
+ * @return Error code: `0` (OK), `1` (incorrect view), `2` (calculation error,
+ * index out of range).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_view_get(const s21_view_t *view, int row, int column, double *value);
+
+/**
+ * @brief Copies the elements of a view into a new matrix.
+ * @param view Pointer to the view.
+ * @param result Pointer to store the created matrix.
+ * @return Error code: `0` (OK), `1` (incorrect view or allocation failure).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_view_copy(const s21_view_t *view, matrix_t *result);
+
+/**
+ * @brief Compares two views for equality up to 6 decimal places.
+ * @param A Pointer to the first view.
+ * @param B Pointer to the second view.
+ * @return `1` (SUCCESS) if the views are equal, `0` (FAILURE) otherwise.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_view_eq(const s21_view_t *A, const s21_view_t *B);
+
+/**
+ * @brief Calculates the determinant of a square view.
+ * @param A Pointer to the view.
+ * @param result Pointer to store the determinant.
+ * @return Error code: `0` (OK), `1` (incorrect view or scratch allocation
+ * failure), `2` (calculation error, non-square view).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_view_determinant(const s21_view_t *A, double *result);
+
+/**
+ * @brief Multiplies two views (A × B) into a new matrix.
+ * @param A Pointer to the first view.
+ * @param B Pointer to the second view.
+ * @param result Pointer to store the resulting matrix.
+ * @return Error code: `0` (OK), `1` (incorrect view or allocation failure),
+ * `2` (calculation error, e.g. mismatched sizes).
+ * @note Views whose rows are contiguous runs of source rows (blocks, row
+ * strides, row maps) are multiplied in place, as are transposes of such
+ * views, which are read in transposed order while packing; other views are
+ * gathered into the scratch arena first.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_view_mult_matrix(const s21_view_t *A, const s21_view_t *B,
+                         matrix_t *result);
+
+/*======================================================================
+    SPARSE MATRICES
+======================================================================*/
+
+/**
+ * @brief Builds a sparse matrix from coordinate (triplet) lists.
+ * @param rows Number of rows.
+ * @param columns Number of columns.
+ * @param nnz Number of triplets.
+ * @param row_indices Row of every triplet.
+ * @param column_indices Column of every triplet.
+ * @param values Value of every triplet.
+ * @param format `S21_SPARSE_CSR` or `S21_SPARSE_CSC`.
+ * @param result Pointer to store the sparse matrix.
+ * @return Error code: `0` (OK), `1` (incorrect arguments or allocation
+ * failure), `2` (calculation error, index out of range).
+ * @note Triplets may come in any order; duplicates are summed. Sorting is
+ * done by two counting passes in the thread's scratch arena, in
+ * `O(nnz + rows + columns)` time.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_sparse_from_triplets(int rows, int columns, int nnz,
+                             const int *row_indices, const int *column_indices,
+                             const double *values, int format,
+                             s21_sparse_t *result);
+
+/**
+ * @brief Converts a dense matrix to sparse form, keeping its non-zero
+ * elements.
+ * @param A Pointer to the dense matrix.
+ * @param format `S21_SPARSE_CSR` or `S21_SPARSE_CSC`.
+ * @param result Pointer to store the sparse matrix.
+ * @return Error code: `0` (OK), `1` (incorrect matrix, unknown format or
+ * allocation failure).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_sparse_from_dense(matrix_t *A, int format, s21_sparse_t *result);
+
+/**
+ * @brief Converts a sparse matrix to a dense one.
+ * @param A Pointer to the sparse matrix.
+ * @param result Pointer to store the dense matrix.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or allocation failure).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_sparse_to_dense(const s21_sparse_t *A, matrix_t *result);
+
+/**
+ * @brief Copies a sparse matrix into the given format.
+ * @param A Pointer to the sparse matrix.
+ * @param format `S21_SPARSE_CSR` or `S21_SPARSE_CSC`.
+ * @param result Pointer to store the converted matrix.
+ * @return Error code: `0` (OK), `1` (incorrect matrix, unknown format or
+ * allocation failure).
+ * @note Switching formats is one counting pass, `O(nnz + rows + columns)`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_sparse_convert(const s21_sparse_t *A, int format,
+                       s21_sparse_t *result);
+
+/**
+ * @brief Reads one element of a sparse matrix.
+ * @param A Pointer to the sparse matrix.
+ * @param row Row index.
+ * @param column Column index.
+ * @param value Pointer to store the element (`0` when it is not stored).
+ * @return Error code: `0` (OK), `1` (incorrect matrix), `2` (calculation
+ * error, index out of range).
+ * @note Binary search within the row (CSR) or column (CSC).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_sparse_get(const s21_sparse_t *A, int row, int column,
+                   double *value);
+
+/**
+ * @brief Transposes a sparse matrix, keeping its format.
+ * @param A Pointer to the sparse matrix.
+ * @param result Pointer to store the transposed matrix.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or allocation failure).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_sparse_transpose(const s21_sparse_t *A, s21_sparse_t *result);
+
+/**
+ * @brief Adds two sparse matrices (A + B).
+ * @param A Pointer to the first matrix.
+ * @param B Pointer to the second matrix.
+ * @param result Pointer to store the sum, in the format of A.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or allocation failure),
+ * `2` (calculation error, mismatched sizes).
+ * @note The result stores the union of both patterns, including entries
+ * that cancel to zero. B in the other format is converted in the scratch
+ * arena first.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_sparse_sum(const s21_sparse_t *A, const s21_sparse_t *B,
+                   s21_sparse_t *result);
+
+/**
+ * @brief Subtracts two sparse matrices (A - B).
+ * @param A Pointer to the first matrix.
+ * @param B Pointer to the second matrix.
+ * @param result Pointer to store the difference, in the format of A.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or allocation failure),
+ * `2` (calculation error, mismatched sizes).
+ * @note Stores the union of both patterns, like `s21_sparse_sum`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_sparse_sub(const s21_sparse_t *A, const s21_sparse_t *B,
+                   s21_sparse_t *result);
+
+/**
+ * @brief Multiplies a sparse matrix by a number.
+ * @param A Pointer to the sparse matrix.
+ * @param number Scalar multiplier.
+ * @param result Pointer to store the scaled matrix, with the pattern of A.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or allocation failure).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_sparse_mult_number(const s21_sparse_t *A, double number,
+                           s21_sparse_t *result);
+
+/**
+ * @brief Multiplies a sparse matrix by a dense one (A × B).
+ * @param A Pointer to the sparse matrix.
+ * @param B Pointer to the dense matrix; a single column gives a
+ * sparse matrix-vector product.
+ * @param result Pointer to store the dense product.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or allocation failure),
+ * `2` (calculation error, mismatched sizes).
+ * @note Only stored entries are multiplied, `2 * nnz * B->columns` flops.
+ * CSR rows are independent and are split across the worker pool; CSC
+ * scatters each column of A into the result and splits the columns of B.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_sparse_mult_dense(const s21_sparse_t *A, matrix_t *B,
+                          matrix_t *result);
+
+/**
+ * @brief Multiplies two sparse matrices (A × B).
+ * @param A Pointer to the first matrix.
+ * @param B Pointer to the second matrix.
+ * @param result Pointer to store the sparse product, in the format of A.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or allocation failure,
+ * including more than `INT_MAX` result entries), `2` (calculation error,
+ * mismatched sizes).
+ * @note Row-by-row (Gustavson) product: a symbolic pass counts the entries of
+ * each result row, a numeric pass fills them through a dense accumulator.
+ * Both passes split rows across the worker pool when the product is large
+ * enough. CSC operands are handled as the CSR form of the transposes.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_sparse_mult(const s21_sparse_t *A, const s21_sparse_t *B,
+                    s21_sparse_t *result);
+
+/**
+ * @brief Releases the memory of a sparse matrix.
+ * @param A Pointer to the sparse matrix.
+ * @return None (void function).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void s21_sparse_free(s21_sparse_t *A);
+
+/*======================================================================
+    BANDED MATRICES
+======================================================================*/
+
+/**
+ * @brief Creates a zero band matrix.
+ * @param n Order of the matrix.
+ * @param kl Number of subdiagonals, `0 <= kl < n`.
+ * @param ku Number of superdiagonals, `0 <= ku < n`.
+ * @param result Pointer to store the band matrix.
+ * @return Error code: `0` (OK), `1` (invalid shape or allocation failure).
+ * @note Takes `n * (kl + ku + 1)` doubles instead of `n * n`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_band_create(int n, int kl, int ku, s21_band_t *result);
+
+/**
+ * @brief Copies the band of a square dense matrix.
+ * @param A Pointer to the dense matrix.
+ * @param kl Number of subdiagonals to keep.
+ * @param ku Number of superdiagonals to keep.
+ * @param result Pointer to store the band matrix.
+ * @return Error code: `0` (OK), `1` (incorrect matrix, invalid shape or
+ * allocation failure), `2` (calculation error, non-square matrix).
+ * @note Elements outside the band are dropped.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_band_from_dense(matrix_t *A, int kl, int ku, s21_band_t *result);
+
+/**
+ * @brief Converts a band matrix to a dense one.
+ * @param A Pointer to the band matrix.
+ * @param result Pointer to store the dense matrix.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or allocation failure).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_band_to_dense(const s21_band_t *A, matrix_t *result);
+
+/**
+ * @brief Reads one element of a band matrix.
+ * @param A Pointer to the band matrix.
+ * @param row Row index.
+ * @param column Column index.
+ * @param value Pointer to store the element (`0` outside the band).
+ * @return Error code: `0` (OK), `1` (incorrect matrix), `2` (calculation
+ * error, index out of range).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_band_get(const s21_band_t *A, int row, int column, double *value);
+
+/**
+ * @brief Writes one element of a band matrix.
+ * @param A Pointer to the band matrix.
+ * @param row Row index.
+ * @param column Column index, within the band of `row`.
+ * @param value New value.
+ * @return Error code: `0` (OK), `1` (incorrect matrix), `2` (calculation
+ * error, index out of range or outside the band).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_band_set(s21_band_t *A, int row, int column, double value);
+
+/**
+ * @brief Multiplies a band matrix by a dense one (A × B).
+ * @param A Pointer to the band matrix.
+ * @param B Pointer to the dense matrix; a single column gives a
+ * matrix-vector product.
+ * @param result Pointer to store the dense product.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or allocation failure),
+ * `2` (calculation error, mismatched sizes).
+ * @note Only the band is multiplied, `2 * n * (kl + ku + 1)` flops per
+ * column of B; rows are split across the worker pool when that is large
+ * enough.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_band_mult_dense(const s21_band_t *A, matrix_t *B, matrix_t *result);
+
+/**
+ * @brief Factorizes a band matrix as `P * A = L * U` with partial pivoting.
+ * @param A Pointer to the band matrix.
+ * @param lu Pointer to store the factorization.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or allocation failure).
+ * @note Takes `O(n * kl * (kl + ku))` time and `n * (2 * kl + ku + 1)`
+ * doubles. Singularity is reported by the solver.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_band_lu_factor(const s21_band_t *A, s21_band_lu_t *lu);
+
+/**
+ * @brief Solves `A * X = B` with a band LU factorization.
+ * @param lu Pointer to a factorization made by `s21_band_lu_factor`.
+ * @param B Pointer to the `n x k` right-hand side matrix.
+ * @param result Pointer to store the `n x k` solution.
+ * @return Error code: `0` (OK), `1` (incorrect factorization or matrix), `2`
+ * (calculation error, mismatched sizes or singular matrix).
+ * @note `O(n * (2 * kl + ku))` per column of B.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_band_lu_solve(const s21_band_lu_t *lu, matrix_t *B,
+                      matrix_t *result);
+
+/**
+ * @brief Releases the memory of a band LU factorization.
+ * @param lu Pointer to a factorization made by `s21_band_lu_factor`.
+ * @return None (void function).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void s21_band_lu_free(s21_band_lu_t *lu);
+
+/**
+ * @brief Solves `A * X = B` for a band matrix in one call.
+ * @param A Pointer to the band matrix.
+ * @param B Pointer to the `n x k` right-hand side matrix.
+ * @param result Pointer to store the `n x k` solution.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or scratch allocation
+ * failure), `2` (calculation error, mismatched sizes or singular matrix).
+ * @note Factorizes A in the thread's scratch arena with partial pivoting;
+ * use `s21_band_lu_factor` when A is reused.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_band_solve(const s21_band_t *A, matrix_t *B, matrix_t *result);
+
+/**
+ * @brief Solves `A * X = B` for a tridiagonal matrix by the Thomas
+ * algorithm.
+ * @param A Pointer to a band matrix with `kl <= 1` and `ku <= 1`.
+ * @param B Pointer to the `n x k` right-hand side matrix.
+ * @param result Pointer to store the `n x k` solution.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or scratch allocation
+ * failure), `2` (calculation error, mismatched sizes, wider band or a
+ * vanishing pivot).
+ * @note One forward and one backward sweep, `8 * n` flops per column of B,
+ * without pivoting. Stable for diagonally dominant or symmetric
+ * positive-definite matrices, as in spline and implicit diffusion systems;
+ * use `s21_band_solve` otherwise.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_tridiagonal_solve(const s21_band_t *A, matrix_t *B,
+                          matrix_t *result);
+
+/**
+ * @brief Releases the memory of a band matrix.
+ * @param A Pointer to the band matrix.
+ * @return None (void function).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void s21_band_free(s21_band_t *A);
+
+/*======================================================================
+    PACKED SYMMETRIC AND TRIANGULAR MATRICES
+======================================================================*/
+
+/**
+ * @brief Creates a zero packed matrix.
+ * @param n Order of the matrix.
+ * @param kind `S21_PACKED_SYMMETRIC`, `S21_PACKED_TRIANGULAR` or
+ * `S21_PACKED_UNIT_TRIANGULAR`.
+ * @param uplo `S21_PACKED_LOWER` or `S21_PACKED_UPPER`.
+ * @param result Pointer to store the packed matrix.
+ * @return Error code: `0` (OK), `1` (invalid shape, kind or triangle, or
+ * allocation failure).
+ * @note Takes `n * (n + 1) / 2` doubles instead of `n * n`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_packed_create(int n, int kind, int uplo, s21_packed_t *result);
+
+/**
+ * @brief Packs one triangle of a square dense matrix.
+ * @param A Pointer to the dense matrix.
+ * @param kind Structure of the packed matrix.
+ * @param uplo Triangle to keep.
+ * @param result Pointer to store the packed matrix.
+ * @return Error code: `0` (OK), `1` (incorrect matrix, invalid kind or
+ * triangle, or allocation failure), `2` (calculation error, non-square
+ * matrix).
+ * @note Only the kept triangle is read; symmetry is not checked.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_packed_from_dense(matrix_t *A, int kind, int uplo,
+                          s21_packed_t *result);
+
+/**
+ * @brief Unpacks a packed matrix into a dense one.
+ * @param A Pointer to the packed matrix.
+ * @param result Pointer to store the dense matrix.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or allocation failure).
+ * @note Symmetric matrices are mirrored, triangular ones zero-filled.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_packed_to_dense(const s21_packed_t *A, matrix_t *result);
+
+/**
+ * @brief Reads one element of a packed matrix.
+ * @param A Pointer to the packed matrix.
+ * @param row Row index.
+ * @param column Column index.
+ * @param value Pointer to store the element.
+ * @return Error code: `0` (OK), `1` (incorrect matrix), `2` (calculation
+ * error, index out of range).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_packed_get(const s21_packed_t *A, int row, int column, double *value);
+
+/**
+ * @brief Writes one element of a packed matrix.
+ * @param A Pointer to the packed matrix.
+ * @param row Row index.
+ * @param column Column index.
+ * @param value New value.
+ * @return Error code: `0` (OK), `1` (incorrect matrix), `2` (calculation
+ * error, index out of range, outside the triangle of a triangular matrix or
+ * on the diagonal of a unit triangular one).
+ * @note Writing `(i, j)` of a symmetric matrix also writes `(j, i)`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_packed_set(s21_packed_t *A, int row, int column, double value);
+
+/**
+ * @brief Multiplies a packed matrix by a dense one (op(A) × B): SYMM for
+ * symmetric matrices, TRMM for triangular ones.
+ * @param A Pointer to the packed matrix.
+ * @param trans `S21_TRANS` to multiply by A^T; no effect on symmetric
+ * matrices.
+ * @param B Pointer to the dense `n x k` matrix.
+ * @param result Pointer to store the dense `n x k` product.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or allocation failure),
+ * `2` (calculation error, mismatched sizes or an unknown flag).
+ * @note Every stored element is read once: off-diagonal blocks go through
+ * the packed GEMM, directly and transposed for symmetric matrices, so a
+ * triangular product costs half a dense one.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_packed_mult_dense(const s21_packed_t *A, int trans, matrix_t *B,
+                          matrix_t *result);
+
+/**
+ * @brief Solves `op(A) * X = B` for a packed triangular matrix (TRSM).
+ * @param A Pointer to the packed triangular matrix.
+ * @param trans `S21_TRANS` to solve with A^T.
+ * @param B Pointer to the `n x k` right-hand side matrix.
+ * @param result Pointer to store the `n x k` solution.
+ * @return Error code: `0` (OK), `1` (incorrect matrix or allocation failure),
+ * `2` (calculation error, symmetric matrix, mismatched sizes, an unknown flag
+ * or singular matrix).
+ * @note Blocked: each diagonal block is solved by substitution and the rest
+ * of X is updated through the packed GEMM, so many right-hand sides run at
+ * GEMM speed. Together with `s21_packed_from_cholesky` it solves
+ * `L * L^T * X = B` as two calls.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_packed_trsm(const s21_packed_t *A, int trans, matrix_t *B,
+                    matrix_t *result);
+
+/**
+ * @brief Packs the triangular factors of an LU factorization.
+ * @param lu Pointer to a factorization made by `s21_lu_factor`.
+ * @param lower Pointer to store the unit lower triangular L.
+ * @param upper Pointer to store the upper triangular U.
+ * @return Error code: `0` (OK), `1` (incorrect factorization or allocation
+ * failure).
+ * @note `A = P^T * L * U`, where P replays `lu->pivots` in order.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_packed_from_lu(const s21_lu_t *lu, s21_packed_t *lower,
+                       s21_packed_t *upper);
+
+/**
+ * @brief Packs the factor of a Cholesky factorization.
+ * @param factor Pointer to a factorization made by `s21_cholesky_factor`.
+ * @param result Pointer to store the lower triangular L, `A = L * L^T`.
+ * @return Error code: `0` (OK), `1` (incorrect factorization or allocation
+ * failure).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_packed_from_cholesky(const s21_cholesky_t *factor,
+                             s21_packed_t *result);
+
+/**
+ * @brief Releases the memory of a packed matrix.
+ * @param A Pointer to the packed matrix.
+ * @return None (void function).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void s21_packed_free(s21_packed_t *A);
+
+/*======================================================================
+    SCRATCH MEMORY
+======================================================================*/
+
+/**
+ * @brief Initializes a scratch arena.
+ * @param arena Pointer to the arena to initialize.
+ * @param buffer Caller memory used as the first chunk, or `NULL` to allocate
+ * `size` bytes up front (`size` may be `0` for a lazily growing arena).
+ * @param size Size of `buffer` or of the initial allocation in bytes.
+ * @return Error code: `0` (OK), `1` (NULL arena, buffer too small or
+ * allocation failure).
+ * @note A caller buffer must be suitably aligned for pointers and outlive the
+ * arena; it is never freed by the library. When it is exhausted the arena
+ * continues in heap chunks.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_arena_init(s21_arena_t *arena, void *buffer, size_t size);
+
+/**
+ * @brief Takes a 64-byte aligned block from the arena.
+ * @param arena Pointer to an initialized arena.
+ * @param size Block size in bytes.
+ * @return Pointer to the block or `NULL` on allocation failure.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void *s21_arena_alloc(s21_arena_t *arena, size_t size);
+
+/**
+ * @brief Saves the current arena position.
+ * @param arena Pointer to an initialized arena.
+ * @return Mark to pass to `s21_arena_release`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+s21_arena_mark_t s21_arena_mark(const s21_arena_t *arena);
+
+/**
+ * @brief Frees every block taken after `mark` in one step.
+ * @param arena Pointer to an initialized arena.
+ * @param mark Position saved by `s21_arena_mark`.
+ * @return None (void function).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void s21_arena_release(s21_arena_t *arena, s21_arena_mark_t mark);
+
+/**
+ * @brief Frees every block of the arena but keeps its memory for reuse.
+ * @param arena Pointer to an initialized arena.
+ * @return None (void function).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void s21_arena_reset(s21_arena_t *arena);
+
+/**
+ * @brief Returns all arena memory to the heap.
+ * @param arena Pointer to the arena.
+ * @return None (void function).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void s21_arena_destroy(s21_arena_t *arena);
+
+/**
+ * @brief Selects the arena used for temporaries by the calling thread.
+ * @param arena Pointer to a caller-owned arena, or `NULL` to go back to the
+ * library's per-thread default arena.
+ * @return Previously selected arena (`NULL` for the default one).
+ * @note Determinant, inverse, complements and serial matrix products take all
+ * their workspace from this arena and release it before returning, so a
+ * sequence of operations runs without heap traffic once the arena is large
+ * enough. Once empty again, the default arena keeps only its largest chunk,
+ * which settles at the high-water mark of the workload; `s21_arena_trim`
+ * gives that memory back. A caller-owned arena keeps all its chunks.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+s21_arena_t *s21_set_arena(s21_arena_t *arena);
+
+/**
+ * @brief Returns all memory of the calling thread's default arena to the
+ * heap.
+ * @return None (void function).
+ * @note Call it between operations, e.g. before a thread goes idle; the
+ * arena grows again on demand. Caller-owned arenas are not affected.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void s21_arena_trim(void);
+
+/*======================================================================
+    MATRIX RECYCLING
+======================================================================*/
+
+/**
+ * @brief Enables the matrix recycling pool and sets its size.
+ * @param max_bytes Maximum number of bytes each thread keeps cached; `0`
+ * disables the pool (the default).
+ * @return None (void function).
+ * @note When enabled, `s21_remove_matrix` keeps matrices made by
+ * `s21_create_matrix` in per-thread free lists keyed by shape, and the next
+ * creation of the same shape on that thread reuses one instead of calling
+ * the allocator. The calling thread's cache is emptied when it exceeds the
+ * new limit; other threads keep theirs until `s21_matrix_pool_trim` or thread
+ * exit. Matrices must be removed with the dimensions they were created with.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void s21_set_matrix_pool(size_t max_bytes);
+
+/**
+ * @brief Frees every matrix cached by the calling thread.
+ * @return None (void function).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void s21_matrix_pool_trim(void);
+
+/**
+ * @brief Reads the calling thread's recycling pool counters.
+ * @param stats Pointer to store the counters.
+ * @return None (void function).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void s21_matrix_pool_stats(s21_matrix_pool_stats_t *stats);
+
+/*======================================================================
+    BATCHED SMALL MATRICES
+======================================================================*/
+
+/**
+ * @brief Computes the determinants of `count` square matrices of order
+ * `n` at once.
+ * @param n Order of every matrix, `2 <= n <= 4`.
+ * @param count Number of matrices.
+ * @param A Matrices in structure-of-arrays layout: element `(i, j)` of
+ * matrix `k` is `A[(i * n + j) * count + k]`.
+ * @param result Array of `count` determinants.
+ * @return Error code: `0` (OK), `1` (invalid order, count or pointer).
+ * @note Eight matrices are processed per step, one per vector lane, with
+ * the same closed forms as `s21_determinant`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_batch_determinant(int n, int count, const double *A, double *result);
+
+/**
+ * @brief Inverts `count` square matrices of order `n` at once.
+ * @param n Order of every matrix, `2 <= n <= 4`.
+ * @param count Number of matrices.
+ * @param A Matrices in the layout of `s21_batch_determinant`.
+ * @param result Inverses in the same layout; may be `A` itself.
+ * @param status Optional array of `count` per-matrix error codes, or `NULL`.
+ * @return Error code: `0` (OK), `1` (invalid order, count or pointer), `2`
+ * (at least one matrix is singular).
+ * @note The inverses of singular matrices are filled with NaN and flagged
+ * with `2` in `status`; all other matrices are still inverted.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_batch_inverse(int n, int count, const double *A, double *result,
+                      int *status);
+
+/**
+ * @brief Multiplies `count` pairs of square matrices of order `n` at once.
+ * @param n Order of every matrix, `2 <= n <= 4`.
+ * @param count Number of products.
+ * @param A Left factors in the layout of `s21_batch_determinant`.
+ * @param B Right factors in the same layout.
+ * @param result Products `A[k] * B[k]` in the same layout; may be `A` or
+ * `B`.
+ * @return Error code: `0` (OK), `1` (invalid order, count or pointer).
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_batch_mult(int n, int count, const double *A, const double *B,
+                   double *result);
+
+/*======================================================================
+    RUNTIME CONFIGURATION
+======================================================================*/
+
+/**
+ * @brief Forces the instruction set used by the computational kernels.
+ * @param isa One of `S21_ISA_AUTO`, `S21_ISA_SCALAR`, `S21_ISA_AVX2`,
+ * `S21_ISA_AVX512`.
+ * @return Error code: `0` (OK), `2` (unknown level or not supported by the
+ * CPU; the active level is left unchanged).
+ * @note The level is detected with CPUID when the library is loaded; the
+ * `S21_ISA` environment variable (`scalar`, `avx2`, `avx512`) overrides the
+ * detection. Call this before starting threads that use the library.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_set_isa(int isa);
+
+/**
+ * @brief Returns the instruction set used by the computational kernels.
+ * @return One of `S21_ISA_SCALAR`, `S21_ISA_AVX2`, `S21_ISA_AVX512`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_get_isa(void);
+
+/**
+ * @brief Selects how `s21_create_matrix` and the operations that create
+ * result matrices lay out new matrices.
+ * @param mode `S21_ALLOC_PACKED` (default) or `S21_ALLOC_ALIGNED` (see
+ * `s21_create_matrix_aligned`).
+ * @return Error code: `0` (OK), `2` (unknown mode).
+ * @note Aligned matrices are not kept by the recycling pool.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_set_alloc_mode(int mode);
+
+/**
+ * @brief Returns the allocation mode of new matrices.
+ * @return `S21_ALLOC_PACKED` or `S21_ALLOC_ALIGNED`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_get_alloc_mode(void);
+
+/**
+ * @brief Enables or disables automatic Cholesky for symmetric matrices.
+ * @param enabled `1` (the default) or `0`.
+ * @return Error code: `0` (OK), `2` (value other than `0` or `1`).
+ * @note When enabled, `s21_determinant`, `s21_inverse_matrix` and `s21_solve`
+ * check inputs of order 32 and above for exact symmetry and a positive
+ * diagonal in `O(n^2)` and try a Cholesky factorization first, falling back
+ * to LU when it breaks down.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_set_spd_detection(int enabled);
+
+/**
+ * @brief Returns whether automatic Cholesky for symmetric matrices is on.
+ * @return `1` or `0`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_get_spd_detection(void);
+
+/**
+ * @brief Sets the number of threads used by parallel kernels.
+ * @param threads Thread count including the caller; `0` restores the default
+ * (`S21_NUM_THREADS` environment variable, otherwise the number of online
+ * CPUs).
+ * @return Error code: `0` (OK), `2` (negative count).
+ * @note Worker threads are created lazily on the first large product and then
+ * kept alive; this call joins the current workers, so it must not race with
+ * running operations.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_set_num_threads(int threads);
+
+/**
+ * @brief Returns the number of threads used by parallel kernels.
+ * @return Thread count including the caller.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_get_num_threads(void);
+
+/**
+ * @brief Sets the size from which matrix products are split across threads.
+ * @param min_ops Minimum number of multiply-adds (`rows * inner * columns`);
+ * smaller products stay on the calling thread.
+ * @return Error code: `0` (OK), `2` (negative threshold).
+ * @note The default is `128 * 128 * 128`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_set_parallel_threshold(long long min_ops);
+
+/**
+ * @brief Sets the size from which `s21_mult_matrix` and
+ * `s21_mult_matrix_into` switch to Strassen-Winograd.
+ * @param min_order Minimum of every dimension of the product; `0` disables
+ * the switch.
+ * @return Error code: `0` (OK), `2` (negative order).
+ * @note Off by default, because the result is less accurate than the
+ * classical product; see `s21_mult_matrix_strassen`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_set_strassen_threshold(int min_order);
+
+/**
+ * @brief Returns the size from which products switch to Strassen-Winograd.
+ * @return Current threshold, `0` when disabled.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_get_strassen_threshold(void);
+
+/**
+ * @brief Sets the order below which Strassen-Winograd stops recursing.
+ * @param min_order Smallest block order handed to the blocked product; a
+ * level is split while every dimension is at least twice this.
+ * @return Error code: `0` (OK), `2` (order below 1).
+ * @note The default of 768 is where one more level stopped paying off on
+ * the development machine; `bench_strassen [max_size [cutover]]` times
+ * other values on the target.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_set_strassen_cutover(int min_order);
+
+/**
+ * @brief Returns the order below which Strassen-Winograd stops recursing.
+ * @return Current cutover.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int s21_get_strassen_cutover(void);
+
 #endif
\ No newline at end of file
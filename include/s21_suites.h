@@ -14,5 +14,18 @@ Suite *s21_transpose_suite(void);
 Suite *s21_calc_complements_suite(void);
 Suite *s21_determinant_suite(void);
 Suite *s21_inverse_matrix_suite(void);
+Suite *s21_isa_suite(void);
+Suite *s21_parallel_suite(void);
+Suite *s21_arena_suite(void);
+Suite *s21_matrix_pool_suite(void);
+Suite *s21_view_suite(void);
+Suite *s21_batch_suite(void);
+Suite *s21_solve_suite(void);
+Suite *s21_cholesky_suite(void);
+Suite *s21_strassen_suite(void);
+Suite *s21_mult_chain_suite(void);
+Suite *s21_sparse_suite(void);
+Suite *s21_band_suite(void);
+Suite *s21_packed_suite(void);
 
 #endif
\ No newline at end of file
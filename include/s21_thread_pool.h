@@ -0,0 +1,60 @@
+#ifndef S21_THREAD_POOL_H
+#define S21_THREAD_POOL_H
+
+#include <stddef.h>
+
+/**
+ * @brief Body of a parallel loop.
+ * @param ctx Caller context shared by all tasks.
+ * @param task Index of the task, `0 <= task < tasks`.
+ * @param worker Index of the executing thread, `0` is the calling thread.
+ */
+typedef void (*pool_task_t)(void *ctx, int task, int worker);
+
+/**
+ * @brief Runs `tasks` independent tasks on the library worker pool.
+ * @param tasks Number of tasks.
+ * @param fn Task body.
+ * @param ctx Context passed to every task.
+ * @return Number of threads that took part, including the caller, or `0` if
+ * nothing was run: the pool is configured for one thread, is busy with another
+ * caller or could not start. The caller then does the work serially.
+ * @note Workers are created on first use and kept alive; the calling thread
+ * executes tasks too, as worker `0`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _pool_run(int tasks, pool_task_t fn, void *ctx);
+
+/**
+ * @brief Returns a scratch buffer owned by a pool worker.
+ * @param worker Worker index received by a task (`0` for the caller).
+ * @param size Required size in bytes.
+ * @return 64-byte aligned buffer of at least `size` bytes or `NULL` when
+ * allocation fails. Valid until the next call with the same worker index.
+ * @note Buffers grow on demand and are reused between calls, so steady-state
+ * parallel runs do not allocate.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void *_pool_scratch(int worker, size_t size);
+
+/**
+ * @brief Number of threads the pool runs with, including the caller.
+ * @return Configured count, or the `S21_NUM_THREADS` environment variable,
+ * or the number of online CPUs.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+int _pool_size(void);
+
+/**
+ * @brief Minimum number of multiply-adds for a product to be split across
+ * threads.
+ * @return Current threshold.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+long long _pool_threshold(void);
+
+#endif
@@ -21,10 +21,34 @@ void _alloc_matrix(matrix_t *m, int rows, int cols);
  * @param m Pointer to the matrix structure to free.
  * @return None (void function).
  * @note Used only in tests to release allocated memory.
+ *       Works for both per-row test matrices and single-block matrices
+ *       returned by the library.
  *       After the call, rows, cols, and pointer are reset to zero/NULL.
  * @author s21: tyananai
  * @date September 21, 2025
  */
 void _free_matrix(matrix_t *m);
 
+/**
+ * @brief Fills a matrix with smooth, sign-changing values (test helper).
+ * @param m Pointer to an allocated matrix.
+ * @param shift Phase that makes matrices filled with different values differ.
+ * @return None (void function).
+ * @note Element (i, j) is `sin(0.37 * i + 1.3 * j + shift)`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void _fill_matrix(matrix_t *m, double shift);
+
+/**
+ * @brief Fills right-hand sides for the solver tests (test helper).
+ * @param m Pointer to an allocated matrix, one right-hand side per column.
+ * @param shift Phase that makes right-hand sides of different calls differ.
+ * @return None (void function).
+ * @note Element (i, j) is `cos(0.7 * i - 1.3 * j + shift)`.
+ * @author s21: tyananai
+ * @date October 18, 2026
+ */
+void _fill_rhs(matrix_t *m, double shift);
+
 #endif
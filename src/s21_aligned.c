@@ -0,0 +1,120 @@
+#include <stdatomic.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../include/s21_helpers.h"
+#include "../include/s21_matrix.h"
+
+/* Tag stored in the header line of every aligned block, mixed with the
+   block address so that a copied header does not match. */
+#define S21_ALIGNED_MAGIC 0x53323141474E4544ull
+
+static atomic_size_t _live = 0;
+static atomic_int _mode = S21_ALLOC_PACKED;
+
+/* Layout: row pointers padded to a cache line, one header line holding the
+   tag, then the rows. The header keeps row 0 a full line past the pointers,
+   which a packed matrix never is. */
+static uint64_t *_header(double **block, int rows) {
+  uintptr_t end = (uintptr_t)(block + rows);
+  uintptr_t mask = (uintptr_t)S21_ALIGNMENT - 1u;
+  return (uint64_t *)((end + mask) & ~mask);
+}
+
+static double *_data(double **block, int rows) {
+  return (double *)((char *)_header(block, rows) + S21_ALIGNMENT);
+}
+
+static uint64_t _tag(double **block) {
+  return S21_ALIGNED_MAGIC ^ (uint64_t)(uintptr_t)block;
+}
+
+/* Row length in doubles: whole cache lines, plus one more when the row size
+   is a multiple of 512 bytes, so that rows do not alias in cache sets. */
+static size_t _leading_dimension(int columns) {
+  size_t line = S21_ALIGNMENT / sizeof(double);
+  size_t stride = ((size_t)columns + line - 1) / line * line;
+  if (stride % (8 * line) == 0) {
+    stride += line;
+  }
+  return stride;
+}
+
+int _aligned_create(int rows, int columns, matrix_t *result) {
+  int error = S21_OK;
+
+  size_t stride = _leading_dimension(columns);
+  size_t head = ((size_t)rows * sizeof(double *) + S21_ALIGNMENT - 1) /
+                    S21_ALIGNMENT * S21_ALIGNMENT +
+                S21_ALIGNMENT;
+
+  if (stride > (SIZE_MAX - head) / sizeof(double) / (size_t)rows) {
+    error = S21_INCORRECT_MATRIX;
+  }
+
+  double **block = NULL;
+  if (!error) {
+    size_t bytes = head + (size_t)rows * stride * sizeof(double);
+    block = (double **)aligned_alloc(S21_ALIGNMENT, bytes);
+    if (block == NULL) {
+      error = S21_INCORRECT_MATRIX;
+    } else {
+      memset(block, 0, bytes);
+      *_header(block, rows) = _tag(block);
+      atomic_fetch_add_explicit(&_live, 1, memory_order_relaxed);
+    }
+  }
+
+  if (!error) {
+    double *data = _data(block, rows);
+    for (int i = 0; i < rows; i++) {
+      block[i] = data + (size_t)i * stride;
+    }
+    result->matrix = block;
+    result->rows = rows;
+    result->columns = columns;
+  } else {
+    result->matrix = NULL;
+    result->rows = 0;
+    result->columns = 0;
+  }
+
+  return error;
+}
+
+int _is_aligned_block(const matrix_t *A) {
+  return atomic_load_explicit(&_live, memory_order_relaxed) > 0 &&
+         (uintptr_t)A->matrix % S21_ALIGNMENT == 0 && A->rows > 0 &&
+         A->matrix[0] == _data(A->matrix, A->rows) &&
+         *_header(A->matrix, A->rows) == _tag(A->matrix);
+}
+
+void _aligned_free(double **block, int rows) {
+  *_header(block, rows) = 0;
+  atomic_fetch_sub_explicit(&_live, 1, memory_order_relaxed);
+  free(block);
+}
+
+int s21_create_matrix_aligned(int rows, int columns, matrix_t *result) {
+  if (result == NULL || rows <= 0 || columns <= 0) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  return _aligned_create(rows, columns, result);
+}
+
+int s21_set_alloc_mode(int mode) {
+  int error = S21_OK;
+
+  if (mode != S21_ALLOC_PACKED && mode != S21_ALLOC_ALIGNED) {
+    error = S21_CALC_ERROR;
+  } else {
+    atomic_store(&_mode, mode);
+  }
+
+  return error;
+}
+
+int s21_get_alloc_mode(void) {
+  return atomic_load_explicit(&_mode, memory_order_relaxed);
+}
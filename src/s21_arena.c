@@ -0,0 +1,225 @@
+#include <pthread.h>
+#include <stdint.h>
+
+#include "../include/s21_helpers.h"
+#include "../include/s21_matrix.h"
+
+#define S21_ARENA_ALIGN 64u
+#define S21_ARENA_MIN_CHUNK ((size_t)64 * 1024)
+
+struct s21_arena_chunk {
+  struct s21_arena_chunk *next;
+  unsigned char *data;
+  size_t size;
+  int owned;
+};
+
+static size_t _align_up(size_t value) {
+  return (value + S21_ARENA_ALIGN - 1u) & ~(size_t)(S21_ARENA_ALIGN - 1u);
+}
+
+static size_t _align_offset(const struct s21_arena_chunk *chunk,
+                            size_t used) {
+  uintptr_t at = (uintptr_t)(chunk->data + used);
+  return used + (size_t)(_align_up(at) - at);
+}
+
+static struct s21_arena_chunk *_chunk_new(size_t size) {
+  size_t bytes = sizeof(struct s21_arena_chunk) + size;
+  struct s21_arena_chunk *chunk = (struct s21_arena_chunk *)malloc(bytes);
+  if (chunk != NULL) {
+    chunk->next = NULL;
+    chunk->data = (unsigned char *)(chunk + 1);
+    chunk->size = size;
+    chunk->owned = 1;
+  }
+  return chunk;
+}
+
+int s21_arena_init(s21_arena_t *arena, void *buffer, size_t size) {
+  if (arena == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+  struct s21_arena_chunk *chunk = NULL;
+
+  if (buffer != NULL) {
+    if (size < sizeof(struct s21_arena_chunk) + S21_ARENA_ALIGN) {
+      error = S21_INCORRECT_MATRIX;
+    } else {
+      chunk = (struct s21_arena_chunk *)buffer;
+      chunk->next = NULL;
+      chunk->data = (unsigned char *)(chunk + 1);
+      chunk->size = size - sizeof(struct s21_arena_chunk);
+      chunk->owned = 0;
+    }
+  } else if (size > 0) {
+    chunk = _chunk_new(size + S21_ARENA_ALIGN);
+    if (chunk == NULL) {
+      error = S21_INCORRECT_MATRIX;
+    }
+  }
+
+  arena->head = error ? NULL : chunk;
+  arena->current = arena->head;
+  arena->used = 0;
+
+  return error;
+}
+
+void *s21_arena_alloc(s21_arena_t *arena, size_t size) {
+  if (arena == NULL) {
+    return NULL;
+  }
+
+  size = _align_up(size == 0 ? 1 : size);
+  void *result = NULL;
+
+  while (result == NULL) {
+    struct s21_arena_chunk *chunk = arena->current;
+    size_t offset = chunk != NULL ? _align_offset(chunk, arena->used) : 0;
+
+    if (chunk != NULL && offset <= chunk->size &&
+        size <= chunk->size - offset) {
+      result = chunk->data + offset;
+      arena->used = offset + size;
+    } else if (chunk != NULL && chunk->next != NULL &&
+               chunk->next->size >= size + S21_ARENA_ALIGN) {
+      arena->current = chunk->next;
+      arena->used = 0;
+    } else {
+      size_t grow = chunk != NULL ? 2 * chunk->size : S21_ARENA_MIN_CHUNK;
+      if (grow < size + S21_ARENA_ALIGN) {
+        grow = size + S21_ARENA_ALIGN;
+      }
+      struct s21_arena_chunk *fresh = _chunk_new(grow);
+      if (fresh == NULL) {
+        break;
+      }
+      if (chunk == NULL) {
+        fresh->next = arena->head;
+        arena->head = fresh;
+      } else {
+        fresh->next = chunk->next;
+        chunk->next = fresh;
+      }
+      arena->current = fresh;
+      arena->used = 0;
+    }
+  }
+
+  return result;
+}
+
+s21_arena_mark_t s21_arena_mark(const s21_arena_t *arena) {
+  s21_arena_mark_t mark = {NULL, 0};
+  if (arena != NULL && (arena->current != arena->head || arena->used > 0)) {
+    mark.chunk = arena->current;
+    mark.used = arena->used;
+  }
+  return mark;
+}
+
+/* Keeps only the largest chunk of an empty arena. Chunks grow by doubling,
+   so after a few calls the arena holds one chunk covering the high-water
+   mark of the workload and repeated calls stop touching the heap. Safe
+   because a mark taken on an empty arena does not name a chunk. */
+static void _keep_largest(s21_arena_t *arena) {
+  struct s21_arena_chunk *largest = arena->head;
+  for (struct s21_arena_chunk *c = arena->head; c != NULL; c = c->next) {
+    largest = c->size > largest->size ? c : largest;
+  }
+  struct s21_arena_chunk *chunk = arena->head;
+  while (chunk != NULL) {
+    struct s21_arena_chunk *next = chunk->next;
+    if (chunk != largest) {
+      free(chunk);
+    }
+    chunk = next;
+  }
+  largest->next = NULL;
+  arena->head = largest;
+  arena->current = largest;
+  arena->used = 0;
+}
+
+static _Thread_local s21_arena_t *_default = NULL;
+
+void s21_arena_release(s21_arena_t *arena, s21_arena_mark_t mark) {
+  if (arena != NULL) {
+    arena->current = mark.chunk != NULL ? mark.chunk : arena->head;
+    arena->used = mark.chunk != NULL ? mark.used : 0;
+    if (arena == _default && mark.chunk == NULL && arena->head != NULL &&
+        arena->head->next != NULL) {
+      _keep_largest(arena);
+    }
+  }
+}
+
+void s21_arena_reset(s21_arena_t *arena) {
+  if (arena != NULL) {
+    arena->current = arena->head;
+    arena->used = 0;
+  }
+}
+
+void s21_arena_destroy(s21_arena_t *arena) {
+  if (arena != NULL) {
+    struct s21_arena_chunk *chunk = arena->head;
+    while (chunk != NULL) {
+      struct s21_arena_chunk *next = chunk->next;
+      if (chunk->owned) {
+        free(chunk);
+      }
+      chunk = next;
+    }
+    arena->head = NULL;
+    arena->current = NULL;
+    arena->used = 0;
+  }
+}
+
+static _Thread_local s21_arena_t *_bound = NULL;
+static pthread_key_t _default_key;
+static pthread_once_t _default_once = PTHREAD_ONCE_INIT;
+
+static void _default_free(void *arena) {
+  s21_arena_destroy((s21_arena_t *)arena);
+  free(arena);
+}
+
+static void _default_key_create(void) {
+  pthread_key_create(&_default_key, _default_free);
+}
+
+s21_arena_t *s21_set_arena(s21_arena_t *arena) {
+  s21_arena_t *previous = _bound;
+  _bound = arena;
+  return previous;
+}
+
+s21_arena_t *_arena(void) {
+  s21_arena_t *arena = _bound;
+
+  if (arena == NULL) {
+    pthread_once(&_default_once, _default_key_create);
+    arena = (s21_arena_t *)pthread_getspecific(_default_key);
+    if (arena == NULL) {
+      arena = (s21_arena_t *)calloc(1, sizeof(s21_arena_t));
+      if (arena != NULL && pthread_setspecific(_default_key, arena) != 0) {
+        free(arena);
+        arena = NULL;
+      }
+      _default = arena;
+    }
+  }
+
+  return arena;
+}
+
+void s21_arena_trim(void) {
+  if (_default != NULL) {
+    s21_arena_destroy(_default);
+  }
+}
@@ -0,0 +1,215 @@
+#include <string.h>
+
+#include "../include/s21_helpers.h"
+#include "../include/s21_kernels.h"
+#include "../include/s21_thread_pool.h"
+
+static int _shape_invalid(int n, int kl, int ku) {
+  return n < 1 || kl < 0 || ku < 0 || kl >= n || ku >= n;
+}
+
+int _band_invalid(const s21_band_t *A) {
+  return A == NULL || _shape_invalid(A->n, A->kl, A->ku) || A->data == NULL;
+}
+
+static int _width(const s21_band_t *A) { return A->kl + A->ku + 1; }
+
+static int _in_band(const s21_band_t *A, int row, int column) {
+  return column >= row - A->kl && column <= row + A->ku;
+}
+
+static double *_element(const s21_band_t *A, int row, int column) {
+  return A->data + (size_t)row * _width(A) + (column - row + A->kl);
+}
+
+int s21_band_create(int n, int kl, int ku, s21_band_t *result) {
+  if (_shape_invalid(n, kl, ku) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  double *data = (double *)calloc((size_t)n * (kl + ku + 1), sizeof(double));
+  if (data == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  result->n = n;
+  result->kl = kl;
+  result->ku = ku;
+  result->data = data;
+  return S21_OK;
+}
+
+int s21_band_from_dense(matrix_t *A, int kl, int ku, s21_band_t *result) {
+  if (_validation_matrix(A) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (A->rows != A->columns) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    error = s21_band_create(A->rows, kl, ku, result);
+  }
+
+  for (int i = 0; !error && i < A->rows; i++) {
+    int first = i - kl > 0 ? i - kl : 0;
+    int last = i + ku < A->rows - 1 ? i + ku : A->rows - 1;
+    memcpy(_element(result, i, first), A->matrix[i] + first,
+           (size_t)(last - first + 1) * sizeof(double));
+  }
+
+  return error;
+}
+
+int s21_band_to_dense(const s21_band_t *A, matrix_t *result) {
+  if (_band_invalid(A) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = _create_matrix(A->n, A->n, result, 1);
+
+  for (int i = 0; !error && i < A->n; i++) {
+    int first = i - A->kl > 0 ? i - A->kl : 0;
+    int last = i + A->ku < A->n - 1 ? i + A->ku : A->n - 1;
+    memcpy(result->matrix[i] + first, _element(A, i, first),
+           (size_t)(last - first + 1) * sizeof(double));
+  }
+
+  return error;
+}
+
+int s21_band_get(const s21_band_t *A, int row, int column, double *value) {
+  if (_band_invalid(A) || value == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  if (row < 0 || row >= A->n || column < 0 || column >= A->n) {
+    return S21_CALC_ERROR;
+  }
+
+  *value = _in_band(A, row, column) ? *_element(A, row, column) : 0.0;
+
+  return S21_OK;
+}
+
+int s21_band_set(s21_band_t *A, int row, int column, double value) {
+  if (_band_invalid(A)) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  if (row < 0 || row >= A->n || column < 0 || column >= A->n ||
+      !_in_band(A, row, column)) {
+    return S21_CALC_ERROR;
+  }
+
+  *_element(A, row, column) = value;
+
+  return S21_OK;
+}
+
+/* C = A * B one row of C at a time: a dot product with x when B and C are
+   single contiguous columns, otherwise a sum of scaled rows of B. */
+typedef struct band_mult_struct {
+  const kernels_t *kern;
+  const s21_band_t *a;
+  double *const *b;
+  const double *x;
+  double *y;
+  double **c;
+  int k;
+  int chunk;
+} band_mult_t;
+
+static void _band_rows(const band_mult_t *g, int i0, int i1) {
+  const s21_band_t *a = g->a;
+  for (int i = i0; i < i1; i++) {
+    int first = i - a->kl > 0 ? i - a->kl : 0;
+    int last = i + a->ku < a->n - 1 ? i + a->ku : a->n - 1;
+    const double *row = _element(a, i, first);
+    int length = last - first + 1;
+    if (g->x != NULL) {
+      g->y[i] = _dot(row, g->x + first, length);
+      continue;
+    }
+
+    double *c = g->c[i];
+    int p = 0;
+    for (; p + S21_KERNEL_GEMV_ROWS <= length; p += S21_KERNEL_GEMV_ROWS) {
+      g->kern->axpy4((const double *const *)(g->b + first + p), row + p, c,
+                     g->k);
+    }
+    for (; p < length; p++) {
+      const double *b = g->b[first + p];
+      for (int j = 0; j < g->k; j++) {
+        c[j] += row[p] * b[j];
+      }
+    }
+  }
+}
+
+static void _band_task(void *ctx, int task, int worker) {
+  (void)worker;
+  const band_mult_t *g = (const band_mult_t *)ctx;
+  int first = task * g->chunk;
+  int last = first + g->chunk < g->a->n ? first + g->chunk : g->a->n;
+  _band_rows(g, first, last);
+}
+
+static int _band_parallel(band_mult_t *g) {
+  int threads = _pool_size();
+  int n = g->a->n;
+  int done = 0;
+
+  if (threads > 1 && n >= 2 &&
+      (long long)n * _width(g->a) * g->k >= _pool_threshold()) {
+    int tasks = 4 * threads < n ? 4 * threads : n;
+    g->chunk = (n + tasks - 1) / tasks;
+    tasks = (n + g->chunk - 1) / g->chunk;
+    done = _pool_run(tasks, _band_task, g) > 0;
+  }
+
+  return done;
+}
+
+int s21_band_mult_dense(const s21_band_t *A, matrix_t *B, matrix_t *result) {
+  if (_band_invalid(A) || _validation_matrix(B) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (A->n != B->rows) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    error = _create_matrix(A->n, B->columns, result, 1);
+  }
+
+  if (!error) {
+    band_mult_t g = {_kernels(), A, B->matrix, NULL, NULL, result->matrix,
+                     B->columns, 0};
+    if (B->columns == 1 && _is_dense(B) && _is_dense(result)) {
+      g.x = B->matrix[0];
+      g.y = result->matrix[0];
+    }
+    if (!_band_parallel(&g)) {
+      _band_rows(&g, 0, A->n);
+    }
+  }
+
+  return error;
+}
+
+void s21_band_free(s21_band_t *A) {
+  if (A != NULL) {
+    free(A->data);
+    A->data = NULL;
+    A->n = 0;
+    A->kl = 0;
+    A->ku = 0;
+  }
+}
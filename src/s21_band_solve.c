@@ -0,0 +1,304 @@
+#include <string.h>
+
+#include "../include/s21_helpers.h"
+#include "../include/s21_matrix.h"
+
+static int _band_lu_width(int kl, int ku) { return 2 * kl + ku + 1; }
+
+/* Offset of element (i, j) in a band LU buffer of row width w, whose rows
+   hold columns i - kl .. i + kl + ku. */
+static size_t _at(int w, int kl, int i, int j) {
+  return (size_t)i * w + j - i + kl;
+}
+
+/* Copies the band of A into a zeroed factor buffer. */
+static void _band_to_factor(const s21_band_t *A, double *lu) {
+  int w = _band_lu_width(A->kl, A->ku);
+  int band = A->kl + A->ku + 1;
+  memset(lu, 0, (size_t)A->n * w * sizeof(double));
+  for (int i = 0; i < A->n; i++) {
+    memcpy(lu + (size_t)i * w, A->data + (size_t)i * band,
+           (size_t)band * sizeof(double));
+  }
+}
+
+/* Gaussian elimination with partial pivoting restricted to the band. Row k
+   is swapped with the pivot row from column k on only, so the multipliers
+   of earlier steps stay where they were computed and the interchanges must
+   be replayed in order while solving. */
+static void _band_decompose(double *lu, int n, int kl, int ku, int *pivots) {
+  int w = _band_lu_width(kl, ku);
+  for (int k = 0; k < n; k++) {
+    int last_row = k + kl < n - 1 ? k + kl : n - 1;
+    int length = (k + kl + ku < n - 1 ? k + kl + ku : n - 1) - k + 1;
+
+    int p = k;
+    double max = fabs(lu[_at(w, kl, k, k)]);
+    for (int i = k + 1; i <= last_row; i++) {
+      double v = fabs(lu[_at(w, kl, i, k)]);
+      if (v > max) {
+        max = v;
+        p = i;
+      }
+    }
+
+    double *row_k = lu + _at(w, kl, k, k);
+    pivots[k] = p;
+    if (p != k) {
+      double *row_p = lu + _at(w, kl, p, k);
+      for (int j = 0; j < length; j++) {
+        double tmp = row_k[j];
+        row_k[j] = row_p[j];
+        row_p[j] = tmp;
+      }
+    }
+
+    double pivot = row_k[0];
+    for (int i = k + 1; pivot != 0.0 && i <= last_row; i++) {
+      double *row_i = lu + _at(w, kl, i, k);
+      double l = row_i[0] / pivot;
+      row_i[0] = l;
+      for (int j = 1; j < length; j++) {
+        row_i[j] -= l * row_k[j];
+      }
+    }
+  }
+}
+
+static int _band_lu_singular(const double *lu, int n, int kl, int ku) {
+  return !_pivots_well_conditioned(lu + kl, n, _band_lu_width(kl, ku), 0);
+}
+
+/* Overwrites X, which holds the right-hand side, with the solution. */
+static void _band_substitute(const double *lu, int n, int kl, int ku,
+                             const int *pivots, double **x, int nrhs) {
+  int w = _band_lu_width(kl, ku);
+  for (int k = 0; k < n; k++) {
+    double *row_k = x[k];
+    if (pivots[k] != k) {
+      double *row_p = x[pivots[k]];
+      for (int j = 0; j < nrhs; j++) {
+        double tmp = row_k[j];
+        row_k[j] = row_p[j];
+        row_p[j] = tmp;
+      }
+    }
+    int last_row = k + kl < n - 1 ? k + kl : n - 1;
+    for (int i = k + 1; i <= last_row; i++) {
+      double l = lu[_at(w, kl, i, k)];
+      double *row_i = x[i];
+      for (int j = 0; j < nrhs; j++) {
+        row_i[j] -= l * row_k[j];
+      }
+    }
+  }
+
+  for (int i = n - 1; i >= 0; i--) {
+    const double *u = lu + _at(w, kl, i, i);
+    int length = (i + kl + ku < n - 1 ? i + kl + ku : n - 1) - i + 1;
+    double *row_i = x[i];
+    for (int k = 1; k < length; k++) {
+      double f = u[k];
+      const double *row_k = x[i + k];
+      for (int j = 0; j < nrhs; j++) {
+        row_i[j] -= f * row_k[j];
+      }
+    }
+    for (int j = 0; j < nrhs; j++) {
+      row_i[j] /= u[0];
+    }
+  }
+}
+
+static int _band_lu_invalid(const s21_band_lu_t *lu) {
+  return lu == NULL || lu->n < 1 || lu->kl < 0 || lu->ku < 0 ||
+         lu->lu == NULL || lu->pivots == NULL;
+}
+
+int s21_band_lu_factor(const s21_band_t *A, s21_band_lu_t *lu) {
+  if (_band_invalid(A) || lu == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int n = A->n;
+  size_t doubles = (size_t)n * _band_lu_width(A->kl, A->ku);
+  double *factors =
+      (double *)malloc(doubles * sizeof(double) + (size_t)n * sizeof(int));
+  if (factors == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  lu->n = n;
+  lu->kl = A->kl;
+  lu->ku = A->ku;
+  lu->lu = factors;
+  lu->pivots = (int *)(factors + doubles);
+  _band_to_factor(A, lu->lu);
+  _band_decompose(lu->lu, n, lu->kl, lu->ku, lu->pivots);
+
+  return S21_OK;
+}
+
+int s21_band_lu_solve(const s21_band_lu_t *lu, matrix_t *B,
+                      matrix_t *result) {
+  if (_band_lu_invalid(lu) || _validation_matrix(B) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (B->rows != lu->n || _band_lu_singular(lu->lu, lu->n, lu->kl, lu->ku)) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    error = _create_matrix(B->rows, B->columns, result, 0);
+  }
+
+  if (!error) {
+    _copy_rows(B, result);
+    _band_substitute(lu->lu, lu->n, lu->kl, lu->ku, lu->pivots,
+                     result->matrix, result->columns);
+  }
+
+  return error;
+}
+
+void s21_band_lu_free(s21_band_lu_t *lu) {
+  if (lu != NULL) {
+    free(lu->lu);
+    lu->lu = NULL;
+    lu->pivots = NULL;
+    lu->n = 0;
+    lu->kl = 0;
+    lu->ku = 0;
+  }
+}
+
+int s21_band_solve(const s21_band_t *A, matrix_t *B, matrix_t *result) {
+  if (_band_invalid(A) || _validation_matrix(B) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+  int n = A->n;
+
+  if (B->rows != n) {
+    error = S21_CALC_ERROR;
+  }
+
+  s21_arena_t *arena = _arena();
+  s21_arena_mark_t mark = s21_arena_mark(arena);
+  size_t doubles = (size_t)n * _band_lu_width(A->kl, A->ku);
+  double *lu = NULL;
+  int *pivots = NULL;
+
+  if (!error) {
+    lu = (double *)s21_arena_alloc(
+        arena, doubles * sizeof(double) + (size_t)n * sizeof(int));
+    if (lu == NULL) {
+      error = S21_INCORRECT_MATRIX;
+    }
+  }
+
+  if (!error) {
+    pivots = (int *)(lu + doubles);
+    _band_to_factor(A, lu);
+    _band_decompose(lu, n, A->kl, A->ku, pivots);
+    if (_band_lu_singular(lu, n, A->kl, A->ku)) {
+      error = S21_CALC_ERROR;
+    }
+  }
+
+  if (!error) {
+    error = _create_matrix(n, B->columns, result, 0);
+  }
+
+  if (!error) {
+    _copy_rows(B, result);
+    _band_substitute(lu, n, A->kl, A->ku, pivots, result->matrix,
+                     result->columns);
+  }
+
+  s21_arena_release(arena, mark);
+
+  return error;
+}
+
+/* Forward sweep of the Thomas algorithm: eliminates the subdiagonal,
+   leaving the pivots in `pivot` and the scaled superdiagonal in `upper`.
+   Returns S21_CALC_ERROR on a zero pivot. */
+static int _thomas_forward(const s21_band_t *A, double *pivot, double *upper,
+                           double **x, int nrhs) {
+  int w = A->kl + A->ku + 1;
+  int error = S21_OK;
+  for (int i = 0; !error && i < A->n; i++) {
+    const double *row = A->data + (size_t)i * w + A->kl;
+    double a = A->kl && i > 0 ? row[-1] : 0.0;
+    double c = A->ku && i < A->n - 1 ? row[1] : 0.0;
+    double m = row[0] - (i > 0 ? a * upper[i - 1] : 0.0);
+    if (m == 0.0) {
+      error = S21_CALC_ERROR;
+    } else {
+      pivot[i] = m;
+      upper[i] = c / m;
+      double *row_i = x[i];
+      for (int j = 0; j < nrhs; j++) {
+        double below = i > 0 ? a * x[i - 1][j] : 0.0;
+        row_i[j] = (row_i[j] - below) / m;
+      }
+    }
+  }
+  return error;
+}
+
+int s21_tridiagonal_solve(const s21_band_t *A, matrix_t *B,
+                          matrix_t *result) {
+  if (_band_invalid(A) || _validation_matrix(B) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+  int n = A->n;
+
+  if (A->kl > 1 || A->ku > 1 || B->rows != n) {
+    error = S21_CALC_ERROR;
+  }
+
+  s21_arena_t *arena = _arena();
+  s21_arena_mark_t mark = s21_arena_mark(arena);
+  double *pivot = NULL;
+
+  if (!error) {
+    pivot = (double *)s21_arena_alloc(arena, 2 * (size_t)n * sizeof(double));
+    if (pivot == NULL) {
+      error = S21_INCORRECT_MATRIX;
+    }
+  }
+
+  if (!error) {
+    error = _create_matrix(n, B->columns, result, 0);
+  }
+
+  if (!error) {
+    double *upper = pivot + n;
+    double **x = result->matrix;
+    _copy_rows(B, result);
+    error = _thomas_forward(A, pivot, upper, x, result->columns);
+    if (!error && !_pivots_well_conditioned(pivot, n, 1, 0)) {
+      error = S21_CALC_ERROR;
+    }
+    for (int i = n - 2; !error && i >= 0; i--) {
+      for (int j = 0; j < result->columns; j++) {
+        x[i][j] -= upper[i] * x[i + 1][j];
+      }
+    }
+    if (error) {
+      s21_remove_matrix(result);
+    }
+  }
+
+  s21_arena_release(arena, mark);
+
+  return error;
+}
@@ -1,6 +1,48 @@
 #include "../include/s21_helpers.h"
 #include "../include/s21_matrix.h"
 
+static void _complements_by_minors(const matrix_t *A, double *minor,
+                                   int *pivots, matrix_t *result) {
+  int m = A->rows - 1;
+  for (int i = 0; i < A->rows; i++) {
+    for (int j = 0; j < A->columns; j++) {
+      _minor_to_buffer(A, minor, i, j);
+      int sign = _lu_decompose(minor, m, pivots);
+      if ((i + j) % 2 != 0) {
+        sign = -sign;
+      }
+      result->matrix[i][j] = _lu_determinant(minor, m, sign);
+    }
+  }
+}
+
+static void _complements(const matrix_t *A, double *lu, int *pivots,
+                         matrix_t *result) {
+  int n = A->rows;
+
+  for (int i = 0; i < n; i++) {
+    for (int j = 0; j < n; j++) {
+      lu[(size_t)j * n + i] = A->matrix[i][j];
+    }
+  }
+  int sign = _lu_decompose(lu, n, pivots);
+
+  if (_well_conditioned(lu, n, 0)) {
+    double detA = _lu_determinant(lu, n, sign);
+    for (int i = 0; i < n; i++) {
+      result->matrix[i][i] = 1.0;
+    }
+    _lu_solve(lu, n, pivots, result->matrix, n);
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) {
+        result->matrix[i][j] *= detA;
+      }
+    }
+  } else {
+    _complements_by_minors(A, lu, pivots, result);
+  }
+}
+
 int s21_calc_complements(matrix_t *A, matrix_t *result) {
   if (_validation_matrix(A) || result == NULL) {
     return S21_INCORRECT_MATRIX;
@@ -16,22 +58,28 @@ int s21_calc_complements(matrix_t *A, matrix_t *result) {
     error = s21_create_matrix(A->rows, A->columns, result);
   }
 
-  if (A->rows == 1) {
-    if (!error) {
-      result->matrix[0][0] = 1.0;
-    }
-  } else {
-    for (int i = 0; i < A->rows && !error; i++) {
-      for (int j = 0; j < A->columns && !error; j++) {
-        double detA = 0.0;
-        matrix_t tmp = {NULL, 0, 0};
-        _crossing_out_matrix_element(A, &tmp, i, j);
-        error = s21_determinant(&tmp, &detA);
-        s21_remove_matrix(&tmp);
-        double sign = ((i + j) % 2 == 0 ? 1.0 : -1.0);
-        result->matrix[i][j] = sign * detA;
+  int n = A->rows;
+
+  if (!error && n <= S21_SMALL_MAX) {
+    double adj[S21_SMALL_MAX * S21_SMALL_MAX];
+    _adjugate_small(A->matrix, n, adj);
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) {
+        result->matrix[i][j] = adj[j * n + i];
       }
     }
+  } else if (!error) {
+    s21_arena_t *arena = _arena();
+    s21_arena_mark_t mark = s21_arena_mark(arena);
+    double *lu = (double *)s21_arena_alloc(
+        arena, (size_t)n * n * sizeof(double) + (size_t)n * sizeof(int));
+    if (lu == NULL) {
+      s21_remove_matrix(result);
+      error = S21_INCORRECT_MATRIX;
+    } else {
+      _complements(A, lu, (int *)(lu + (size_t)n * n), result);
+    }
+    s21_arena_release(arena, mark);
   }
 
   return error;
@@ -0,0 +1,343 @@
+#include <stdatomic.h>
+
+#include "../include/s21_helpers.h"
+#include "../include/s21_matrix.h"
+
+#define S21_CHOLESKY_BLOCK 96
+#define S21_CHOLESKY_UPDATE_ROWS 192
+#define S21_SPD_MIN_ORDER 32
+
+static atomic_int _spd_detection = 1;
+
+/* Factors columns k0 .. k0 + kb - 1 of every row from k0 down, assuming the
+   trailing update of all earlier panels has been applied. */
+static int _cholesky_panel(double *a, int n, int k0, int kb) {
+  for (int i = k0; i < n; i++) {
+    double *row_i = a + (size_t)i * n;
+    int last = i < k0 + kb - 1 ? i : k0 + kb - 1;
+    for (int j = k0; j <= last; j++) {
+      const double *row_j = a + (size_t)j * n;
+      double s = row_i[j] - _dot(row_i + k0, row_j + k0, j - k0);
+      if (j < i) {
+        row_i[j] = s / row_j[j];
+      } else if (s > 0.0) {
+        row_i[i] = sqrt(s);
+      } else {
+        return S21_CALC_ERROR;
+      }
+    }
+  }
+  return S21_OK;
+}
+
+/* A22 -= L21 * L21^T on the lower block triangle of the trailing matrix,
+   one block row at a time through the packed GEMM. */
+static int _cholesky_update(double *a, int n, int k0, int kb) {
+  int s = k0 + kb;
+  int m = n - s;
+  s21_arena_t *arena = _arena();
+  s21_arena_mark_t mark = s21_arena_mark(arena);
+  double **l_rows = (double **)s21_arena_alloc(arena, m * sizeof(double *));
+  double **c_rows = (double **)s21_arena_alloc(arena, m * sizeof(double *));
+  double **t_rows = (double **)s21_arena_alloc(arena, kb * sizeof(double *));
+  double *t = (double *)s21_arena_alloc(arena, (size_t)kb * m * sizeof(double));
+  int error = (l_rows == NULL || c_rows == NULL || t_rows == NULL || t == NULL)
+                  ? S21_INCORRECT_MATRIX
+                  : S21_OK;
+
+  if (!error) {
+    for (int r = 0; r < m; r++) {
+      l_rows[r] = a + (size_t)(s + r) * n + k0;
+      c_rows[r] = a + (size_t)(s + r) * n + s;
+      for (int p = 0; p < kb; p++) {
+        t[(size_t)p * m + r] = l_rows[r][p];
+      }
+    }
+    for (int p = 0; p < kb; p++) {
+      t_rows[p] = t + (size_t)p * m;
+    }
+  }
+
+  for (int r0 = 0; !error && r0 < m; r0 += S21_CHOLESKY_UPDATE_ROWS) {
+    int rows = m - r0 < S21_CHOLESKY_UPDATE_ROWS ? m - r0
+                                                 : S21_CHOLESKY_UPDATE_ROWS;
+    error = _gemm_scaled(rows, r0 + rows, kb, -1.0, l_rows + r0, t_rows, 1.0,
+                         c_rows + r0);
+  }
+
+  s21_arena_release(arena, mark);
+  return error;
+}
+
+int _cholesky_decompose(double *a, int n) {
+  int error = S21_OK;
+  for (int k0 = 0; !error && k0 < n; k0 += S21_CHOLESKY_BLOCK) {
+    int kb = n - k0 < S21_CHOLESKY_BLOCK ? n - k0 : S21_CHOLESKY_BLOCK;
+    error = _cholesky_panel(a, n, k0, kb);
+    if (!error && k0 + kb < n) {
+      error = _cholesky_update(a, n, k0, kb);
+    }
+  }
+  return error;
+}
+
+double _cholesky_determinant(const double *l, int n) {
+  int exponent = 0;
+  double mantissa = _diagonal_product(l, n, &exponent);
+  return ldexp(mantissa * mantissa, 2 * exponent);
+}
+
+double _cholesky_log_determinant(const double *l, int n) {
+  int exponent = 0;
+  double mantissa = _diagonal_product(l, n, &exponent);
+  return 2.0 * (log(mantissa) + exponent * log(2.0));
+}
+
+void _cholesky_solve(const double *l, int n, double **x, int nrhs) {
+  int blocked = _trsm_dense(l, n, 0, 0, 0, x, nrhs);
+  for (int i = 0; !blocked && i < n; i++) {
+    const double *l_i = l + (size_t)i * n;
+    double *row_i = x[i];
+    for (int k = 0; k < i; k++) {
+      double f = l_i[k];
+      const double *row_k = x[k];
+      for (int j = 0; j < nrhs; j++) {
+        row_i[j] -= f * row_k[j];
+      }
+    }
+    double d = l_i[i];
+    for (int j = 0; j < nrhs; j++) {
+      row_i[j] /= d;
+    }
+  }
+
+  blocked = _trsm_dense(l, n, 0, 1, 0, x, nrhs);
+  for (int i = n - 1; !blocked && i >= 0; i--) {
+    const double *l_i = l + (size_t)i * n;
+    double *row_i = x[i];
+    double d = l_i[i];
+    for (int j = 0; j < nrhs; j++) {
+      row_i[j] /= d;
+    }
+    for (int k = 0; k < i; k++) {
+      double f = l_i[k];
+      double *row_k = x[k];
+      for (int j = 0; j < nrhs; j++) {
+        row_k[j] -= f * row_i[j];
+      }
+    }
+  }
+}
+
+void _cholesky_solve_vector(const double *l, int n, double *x) {
+  for (int i = 0; i < n; i++) {
+    const double *l_i = l + (size_t)i * n;
+    x[i] = (x[i] - _dot(l_i, x, i)) / l_i[i];
+  }
+
+  for (int i = n - 1; i >= 0; i--) {
+    const double *l_i = l + (size_t)i * n;
+    double xi = x[i] / l_i[i];
+    x[i] = xi;
+    for (int k = 0; k < i; k++) {
+      x[k] -= l_i[k] * xi;
+    }
+  }
+}
+
+static int _is_spd_candidate(const matrix_t *A) {
+  int n = A->rows;
+  int candidate = 1;
+  for (int i = 0; candidate && i < n; i++) {
+    candidate = A->matrix[i][i] > 0.0;
+  }
+  for (int i = 1; candidate && i < n; i++) {
+    const double *row_i = A->matrix[i];
+    for (int j = 0; candidate && j < i; j++) {
+      candidate = row_i[j] == A->matrix[j][i];
+    }
+  }
+  return candidate;
+}
+
+int _spd_factor(const matrix_t *A, double *buffer) {
+  int factored = 0;
+  if (A->rows >= S21_SPD_MIN_ORDER &&
+      atomic_load_explicit(&_spd_detection, memory_order_relaxed) &&
+      _is_spd_candidate(A)) {
+    _copy_to_buffer(A, buffer);
+    factored = _cholesky_decompose(buffer, A->rows) == S21_OK;
+  }
+  return factored;
+}
+
+static int _cholesky_invalid(const s21_cholesky_t *factor) {
+  return factor == NULL || factor->n < 1 || factor->l == NULL;
+}
+
+static int _cholesky_singular(const s21_cholesky_t *factor) {
+  return !_well_conditioned(factor->l, factor->n, 1);
+}
+
+static void _substitute(const s21_cholesky_t *factor, matrix_t *X) {
+  if (X->columns == 1 && _is_dense(X)) {
+    _cholesky_solve_vector(factor->l, factor->n, X->matrix[0]);
+  } else {
+    _cholesky_solve(factor->l, factor->n, X->matrix, X->columns);
+  }
+}
+
+int s21_cholesky_factor(matrix_t *A, s21_cholesky_t *factor) {
+  if (_validation_matrix(A) || factor == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+  int n = A->rows;
+  double *l = NULL;
+
+  if (A->rows != A->columns) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    l = (double *)malloc((size_t)n * n * sizeof(double));
+    if (l == NULL) {
+      error = S21_INCORRECT_MATRIX;
+    }
+  }
+
+  if (!error) {
+    _copy_to_buffer(A, l);
+    error = _cholesky_decompose(l, n);
+    if (error) {
+      free(l);
+    }
+  }
+
+  if (!error) {
+    factor->n = n;
+    factor->l = l;
+  }
+
+  return error;
+}
+
+int s21_cholesky_solve(const s21_cholesky_t *factor, matrix_t *B,
+                       matrix_t *result) {
+  if (_cholesky_invalid(factor) || _validation_matrix(B) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (B->rows != factor->n || _cholesky_singular(factor)) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    error = _create_matrix(B->rows, B->columns, result, 0);
+  }
+
+  if (!error) {
+    _copy_rows(B, result);
+    _substitute(factor, result);
+  }
+
+  return error;
+}
+
+int s21_cholesky_solve_into(const s21_cholesky_t *factor, matrix_t *B,
+                            matrix_t *result) {
+  if (_cholesky_invalid(factor) || _validation_matrix(B) ||
+      _validation_matrix(result)) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (B->rows != factor->n || result->rows != B->rows ||
+      result->columns != B->columns || _cholesky_singular(factor)) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    if (result->matrix[0] != B->matrix[0]) {
+      _copy_rows(B, result);
+    }
+    _substitute(factor, result);
+  }
+
+  return error;
+}
+
+int s21_cholesky_determinant(const s21_cholesky_t *factor, double *result) {
+  if (_cholesky_invalid(factor) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  *result = _cholesky_determinant(factor->l, factor->n);
+
+  return S21_OK;
+}
+
+int s21_cholesky_log_determinant(const s21_cholesky_t *factor,
+                                 double *result) {
+  if (_cholesky_invalid(factor) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  *result = _cholesky_log_determinant(factor->l, factor->n);
+
+  return S21_OK;
+}
+
+int s21_cholesky_inverse(const s21_cholesky_t *factor, matrix_t *result) {
+  if (_cholesky_invalid(factor) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+  int n = factor->n;
+
+  if (_cholesky_singular(factor)) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    error = s21_create_matrix(n, n, result);
+  }
+
+  if (!error) {
+    for (int i = 0; i < n; i++) {
+      result->matrix[i][i] = 1.0;
+    }
+    _cholesky_solve(factor->l, n, result->matrix, n);
+  }
+
+  return error;
+}
+
+void s21_cholesky_free(s21_cholesky_t *factor) {
+  if (factor != NULL) {
+    free(factor->l);
+    factor->l = NULL;
+    factor->n = 0;
+  }
+}
+
+int s21_set_spd_detection(int enabled) {
+  int error = S21_OK;
+
+  if (enabled != 0 && enabled != 1) {
+    error = S21_CALC_ERROR;
+  } else {
+    atomic_store(&_spd_detection, enabled);
+  }
+
+  return error;
+}
+
+int s21_get_spd_detection(void) {
+  return atomic_load_explicit(&_spd_detection, memory_order_relaxed);
+}
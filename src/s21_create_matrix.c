@@ -1,29 +1,65 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "../include/s21_helpers.h"
 #include "../include/s21_matrix.h"
 
-int s21_create_matrix(int rows, int columns, matrix_t *result) {
+int _create_matrix(int rows, int columns, matrix_t *result, int zero) {
   if (result == NULL || rows <= 0 || columns <= 0) {
     return S21_INCORRECT_MATRIX;
   }
 
+  if (s21_get_alloc_mode() == S21_ALLOC_ALIGNED) {
+    return _aligned_create(rows, columns, result);
+  }
+
   int error = S21_OK;
 
-  result->rows = rows;
-  result->columns = columns;
-  result->matrix = (double **)calloc(rows, sizeof(double *));
-  if (result->matrix != NULL) {
-    for (int i = 0; i < rows && !error; i++) {
-      result->matrix[i] = (double *)calloc(columns, sizeof(double));
-      if (result->matrix[i] == NULL) {
-        error = S21_INCORRECT_MATRIX;
+  size_t elements = (size_t)rows * (size_t)columns;
+  size_t head = (size_t)rows * sizeof(double *);
+
+  if (elements > (SIZE_MAX - head) / sizeof(double)) {
+    error = S21_INCORRECT_MATRIX;
+  }
+
+  double **block = NULL;
+  if (!error) {
+    block = _recycle_take(rows, columns);
+    if (block != NULL) {
+      if (zero) {
+        memset(block + rows, 0, elements * sizeof(double));
       }
+    } else if (zero) {
+      block = (double **)calloc(1, head + elements * sizeof(double));
+    } else {
+      block = (double **)malloc(head + elements * sizeof(double));
+    }
+    if (block == NULL) {
+      error = S21_INCORRECT_MATRIX;
     }
-  } else {
-    error = S21_INCORRECT_MATRIX;
   }
 
-  if (error) {
-    s21_remove_matrix(result);
+  if (!error) {
+    double *data = (double *)(block + rows);
+    for (int i = 0; i < rows; i++) {
+      block[i] = data + (size_t)i * (size_t)columns;
+    }
+    result->matrix = block;
+    result->rows = rows;
+    result->columns = columns;
+  } else {
+    result->matrix = NULL;
+    result->rows = 0;
+    result->columns = 0;
   }
 
   return error;
-}
\ No newline at end of file
+}
+
+int s21_create_matrix(int rows, int columns, matrix_t *result) {
+  return _create_matrix(rows, columns, result, 1);
+}
+
+int s21_create_matrix_uninit(int rows, int columns, matrix_t *result) {
+  return _create_matrix(rows, columns, result, 0);
+}
@@ -1,23 +1,50 @@
 #include "../include/s21_helpers.h"
 #include "../include/s21_matrix.h"
 
-static double _determinant(matrix_t *A) {
-  if (A->rows == 1 && A->columns == 1) {
-    return A->matrix[0][0];
-  }
-  if (A->rows == 2 && A->columns == 2) {
-    return A->matrix[0][0] * A->matrix[1][1] -
-           A->matrix[0][1] * A->matrix[1][0];
-  }
-  double detA = 0.0;
-  for (int i = 0; i < A->rows; i++) {
-    matrix_t tmp = {NULL, 0, 0};
-    _crossing_out_matrix_element(A, &tmp, 0, i);
-    double sign = (i % 2 == 0 ? 1.0 : -1.0);
-    detA += sign * A->matrix[0][i] * _determinant(&tmp);
-    s21_remove_matrix(&tmp);
-  }
-  return detA;
+/* Determinant of A, or its sign and log-magnitude when `logarithm` is set. */
+static int _determinant(const matrix_t *A, int logarithm, int *sign,
+                        double *result) {
+  int n = A->rows;
+
+  if (n <= S21_SMALL_MAX) {
+    double det = _det_small(A->matrix, n);
+    if (logarithm) {
+      *sign = (det > 0.0) - (det < 0.0);
+      *result = log(fabs(det));
+    } else {
+      *result = det;
+    }
+    return S21_OK;
+  }
+
+  s21_arena_t *arena = _arena();
+  s21_arena_mark_t mark = s21_arena_mark(arena);
+  double *lu = (double *)s21_arena_alloc(
+      arena, (size_t)n * n * sizeof(double) + (size_t)n * sizeof(int));
+  if (lu == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  if (_spd_factor(A, lu)) {
+    if (logarithm) {
+      *sign = 1;
+      *result = _cholesky_log_determinant(lu, n);
+    } else {
+      *result = _cholesky_determinant(lu, n);
+    }
+  } else {
+    int *pivots = (int *)(lu + (size_t)n * n);
+    _copy_to_buffer(A, lu);
+    int permutation = _lu_decompose(lu, n, pivots);
+    if (logarithm) {
+      *result = _lu_log_determinant(lu, n, permutation, sign);
+    } else {
+      *result = _lu_determinant(lu, n, permutation);
+    }
+  }
+
+  s21_arena_release(arena, mark);
+  return S21_OK;
 }
 
 int s21_determinant(matrix_t *A, double *result) {
@@ -32,8 +59,26 @@ int s21_determinant(matrix_t *A, double *result) {
   }
 
   if (!error) {
-    *result = _determinant(A);
+    error = _determinant(A, 0, NULL, result);
+  }
+
+  return error;
+}
+
+int s21_log_determinant(matrix_t *A, int *sign, double *result) {
+  if (_validation_matrix(A) || sign == NULL || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (A->rows != A->columns) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    error = _determinant(A, 1, sign, result);
   }
 
   return error;
-}
\ No newline at end of file
+}
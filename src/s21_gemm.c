@@ -0,0 +1,280 @@
+#include "../include/s21_helpers.h"
+#include "../include/s21_kernels.h"
+#include "../include/s21_thread_pool.h"
+
+#define S21_GEMM_MC 96
+#define S21_GEMM_KC 256
+#define S21_GEMM_NC 2048
+
+#define S21_GEMM_SMALL (64 * 64 * 64)
+#define S21_GEMM_MIN_TILE_N 256
+
+#define S21_GEMM_A_SIZE ((size_t)S21_GEMM_MC * S21_GEMM_KC)
+#define S21_GEMM_B_SIZE ((size_t)S21_GEMM_KC * S21_GEMM_NC)
+#define S21_GEMM_BUF_BYTES \
+  ((S21_GEMM_A_SIZE + S21_GEMM_B_SIZE) * sizeof(double))
+
+typedef struct gemm_struct {
+  const kernels_t *kern;
+  int m;
+  int n;
+  int k;
+  double alpha;
+  double beta;
+  double *const *a;
+  double *const *b;
+  double **c;
+  int trans_a;
+  int trans_b;
+  int tile_m;
+  int tile_n;
+  int tiles_n;
+} gemm_t;
+
+/* Scales row segment [j0, j1) of C by beta; beta == 0 overwrites it, so
+   NaN or uninitialized values in C do not leak into the result. */
+static void _scale_row(double *c_row, int j0, int j1, double beta) {
+  if (beta == 0.0) {
+    for (int j = j0; j < j1; j++) {
+      c_row[j] = 0.0;
+    }
+  } else if (beta != 1.0) {
+    for (int j = j0; j < j1; j++) {
+      c_row[j] *= beta;
+    }
+  }
+}
+
+/* Element (i, p) of op(A), where a transposed A is stored k x m. */
+static double _op_a(const gemm_t *g, int i, int p) {
+  return g->trans_a ? g->a[p][i] : g->a[i][p];
+}
+
+/* Rows [i0, i1) and columns [j0, j1) of C without packing: an i-k-j loop,
+   or row-times-row dot products when B is stored transposed. */
+static void _gemm_small(const gemm_t *g, int i0, int i1, int j0, int j1) {
+  for (int i = i0; i < i1; i++) {
+    double *c_row = g->c[i];
+    _scale_row(c_row, j0, j1, g->beta);
+    if (g->trans_b) {
+      for (int j = j0; j < j1; j++) {
+        const double *b_row = g->b[j];
+        double sum = 0.0;
+        if (g->trans_a) {
+          for (int p = 0; p < g->k; p++) {
+            sum += g->a[p][i] * b_row[p];
+          }
+        } else {
+          sum = _dot(g->a[i], b_row, g->k);
+        }
+        c_row[j] += g->alpha * sum;
+      }
+    } else {
+      for (int p = 0; p < g->k; p++) {
+        double a_ip = g->alpha * _op_a(g, i, p);
+        const double *b_row = g->b[p];
+        for (int j = j0; j < j1; j++) {
+          c_row[j] += a_ip * b_row[j];
+        }
+      }
+    }
+  }
+}
+
+/* Packs rows [i0, i0 + mc) and columns [k0, k0 + kc) of alpha * op(A) into
+   mr-row slivers stored column by column. */
+static void _pack_a(const gemm_t *g, int mr, int i0, int mc, int k0, int kc,
+                    double *buf) {
+  for (int ir = 0; ir < mc; ir += mr) {
+    int rows = mc - ir < mr ? mc - ir : mr;
+    if (g->trans_a) {
+      for (int p = 0; p < kc; p++) {
+        const double *src = g->a[k0 + p] + i0 + ir;
+        double *dst = buf + p * mr;
+        for (int r = 0; r < rows; r++) {
+          dst[r] = g->alpha * src[r];
+        }
+        for (int r = rows; r < mr; r++) {
+          dst[r] = 0.0;
+        }
+      }
+    } else {
+      for (int r = 0; r < mr; r++) {
+        double *dst = buf + r;
+        if (r < rows) {
+          const double *src = g->a[i0 + ir + r] + k0;
+          for (int p = 0; p < kc; p++) {
+            dst[p * mr] = g->alpha * src[p];
+          }
+        } else {
+          for (int p = 0; p < kc; p++) {
+            dst[p * mr] = 0.0;
+          }
+        }
+      }
+    }
+    buf += (size_t)kc * mr;
+  }
+}
+
+/* Packs rows [k0, k0 + kc) and columns [j0, j0 + nc) of op(B) into nr-column
+   slivers stored row by row. */
+static void _pack_b(const gemm_t *g, int nr, int k0, int kc, int j0, int nc,
+                    double *buf) {
+  for (int jr = 0; jr < nc; jr += nr) {
+    int cols = nc - jr < nr ? nc - jr : nr;
+    if (g->trans_b) {
+      for (int j = 0; j < nr; j++) {
+        double *dst = buf + j;
+        if (j < cols) {
+          const double *src = g->b[j0 + jr + j] + k0;
+          for (int p = 0; p < kc; p++) {
+            dst[p * nr] = src[p];
+          }
+        } else {
+          for (int p = 0; p < kc; p++) {
+            dst[p * nr] = 0.0;
+          }
+        }
+      }
+    } else {
+      for (int p = 0; p < kc; p++) {
+        const double *src = g->b[k0 + p] + j0 + jr;
+        double *dst = buf + p * nr;
+        for (int j = 0; j < cols; j++) {
+          dst[j] = src[j];
+        }
+        for (int j = cols; j < nr; j++) {
+          dst[j] = 0.0;
+        }
+      }
+    }
+    buf += (size_t)kc * nr;
+  }
+}
+
+/* Adds the product of packed panels to C, or, for the first panel along k,
+   stores it over beta * C so that C is read and written only once. */
+static void _macro_kernel(const kernels_t *kern, int mc, int nc, int kc,
+                          const double *pa, const double *pb, double beta,
+                          double **c, int j0) {
+  double ab[S21_KERNEL_MR_MAX * S21_KERNEL_NR_MAX];
+  int mr = kern->mr;
+  int nr = kern->nr;
+  for (int jr = 0; jr < nc; jr += nr) {
+    int cols = nc - jr < nr ? nc - jr : nr;
+    const double *b = pb + (size_t)jr * kc;
+    for (int ir = 0; ir < mc; ir += mr) {
+      int rows = mc - ir < mr ? mc - ir : mr;
+      kern->gemm(kc, pa + (size_t)ir * kc, b, ab);
+      for (int r = 0; r < rows; r++) {
+        double *c_row = c[ir + r] + j0 + jr;
+        const double *ab_row = ab + r * nr;
+        if (beta == 1.0) {
+          for (int j = 0; j < cols; j++) {
+            c_row[j] += ab_row[j];
+          }
+        } else if (beta == 0.0) {
+          for (int j = 0; j < cols; j++) {
+            c_row[j] = ab_row[j];
+          }
+        } else {
+          for (int j = 0; j < cols; j++) {
+            c_row[j] = beta * c_row[j] + ab_row[j];
+          }
+        }
+      }
+    }
+  }
+}
+
+static void _gemm_block(const gemm_t *g, int i0, int i1, int j0, int j1,
+                        double *pa, double *pb) {
+  const kernels_t *kern = g->kern;
+  for (int jc = j0; jc < j1; jc += S21_GEMM_NC) {
+    int nc = j1 - jc < S21_GEMM_NC ? j1 - jc : S21_GEMM_NC;
+    for (int k0 = 0; k0 < g->k; k0 += S21_GEMM_KC) {
+      int kc = g->k - k0 < S21_GEMM_KC ? g->k - k0 : S21_GEMM_KC;
+      double beta = k0 == 0 ? g->beta : 1.0;
+      _pack_b(g, kern->nr, k0, kc, jc, nc, pb);
+      for (int ic = i0; ic < i1; ic += S21_GEMM_MC) {
+        int mc = i1 - ic < S21_GEMM_MC ? i1 - ic : S21_GEMM_MC;
+        _pack_a(g, kern->mr, ic, mc, k0, kc, pa);
+        _macro_kernel(kern, mc, nc, kc, pa, pb, beta, g->c + ic, jc);
+      }
+    }
+  }
+}
+
+static void _gemm_task(void *ctx, int task, int worker) {
+  const gemm_t *g = (const gemm_t *)ctx;
+  int i0 = (task / g->tiles_n) * g->tile_m;
+  int j0 = (task % g->tiles_n) * g->tile_n;
+  int i1 = i0 + g->tile_m < g->m ? i0 + g->tile_m : g->m;
+  int j1 = j0 + g->tile_n < g->n ? j0 + g->tile_n : g->n;
+
+  double *pa = (double *)_pool_scratch(worker, S21_GEMM_BUF_BYTES);
+  if (pa != NULL) {
+    _gemm_block(g, i0, i1, j0, j1, pa, pa + S21_GEMM_A_SIZE);
+  } else {
+    _gemm_small(g, i0, i1, j0, j1);
+  }
+}
+
+static int _gemm_parallel(gemm_t *g) {
+  int threads = _pool_size();
+  int done = 0;
+
+  if (threads > 1 && (long long)g->m * g->n * g->k >= _pool_threshold()) {
+    int tiles_m = (g->m + S21_GEMM_MC - 1) / S21_GEMM_MC;
+    g->tile_m = S21_GEMM_MC;
+    g->tile_n = S21_GEMM_NC;
+    while (g->tile_n > S21_GEMM_MIN_TILE_N &&
+           tiles_m * ((g->n + g->tile_n - 1) / g->tile_n) < 4 * threads) {
+      g->tile_n /= 2;
+    }
+    g->tiles_n = (g->n + g->tile_n - 1) / g->tile_n;
+    done = _pool_run(tiles_m * g->tiles_n, _gemm_task, g) > 0;
+  }
+
+  return done;
+}
+
+int _gemm_trans(int trans_a, int trans_b, int m, int n, int k, double alpha,
+                double *const *a, double *const *b, double beta, double **c) {
+  if (m == 1 || n == 1) {
+    return _gemv(trans_a, trans_b, m, n, k, alpha, a, b, beta, c);
+  }
+
+  gemm_t g = {_kernels(), m, n, k, alpha, beta, a, b, c, trans_a, trans_b,
+              0, 0, 0};
+  if ((double)m * n * k <= S21_GEMM_SMALL) {
+    _gemm_small(&g, 0, m, 0, n);
+    return S21_OK;
+  }
+
+  if (_gemm_parallel(&g)) {
+    return S21_OK;
+  }
+
+  s21_arena_t *arena = _arena();
+  s21_arena_mark_t mark = s21_arena_mark(arena);
+  double *buf = (double *)s21_arena_alloc(arena, S21_GEMM_BUF_BYTES);
+  if (buf == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+  _gemm_block(&g, 0, m, 0, n, buf, buf + S21_GEMM_A_SIZE);
+  s21_arena_release(arena, mark);
+
+  return S21_OK;
+}
+
+int _gemm_scaled(int m, int n, int k, double alpha, double *const *a,
+                 double *const *b, double beta, double **c) {
+  return _gemm_trans(0, 0, m, n, k, alpha, a, b, beta, c);
+}
+
+int _gemm(int m, int n, int k, double *const *a, double *const *b,
+          double **c) {
+  return _gemm_scaled(m, n, k, 1.0, a, b, 1.0, c);
+}
@@ -0,0 +1,168 @@
+#include <string.h>
+
+#include "../include/s21_helpers.h"
+#include "../include/s21_kernels.h"
+#include "../include/s21_thread_pool.h"
+
+#define S21_GEMV_COLUMNS 1024
+#define S21_GEMV_ALIGN 8
+
+/* y = alpha * M x + beta * y over the stored rows of M ("dot" form), or
+   y = alpha * M^T x + beta * y as a sum of scaled rows ("axpy" form). */
+typedef struct gemv_struct {
+  const kernels_t *kern;
+  int dot;
+  int rows;
+  int length;
+  double alpha;
+  double beta;
+  double *const *m;
+  const double *x;
+  double *y;
+  int chunk;
+} gemv_t;
+
+static void _store(const gemv_t *g, int i, double sum) {
+  g->y[i] = g->beta == 0.0 ? g->alpha * sum
+                           : g->alpha * sum + g->beta * g->y[i];
+}
+
+static void _gemv_dot(const gemv_t *g, int i0, int i1) {
+  double out[S21_KERNEL_GEMV_ROWS];
+  int i = i0;
+  for (; i + S21_KERNEL_GEMV_ROWS <= i1; i += S21_KERNEL_GEMV_ROWS) {
+    g->kern->dot4((const double *const *)(g->m + i), g->x, g->length, out);
+    for (int r = 0; r < S21_KERNEL_GEMV_ROWS; r++) {
+      _store(g, i + r, out[r]);
+    }
+  }
+  for (; i < i1; i++) {
+    _store(g, i, _dot(g->m[i], g->x, g->length));
+  }
+}
+
+/* Columns [j0, j1) of the axpy form, in blocks that stay in L1 while the
+   rows of M stream past them four at a time. */
+static void _gemv_axpy(const gemv_t *g, int j0, int j1) {
+  double f[S21_KERNEL_GEMV_ROWS];
+  for (int jb = j0; jb < j1; jb += S21_GEMV_COLUMNS) {
+    int len = j1 - jb < S21_GEMV_COLUMNS ? j1 - jb : S21_GEMV_COLUMNS;
+    double *y = g->y + jb;
+    if (g->beta == 0.0) {
+      memset(y, 0, (size_t)len * sizeof(double));
+    } else if (g->beta != 1.0) {
+      g->kern->scale(y, g->beta, y, len);
+    }
+    int p = 0;
+    for (; p + S21_KERNEL_GEMV_ROWS <= g->rows; p += S21_KERNEL_GEMV_ROWS) {
+      const double *rows[S21_KERNEL_GEMV_ROWS];
+      for (int r = 0; r < S21_KERNEL_GEMV_ROWS; r++) {
+        rows[r] = g->m[p + r] + jb;
+        f[r] = g->alpha * g->x[p + r];
+      }
+      g->kern->axpy4(rows, f, y, len);
+    }
+    for (; p < g->rows; p++) {
+      const double *row = g->m[p] + jb;
+      double f_p = g->alpha * g->x[p];
+      for (int j = 0; j < len; j++) {
+        y[j] += f_p * row[j];
+      }
+    }
+  }
+}
+
+static void _gemv_task(void *ctx, int task, int worker) {
+  (void)worker;
+  const gemv_t *g = (const gemv_t *)ctx;
+  int extent = g->dot ? g->rows : g->length;
+  int first = task * g->chunk;
+  int last = first + g->chunk < extent ? first + g->chunk : extent;
+  if (g->dot) {
+    _gemv_dot(g, first, last);
+  } else {
+    _gemv_axpy(g, first, last);
+  }
+}
+
+/* Splits the output vector across the pool; each task owns its range of y,
+   so no reduction is needed. */
+static int _gemv_parallel(gemv_t *g) {
+  int threads = _pool_size();
+  int extent = g->dot ? g->rows : g->length;
+  int done = 0;
+
+  if (threads > 1 && extent >= 2 * S21_GEMV_ALIGN &&
+      (long long)g->rows * g->length >= _pool_threshold()) {
+    int tasks = 4 * threads;
+    int chunk = (extent + tasks - 1) / tasks;
+    g->chunk = (chunk + S21_GEMV_ALIGN - 1) / S21_GEMV_ALIGN * S21_GEMV_ALIGN;
+    tasks = (extent + g->chunk - 1) / g->chunk;
+    done = _pool_run(tasks, _gemv_task, g) > 0;
+  }
+
+  return done;
+}
+
+/* A vector stored as element 0 of `n` rows, or as row 0 itself. Returns a
+   contiguous view of it: the storage when the elements are adjacent,
+   otherwise a gathered copy in `arena`. */
+static double *_vector(double *const *rows, int n, int column,
+                       s21_arena_t *arena) {
+  int contiguous = 1;
+  for (int i = 1; column && contiguous && i < n; i++) {
+    contiguous = rows[i] == rows[0] + i;
+  }
+
+  double *v = rows[0];
+  if (!contiguous) {
+    v = (double *)s21_arena_alloc(arena, (size_t)n * sizeof(double));
+    for (int i = 0; v != NULL && i < n; i++) {
+      v[i] = rows[i][0];
+    }
+  }
+  return v;
+}
+
+int _gemv(int trans_a, int trans_b, int m, int n, int k, double alpha,
+          double *const *a, double *const *b, double beta, double **c) {
+  gemv_t g = {_kernels(), 0, 0, 0, alpha, beta, NULL, NULL, NULL, 0};
+  int x_column = 0;
+  int y_column = n == 1;
+  double *const *x_rows = NULL;
+
+  if (n == 1) {
+    g.dot = !trans_a;
+    g.m = a;
+    x_rows = b;
+    x_column = !trans_b;
+  } else {
+    g.dot = trans_b;
+    g.m = b;
+    x_rows = a;
+    x_column = trans_a;
+  }
+  g.rows = g.dot ? (n == 1 ? m : n) : k;
+  g.length = g.dot ? k : (n == 1 ? m : n);
+
+  s21_arena_t *arena = _arena();
+  s21_arena_mark_t mark = s21_arena_mark(arena);
+  g.x = _vector(x_rows, k, x_column, arena);
+  g.y = g.x != NULL ? _vector(c, n == 1 ? m : n, y_column, arena) : NULL;
+  int error = g.y == NULL ? S21_INCORRECT_MATRIX : S21_OK;
+
+  if (!error && !_gemv_parallel(&g)) {
+    if (g.dot) {
+      _gemv_dot(&g, 0, g.rows);
+    } else {
+      _gemv_axpy(&g, 0, g.length);
+    }
+  }
+
+  for (int i = 0; !error && g.y != c[0] && i < m; i++) {
+    c[i][0] = g.y[i];
+  }
+
+  s21_arena_release(arena, mark);
+  return error;
+}
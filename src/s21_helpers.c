@@ -1,18 +1,125 @@
 #include "../include/s21_helpers.h"
 
-void _crossing_out_matrix_element(matrix_t *A, matrix_t *result, int skip_row,
-                                  int skip_col) {
-  s21_create_matrix(A->rows - 1, A->columns - 1, result);
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+void _minor_to_buffer(const matrix_t *A, double *dst, int skip_row,
+                      int skip_col) {
+  size_t head = (size_t)skip_col * sizeof(double);
+  size_t tail = (size_t)(A->columns - skip_col - 1) * sizeof(double);
   for (int i = 0; i < A->rows; i++) {
-    for (int j = 0; j < A->columns; j++) {
-      if (i != skip_row && j != skip_col) {
-        result->matrix[i > skip_row ? i - 1 : i][j > skip_col ? j - 1 : j] =
-            A->matrix[i][j];
-      }
+    if (i != skip_row) {
+      memcpy(dst, A->matrix[i], head);
+      memcpy(dst + skip_col, A->matrix[i] + skip_col + 1, tail);
+      dst += A->columns - 1;
     }
   }
 }
 
+void _copy_rows(const matrix_t *A, matrix_t *result) {
+  size_t row = (size_t)A->columns * sizeof(double);
+  for (int i = 0; i < A->rows; i++) {
+    memmove(result->matrix[i], A->matrix[i], row);
+  }
+}
+
+/* Four partial sums keep the dependent adds of a long dot product from
+   serializing on the FP adder latency. */
+double _dot(const double *a, const double *b, int n) {
+  double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+  int k = 0;
+  for (; k + 4 <= n; k += 4) {
+    s0 += a[k] * b[k];
+    s1 += a[k + 1] * b[k + 1];
+    s2 += a[k + 2] * b[k + 2];
+    s3 += a[k + 3] * b[k + 3];
+  }
+  for (; k < n; k++) {
+    s0 += a[k] * b[k];
+  }
+  return (s0 + s1) + (s2 + s3);
+}
+
 int _validation_matrix(const matrix_t *A) {
   return (A == NULL || A->matrix == NULL || A->rows <= 0 || A->columns <= 0);
 }
+
+int _is_single_block(const matrix_t *A) {
+  return A->rows > 0 && (A->matrix[0] == (double *)(A->matrix + A->rows) ||
+                         _is_aligned_block(A));
+}
+
+int _is_dense(const matrix_t *A) {
+  return _is_single_block(A) &&
+         A->matrix[A->rows - 1] ==
+             A->matrix[0] + (size_t)(A->rows - 1) * (size_t)A->columns;
+}
+
+/* Lowest and one-past-highest element addresses of X. Per-row allocated
+   matrices get the hull of their rows, so a gap between rows may report a
+   false overlap. */
+static void _data_span(const matrix_t *X, uintptr_t *first, uintptr_t *last) {
+  uintptr_t lo = (uintptr_t)X->matrix[0];
+  uintptr_t hi = lo;
+  for (int i = 1; i < X->rows; i++) {
+    uintptr_t row = (uintptr_t)X->matrix[i];
+    lo = row < lo ? row : lo;
+    hi = row > hi ? row : hi;
+  }
+  *first = lo;
+  *last = hi + (uintptr_t)X->columns * sizeof(double);
+}
+
+int _shares_storage(const matrix_t *A, const matrix_t *B) {
+  uintptr_t a_first = 0, a_last = 0, b_first = 0, b_last = 0;
+  _data_span(A, &a_first, &a_last);
+  _data_span(B, &b_first, &b_last);
+  return a_first < b_last && b_first < a_last;
+}
+
+long long _stride(const matrix_t *A) {
+  long long stride = 0;
+  if (_is_single_block(A)) {
+    stride = A->rows > 1 ? (long long)(A->matrix[1] - A->matrix[0])
+                         : (long long)A->columns;
+    if (stride < A->columns ||
+        A->matrix[A->rows - 1] != A->matrix[0] + (A->rows - 1) * stride) {
+      stride = 0;
+    }
+  }
+  return stride;
+}
+
+/* Number of elements from the first to the last element of a matrix whose
+   rows are `stride` apart, or 0 if that does not fit one kernel call. */
+static int _span(const matrix_t *A, long long stride) {
+  long long span = (A->rows - 1) * stride + A->columns;
+  return stride > 0 && span <= INT_MAX ? (int)span : 0;
+}
+
+void _apply_binary(binary_kernel_t op, const matrix_t *A, const matrix_t *B,
+                   matrix_t *C) {
+  long long stride = _stride(A);
+  int span = _span(A, stride);
+  if (span > 0 && _stride(B) == stride && _stride(C) == stride) {
+    op(A->matrix[0], B->matrix[0], C->matrix[0], span);
+  } else {
+    for (int i = 0; i < A->rows; i++) {
+      op(A->matrix[i], B->matrix[i], C->matrix[i], A->columns);
+    }
+  }
+}
+
+void _apply_scale(scale_kernel_t op, const matrix_t *A, double number,
+                  matrix_t *C) {
+  long long stride = _stride(A);
+  int span = _span(A, stride);
+  if (span > 0 && _stride(C) == stride) {
+    op(A->matrix[0], number, C->matrix[0], span);
+  } else {
+    for (int i = 0; i < A->rows; i++) {
+      op(A->matrix[i], number, C->matrix[i], A->columns);
+    }
+  }
+}
@@ -1,6 +1,33 @@
 #include "../include/s21_helpers.h"
 #include "../include/s21_matrix.h"
 
+static int _inverse_small(const matrix_t *A, matrix_t *result) {
+  int n = A->rows;
+  double adj[S21_SMALL_MAX * S21_SMALL_MAX];
+  double detA = _adjugate_small(A->matrix, n, adj);
+
+  int error = S21_OK;
+
+  if (_small_singular(A->matrix, n, detA)) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    error = _create_matrix(n, n, result, 0);
+  }
+
+  if (!error) {
+    double scale = 1.0 / detA;
+    for (int i = 0; i < n; i++) {
+      for (int j = 0; j < n; j++) {
+        result->matrix[i][j] = adj[i * n + j] * scale;
+      }
+    }
+  }
+
+  return error;
+}
+
 int s21_inverse_matrix(matrix_t *A, matrix_t *result) {
   if (_validation_matrix(A) || result == NULL) {
     return S21_INCORRECT_MATRIX;
@@ -10,34 +37,53 @@ int s21_inverse_matrix(matrix_t *A, matrix_t *result) {
 
   if (A->rows != A->columns) {
     error = S21_CALC_ERROR;
+  } else if (A->rows <= S21_SMALL_MAX) {
+    return _inverse_small(A, result);
   }
 
-  double detA = 0.0;
+  int n = A->rows;
+  double *lu = NULL;
+  s21_arena_t *arena = _arena();
+  s21_arena_mark_t mark = s21_arena_mark(arena);
 
   if (!error) {
-    error = s21_determinant(A, &detA);
+    lu = (double *)s21_arena_alloc(
+        arena, (size_t)n * n * sizeof(double) + (size_t)n * sizeof(int));
+    if (lu == NULL) {
+      error = S21_INCORRECT_MATRIX;
+    }
   }
 
-  if (!error && fabsl(detA) < S21_EPS) {
-    error = S21_CALC_ERROR;
-  }
-
-  matrix_t cof = {NULL, 0, 0};
+  int *pivots = NULL;
+  int spd = 0;
   if (!error) {
-    error = s21_calc_complements(A, &cof);
+    spd = _spd_factor(A, lu);
+    if (!spd) {
+      pivots = (int *)(lu + (size_t)n * n);
+      _copy_to_buffer(A, lu);
+      _lu_decompose(lu, n, pivots);
+    }
+    if (!_well_conditioned(lu, n, spd)) {
+      error = S21_CALC_ERROR;
+    }
   }
 
-  matrix_t adj = {NULL, 0, 0};
   if (!error) {
-    error = s21_transpose(&cof, &adj);
+    error = s21_create_matrix(n, n, result);
   }
-  s21_remove_matrix(&cof);
 
   if (!error) {
-    double scalar = 1.0 / detA;
-    error = s21_mult_number(&adj, scalar, result);
+    for (int i = 0; i < n; i++) {
+      result->matrix[i][i] = 1.0;
+    }
+    if (spd) {
+      _cholesky_solve(lu, n, result->matrix, n);
+    } else {
+      _lu_solve(lu, n, pivots, result->matrix, n);
+    }
   }
-  s21_remove_matrix(&adj);
+
+  s21_arena_release(arena, mark);
 
   return error;
 }
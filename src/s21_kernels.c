@@ -0,0 +1,177 @@
+#include <math.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/s21_kernels.h"
+#include "../include/s21_matrix.h"
+
+#define SCALAR_MR 4
+#define SCALAR_NR 8
+
+static void _add_scalar(const double *a, const double *b, double *c, int n) {
+  for (int i = 0; i < n; i++) {
+    c[i] = a[i] + b[i];
+  }
+}
+
+static void _sub_scalar(const double *a, const double *b, double *c, int n) {
+  for (int i = 0; i < n; i++) {
+    c[i] = a[i] - b[i];
+  }
+}
+
+static void _scale_scalar(const double *a, double number, double *c, int n) {
+  for (int i = 0; i < n; i++) {
+    c[i] = a[i] * number;
+  }
+}
+
+static int _eq_scalar(const double *a, const double *b, int n) {
+  int result = SUCCESS;
+  for (int i = 0; result && i < n; i++) {
+    if (!(fabs(a[i] - b[i]) < S21_EPS)) {
+      result = FAILURE;
+    }
+  }
+  return result;
+}
+
+static void _gemm_scalar(int kc, const double *a, const double *b,
+                         double *ab) {
+  double acc[SCALAR_MR][SCALAR_NR] = {{0.0}};
+  for (int p = 0; p < kc; p++) {
+    for (int r = 0; r < SCALAR_MR; r++) {
+      double a_rp = a[r];
+      for (int j = 0; j < SCALAR_NR; j++) {
+        acc[r][j] += a_rp * b[j];
+      }
+    }
+    a += SCALAR_MR;
+    b += SCALAR_NR;
+  }
+  memcpy(ab, acc, sizeof(acc));
+}
+
+static void _dot4_scalar(const double *const *a, const double *x, int n,
+                         double *out) {
+  const double *a0 = a[0], *a1 = a[1], *a2 = a[2], *a3 = a[3];
+  double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+  for (int k = 0; k < n; k++) {
+    double x_k = x[k];
+    s0 += a0[k] * x_k;
+    s1 += a1[k] * x_k;
+    s2 += a2[k] * x_k;
+    s3 += a3[k] * x_k;
+  }
+  out[0] = s0;
+  out[1] = s1;
+  out[2] = s2;
+  out[3] = s3;
+}
+
+static void _axpy4_scalar(const double *const *x, const double *alpha,
+                          double *y, int n) {
+  const double *x0 = x[0], *x1 = x[1], *x2 = x[2], *x3 = x[3];
+  double f0 = alpha[0], f1 = alpha[1], f2 = alpha[2], f3 = alpha[3];
+  for (int i = 0; i < n; i++) {
+    y[i] += f0 * x0[i] + f1 * x1[i] + f2 * x2[i] + f3 * x3[i];
+  }
+}
+
+const kernels_t _kernels_scalar = {
+    S21_ISA_SCALAR, SCALAR_MR,     SCALAR_NR,  _add_scalar,
+    _sub_scalar,    _scale_scalar, _eq_scalar, _gemm_scalar,
+    _dot4_scalar,   _axpy4_scalar};
+
+static _Atomic(const kernels_t *) _active = NULL;
+
+static int _isa_supported(int isa) {
+  int supported = (isa == S21_ISA_SCALAR);
+#if S21_HAVE_X86_SIMD
+  __builtin_cpu_init();
+  if (isa == S21_ISA_AVX2) {
+    supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+  } else if (isa == S21_ISA_AVX512) {
+    supported = __builtin_cpu_supports("avx512f") &&
+                __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+  }
+#endif
+  return supported;
+}
+
+static const kernels_t *_table(int isa) {
+  const kernels_t *table = &_kernels_scalar;
+#if S21_HAVE_X86_SIMD
+  if (isa == S21_ISA_AVX2) {
+    table = &_kernels_avx2;
+  } else if (isa == S21_ISA_AVX512) {
+    table = &_kernels_avx512;
+  }
+#endif
+  return table;
+}
+
+static int _best_isa(void) {
+  int isa = S21_ISA_SCALAR;
+  if (_isa_supported(S21_ISA_AVX512)) {
+    isa = S21_ISA_AVX512;
+  } else if (_isa_supported(S21_ISA_AVX2)) {
+    isa = S21_ISA_AVX2;
+  }
+  return isa;
+}
+
+static int _env_isa(void) {
+  const char *env = getenv("S21_ISA");
+  int isa = -1;
+  if (env != NULL) {
+    if (strcmp(env, "scalar") == 0) {
+      isa = S21_ISA_SCALAR;
+    } else if (strcmp(env, "avx2") == 0) {
+      isa = S21_ISA_AVX2;
+    } else if (strcmp(env, "avx512") == 0) {
+      isa = S21_ISA_AVX512;
+    }
+  }
+  return isa;
+}
+
+#if defined(__GNUC__)
+__attribute__((constructor))
+#endif
+static void _select_kernels(void) {
+  int isa = _env_isa();
+  if (isa < 0 || !_isa_supported(isa)) {
+    isa = _best_isa();
+  }
+  atomic_store_explicit(&_active, _table(isa), memory_order_relaxed);
+}
+
+const kernels_t *_kernels(void) {
+  const kernels_t *active =
+      atomic_load_explicit(&_active, memory_order_relaxed);
+  if (active == NULL) {
+    _select_kernels();
+    active = atomic_load_explicit(&_active, memory_order_relaxed);
+  }
+  return active;
+}
+
+int s21_set_isa(int isa) {
+  int error = S21_OK;
+
+  if (isa == S21_ISA_AUTO) {
+    isa = _best_isa();
+  }
+
+  if (isa < S21_ISA_SCALAR || isa > S21_ISA_AVX512 || !_isa_supported(isa)) {
+    error = S21_CALC_ERROR;
+  } else {
+    atomic_store_explicit(&_active, _table(isa), memory_order_relaxed);
+  }
+
+  return error;
+}
+
+int s21_get_isa(void) { return _kernels()->isa; }
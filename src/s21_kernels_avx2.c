@@ -0,0 +1,192 @@
+#include "../include/s21_kernels.h"
+#include "../include/s21_matrix.h"
+
+#if S21_HAVE_X86_SIMD
+
+#include <immintrin.h>
+
+#define AVX2_MR 6
+#define AVX2_NR 8
+
+S21_TARGET_AVX2 static void _add_avx2(const double *a, const double *b,
+                                      double *c, int n) {
+  int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256d x0 = _mm256_add_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i));
+    __m256d x1 =
+        _mm256_add_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4));
+    _mm256_storeu_pd(c + i, x0);
+    _mm256_storeu_pd(c + i + 4, x1);
+  }
+  for (; i < n; i++) {
+    c[i] = a[i] + b[i];
+  }
+}
+
+S21_TARGET_AVX2 static void _sub_avx2(const double *a, const double *b,
+                                      double *c, int n) {
+  int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m256d x0 = _mm256_sub_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i));
+    __m256d x1 =
+        _mm256_sub_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4));
+    _mm256_storeu_pd(c + i, x0);
+    _mm256_storeu_pd(c + i + 4, x1);
+  }
+  for (; i < n; i++) {
+    c[i] = a[i] - b[i];
+  }
+}
+
+S21_TARGET_AVX2 static void _scale_avx2(const double *a, double number,
+                                        double *c, int n) {
+  __m256d s = _mm256_set1_pd(number);
+  int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm256_storeu_pd(c + i, _mm256_mul_pd(_mm256_loadu_pd(a + i), s));
+    _mm256_storeu_pd(c + i + 4, _mm256_mul_pd(_mm256_loadu_pd(a + i + 4), s));
+  }
+  for (; i < n; i++) {
+    c[i] = a[i] * number;
+  }
+}
+
+S21_TARGET_AVX2 static int _eq_avx2(const double *a, const double *b, int n) {
+  const __m256d sign = _mm256_set1_pd(-0.0);
+  const __m256d eps = _mm256_set1_pd(S21_EPS);
+  int result = SUCCESS;
+  int i = 0;
+  for (; result && i + 4 <= n; i += 4) {
+    __m256d d = _mm256_sub_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i));
+    __m256d lt = _mm256_cmp_pd(_mm256_andnot_pd(sign, d), eps, _CMP_LT_OQ);
+    if (_mm256_movemask_pd(lt) != 0xF) {
+      result = FAILURE;
+    }
+  }
+  for (; result && i < n; i++) {
+    if (!(fabs(a[i] - b[i]) < S21_EPS)) {
+      result = FAILURE;
+    }
+  }
+  return result;
+}
+
+S21_TARGET_AVX2 static void _gemm_avx2(int kc, const double *a,
+                                       const double *b, double *ab) {
+  __m256d c00 = _mm256_setzero_pd(), c01 = _mm256_setzero_pd();
+  __m256d c10 = _mm256_setzero_pd(), c11 = _mm256_setzero_pd();
+  __m256d c20 = _mm256_setzero_pd(), c21 = _mm256_setzero_pd();
+  __m256d c30 = _mm256_setzero_pd(), c31 = _mm256_setzero_pd();
+  __m256d c40 = _mm256_setzero_pd(), c41 = _mm256_setzero_pd();
+  __m256d c50 = _mm256_setzero_pd(), c51 = _mm256_setzero_pd();
+
+  for (int p = 0; p < kc; p++) {
+    __m256d b0 = _mm256_loadu_pd(b);
+    __m256d b1 = _mm256_loadu_pd(b + 4);
+    __m256d x = _mm256_broadcast_sd(a);
+    c00 = _mm256_fmadd_pd(x, b0, c00);
+    c01 = _mm256_fmadd_pd(x, b1, c01);
+    x = _mm256_broadcast_sd(a + 1);
+    c10 = _mm256_fmadd_pd(x, b0, c10);
+    c11 = _mm256_fmadd_pd(x, b1, c11);
+    x = _mm256_broadcast_sd(a + 2);
+    c20 = _mm256_fmadd_pd(x, b0, c20);
+    c21 = _mm256_fmadd_pd(x, b1, c21);
+    x = _mm256_broadcast_sd(a + 3);
+    c30 = _mm256_fmadd_pd(x, b0, c30);
+    c31 = _mm256_fmadd_pd(x, b1, c31);
+    x = _mm256_broadcast_sd(a + 4);
+    c40 = _mm256_fmadd_pd(x, b0, c40);
+    c41 = _mm256_fmadd_pd(x, b1, c41);
+    x = _mm256_broadcast_sd(a + 5);
+    c50 = _mm256_fmadd_pd(x, b0, c50);
+    c51 = _mm256_fmadd_pd(x, b1, c51);
+    a += AVX2_MR;
+    b += AVX2_NR;
+  }
+
+  _mm256_storeu_pd(ab + 0 * AVX2_NR, c00);
+  _mm256_storeu_pd(ab + 0 * AVX2_NR + 4, c01);
+  _mm256_storeu_pd(ab + 1 * AVX2_NR, c10);
+  _mm256_storeu_pd(ab + 1 * AVX2_NR + 4, c11);
+  _mm256_storeu_pd(ab + 2 * AVX2_NR, c20);
+  _mm256_storeu_pd(ab + 2 * AVX2_NR + 4, c21);
+  _mm256_storeu_pd(ab + 3 * AVX2_NR, c30);
+  _mm256_storeu_pd(ab + 3 * AVX2_NR + 4, c31);
+  _mm256_storeu_pd(ab + 4 * AVX2_NR, c40);
+  _mm256_storeu_pd(ab + 4 * AVX2_NR + 4, c41);
+  _mm256_storeu_pd(ab + 5 * AVX2_NR, c50);
+  _mm256_storeu_pd(ab + 5 * AVX2_NR + 4, c51);
+}
+
+S21_TARGET_AVX2 static void _dot4_avx2(const double *const *a,
+                                       const double *x, int n, double *out) {
+  const double *a0 = a[0], *a1 = a[1], *a2 = a[2], *a3 = a[3];
+  __m256d s0 = _mm256_setzero_pd(), s1 = _mm256_setzero_pd();
+  __m256d s2 = _mm256_setzero_pd(), s3 = _mm256_setzero_pd();
+  __m256d t0 = _mm256_setzero_pd(), t1 = _mm256_setzero_pd();
+  __m256d t2 = _mm256_setzero_pd(), t3 = _mm256_setzero_pd();
+  int k = 0;
+  for (; k + 8 <= n; k += 8) {
+    __m256d x0 = _mm256_loadu_pd(x + k);
+    __m256d x1 = _mm256_loadu_pd(x + k + 4);
+    s0 = _mm256_fmadd_pd(_mm256_loadu_pd(a0 + k), x0, s0);
+    s1 = _mm256_fmadd_pd(_mm256_loadu_pd(a1 + k), x0, s1);
+    s2 = _mm256_fmadd_pd(_mm256_loadu_pd(a2 + k), x0, s2);
+    s3 = _mm256_fmadd_pd(_mm256_loadu_pd(a3 + k), x0, s3);
+    t0 = _mm256_fmadd_pd(_mm256_loadu_pd(a0 + k + 4), x1, t0);
+    t1 = _mm256_fmadd_pd(_mm256_loadu_pd(a1 + k + 4), x1, t1);
+    t2 = _mm256_fmadd_pd(_mm256_loadu_pd(a2 + k + 4), x1, t2);
+    t3 = _mm256_fmadd_pd(_mm256_loadu_pd(a3 + k + 4), x1, t3);
+  }
+  if (k + 4 <= n) {
+    __m256d x0 = _mm256_loadu_pd(x + k);
+    s0 = _mm256_fmadd_pd(_mm256_loadu_pd(a0 + k), x0, s0);
+    s1 = _mm256_fmadd_pd(_mm256_loadu_pd(a1 + k), x0, s1);
+    s2 = _mm256_fmadd_pd(_mm256_loadu_pd(a2 + k), x0, s2);
+    s3 = _mm256_fmadd_pd(_mm256_loadu_pd(a3 + k), x0, s3);
+    k += 4;
+  }
+
+  /* Lane i of the sum holds row i. */
+  __m256d s01 = _mm256_hadd_pd(_mm256_add_pd(s0, t0), _mm256_add_pd(s1, t1));
+  __m256d s23 = _mm256_hadd_pd(_mm256_add_pd(s2, t2), _mm256_add_pd(s3, t3));
+  __m256d sum = _mm256_add_pd(_mm256_permute2f128_pd(s01, s23, 0x20),
+                              _mm256_permute2f128_pd(s01, s23, 0x31));
+  _mm256_storeu_pd(out, sum);
+
+  for (; k < n; k++) {
+    out[0] += a0[k] * x[k];
+    out[1] += a1[k] * x[k];
+    out[2] += a2[k] * x[k];
+    out[3] += a3[k] * x[k];
+  }
+}
+
+S21_TARGET_AVX2 static void _axpy4_avx2(const double *const *x,
+                                        const double *alpha, double *y,
+                                        int n) {
+  const double *x0 = x[0], *x1 = x[1], *x2 = x[2], *x3 = x[3];
+  __m256d f0 = _mm256_set1_pd(alpha[0]), f1 = _mm256_set1_pd(alpha[1]);
+  __m256d f2 = _mm256_set1_pd(alpha[2]), f3 = _mm256_set1_pd(alpha[3]);
+  int i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m256d v = _mm256_loadu_pd(y + i);
+    v = _mm256_fmadd_pd(f0, _mm256_loadu_pd(x0 + i), v);
+    v = _mm256_fmadd_pd(f1, _mm256_loadu_pd(x1 + i), v);
+    v = _mm256_fmadd_pd(f2, _mm256_loadu_pd(x2 + i), v);
+    v = _mm256_fmadd_pd(f3, _mm256_loadu_pd(x3 + i), v);
+    _mm256_storeu_pd(y + i, v);
+  }
+  for (; i < n; i++) {
+    y[i] += alpha[0] * x0[i] + alpha[1] * x1[i] + alpha[2] * x2[i] +
+            alpha[3] * x3[i];
+  }
+}
+
+const kernels_t _kernels_avx2 = {S21_ISA_AVX2, AVX2_MR,     AVX2_NR,
+                                 _add_avx2,    _sub_avx2,   _scale_avx2,
+                                 _eq_avx2,     _gemm_avx2,  _dot4_avx2,
+                                 _axpy4_avx2};
+
+#endif
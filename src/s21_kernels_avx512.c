@@ -0,0 +1,170 @@
+#include "../include/s21_kernels.h"
+#include "../include/s21_matrix.h"
+
+#if S21_HAVE_X86_SIMD
+
+#include <immintrin.h>
+
+#define AVX512_MR 8
+#define AVX512_NR 16
+
+static __mmask8 _tail_mask(int n) { return (__mmask8)((1u << n) - 1u); }
+
+S21_TARGET_AVX512 static void _add_avx512(const double *a, const double *b,
+                                          double *c, int n) {
+  int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm512_storeu_pd(
+        c + i, _mm512_add_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i)));
+  }
+  if (i < n) {
+    __mmask8 m = _tail_mask(n - i);
+    __m512d x = _mm512_add_pd(_mm512_maskz_loadu_pd(m, a + i),
+                              _mm512_maskz_loadu_pd(m, b + i));
+    _mm512_mask_storeu_pd(c + i, m, x);
+  }
+}
+
+S21_TARGET_AVX512 static void _sub_avx512(const double *a, const double *b,
+                                          double *c, int n) {
+  int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm512_storeu_pd(
+        c + i, _mm512_sub_pd(_mm512_loadu_pd(a + i), _mm512_loadu_pd(b + i)));
+  }
+  if (i < n) {
+    __mmask8 m = _tail_mask(n - i);
+    __m512d x = _mm512_sub_pd(_mm512_maskz_loadu_pd(m, a + i),
+                              _mm512_maskz_loadu_pd(m, b + i));
+    _mm512_mask_storeu_pd(c + i, m, x);
+  }
+}
+
+S21_TARGET_AVX512 static void _scale_avx512(const double *a, double number,
+                                            double *c, int n) {
+  __m512d s = _mm512_set1_pd(number);
+  int i = 0;
+  for (; i + 8 <= n; i += 8) {
+    _mm512_storeu_pd(c + i, _mm512_mul_pd(_mm512_loadu_pd(a + i), s));
+  }
+  if (i < n) {
+    __mmask8 m = _tail_mask(n - i);
+    _mm512_mask_storeu_pd(c + i, m,
+                          _mm512_mul_pd(_mm512_maskz_loadu_pd(m, a + i), s));
+  }
+}
+
+S21_TARGET_AVX512 static int _eq_avx512(const double *a, const double *b,
+                                        int n) {
+  const __m512d eps = _mm512_set1_pd(S21_EPS);
+  int result = SUCCESS;
+  int i = 0;
+  for (; result && i < n; i += 8) {
+    __mmask8 m = n - i >= 8 ? (__mmask8)0xFF : _tail_mask(n - i);
+    __m512d d = _mm512_sub_pd(_mm512_maskz_loadu_pd(m, a + i),
+                              _mm512_maskz_loadu_pd(m, b + i));
+    __mmask8 lt = _mm512_cmp_pd_mask(_mm512_abs_pd(d), eps, _CMP_LT_OQ);
+    if ((lt & m) != m) {
+      result = FAILURE;
+    }
+  }
+  return result;
+}
+
+#define AVX512_FMA_ROW(r)                    \
+  x = _mm512_set1_pd(a[r]);                  \
+  c##r##0 = _mm512_fmadd_pd(x, b0, c##r##0); \
+  c##r##1 = _mm512_fmadd_pd(x, b1, c##r##1)
+
+#define AVX512_STORE_ROW(r)                        \
+  _mm512_storeu_pd(ab + (r) * AVX512_NR, c##r##0); \
+  _mm512_storeu_pd(ab + (r) * AVX512_NR + 8, c##r##1)
+
+S21_TARGET_AVX512 static void _gemm_avx512(int kc, const double *a,
+                                           const double *b, double *ab) {
+  __m512d c00 = _mm512_setzero_pd(), c01 = _mm512_setzero_pd();
+  __m512d c10 = _mm512_setzero_pd(), c11 = _mm512_setzero_pd();
+  __m512d c20 = _mm512_setzero_pd(), c21 = _mm512_setzero_pd();
+  __m512d c30 = _mm512_setzero_pd(), c31 = _mm512_setzero_pd();
+  __m512d c40 = _mm512_setzero_pd(), c41 = _mm512_setzero_pd();
+  __m512d c50 = _mm512_setzero_pd(), c51 = _mm512_setzero_pd();
+  __m512d c60 = _mm512_setzero_pd(), c61 = _mm512_setzero_pd();
+  __m512d c70 = _mm512_setzero_pd(), c71 = _mm512_setzero_pd();
+
+  for (int p = 0; p < kc; p++) {
+    __m512d b0 = _mm512_loadu_pd(b);
+    __m512d b1 = _mm512_loadu_pd(b + 8);
+    __m512d x;
+    AVX512_FMA_ROW(0);
+    AVX512_FMA_ROW(1);
+    AVX512_FMA_ROW(2);
+    AVX512_FMA_ROW(3);
+    AVX512_FMA_ROW(4);
+    AVX512_FMA_ROW(5);
+    AVX512_FMA_ROW(6);
+    AVX512_FMA_ROW(7);
+    a += AVX512_MR;
+    b += AVX512_NR;
+  }
+
+  AVX512_STORE_ROW(0);
+  AVX512_STORE_ROW(1);
+  AVX512_STORE_ROW(2);
+  AVX512_STORE_ROW(3);
+  AVX512_STORE_ROW(4);
+  AVX512_STORE_ROW(5);
+  AVX512_STORE_ROW(6);
+  AVX512_STORE_ROW(7);
+}
+
+S21_TARGET_AVX512 static void _dot4_avx512(const double *const *a,
+                                           const double *x, int n,
+                                           double *out) {
+  const double *a0 = a[0], *a1 = a[1], *a2 = a[2], *a3 = a[3];
+  __m512d s0 = _mm512_setzero_pd(), s1 = _mm512_setzero_pd();
+  __m512d s2 = _mm512_setzero_pd(), s3 = _mm512_setzero_pd();
+  int k = 0;
+  for (; k + 8 <= n; k += 8) {
+    __m512d x0 = _mm512_loadu_pd(x + k);
+    s0 = _mm512_fmadd_pd(_mm512_loadu_pd(a0 + k), x0, s0);
+    s1 = _mm512_fmadd_pd(_mm512_loadu_pd(a1 + k), x0, s1);
+    s2 = _mm512_fmadd_pd(_mm512_loadu_pd(a2 + k), x0, s2);
+    s3 = _mm512_fmadd_pd(_mm512_loadu_pd(a3 + k), x0, s3);
+  }
+  if (k < n) {
+    __mmask8 m = _tail_mask(n - k);
+    __m512d x0 = _mm512_maskz_loadu_pd(m, x + k);
+    s0 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m, a0 + k), x0, s0);
+    s1 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m, a1 + k), x0, s1);
+    s2 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m, a2 + k), x0, s2);
+    s3 = _mm512_fmadd_pd(_mm512_maskz_loadu_pd(m, a3 + k), x0, s3);
+  }
+  out[0] = _mm512_reduce_add_pd(s0);
+  out[1] = _mm512_reduce_add_pd(s1);
+  out[2] = _mm512_reduce_add_pd(s2);
+  out[3] = _mm512_reduce_add_pd(s3);
+}
+
+S21_TARGET_AVX512 static void _axpy4_avx512(const double *const *x,
+                                            const double *alpha, double *y,
+                                            int n) {
+  const double *x0 = x[0], *x1 = x[1], *x2 = x[2], *x3 = x[3];
+  __m512d f0 = _mm512_set1_pd(alpha[0]), f1 = _mm512_set1_pd(alpha[1]);
+  __m512d f2 = _mm512_set1_pd(alpha[2]), f3 = _mm512_set1_pd(alpha[3]);
+  for (int i = 0; i < n; i += 8) {
+    __mmask8 m = n - i >= 8 ? (__mmask8)0xFF : _tail_mask(n - i);
+    __m512d v = _mm512_maskz_loadu_pd(m, y + i);
+    v = _mm512_fmadd_pd(f0, _mm512_maskz_loadu_pd(m, x0 + i), v);
+    v = _mm512_fmadd_pd(f1, _mm512_maskz_loadu_pd(m, x1 + i), v);
+    v = _mm512_fmadd_pd(f2, _mm512_maskz_loadu_pd(m, x2 + i), v);
+    v = _mm512_fmadd_pd(f3, _mm512_maskz_loadu_pd(m, x3 + i), v);
+    _mm512_mask_storeu_pd(y + i, m, v);
+  }
+}
+
+const kernels_t _kernels_avx512 = {
+    S21_ISA_AVX512, AVX512_MR,     AVX512_NR,  _add_avx512,
+    _sub_avx512,    _scale_avx512, _eq_avx512, _gemm_avx512,
+    _dot4_avx512,   _axpy4_avx512};
+
+#endif
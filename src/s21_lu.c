@@ -0,0 +1,168 @@
+#include <float.h>
+#include <string.h>
+
+#include "../include/s21_helpers.h"
+
+void _copy_to_buffer(const matrix_t *A, double *dst) {
+  size_t row = (size_t)A->columns * sizeof(double);
+  for (int i = 0; i < A->rows; i++) {
+    memcpy(dst + (size_t)i * (size_t)A->columns, A->matrix[i], row);
+  }
+}
+
+int _lu_decompose(double *lu, int n, int *pivots) {
+  int sign = 1;
+
+  for (int k = 0; k < n; k++) {
+    double *row_k = lu + (size_t)k * n;
+
+    int p = k;
+    double max = fabs(row_k[k]);
+    for (int i = k + 1; i < n; i++) {
+      double v = fabs(lu[(size_t)i * n + k]);
+      if (v > max) {
+        max = v;
+        p = i;
+      }
+    }
+
+    pivots[k] = p;
+    if (p != k) {
+      double *row_p = lu + (size_t)p * n;
+      for (int j = 0; j < n; j++) {
+        double tmp = row_k[j];
+        row_k[j] = row_p[j];
+        row_p[j] = tmp;
+      }
+      sign = -sign;
+    }
+
+    double pivot = row_k[k];
+    if (pivot != 0.0) {
+      for (int i = k + 1; i < n; i++) {
+        double *row_i = lu + (size_t)i * n;
+        double l = row_i[k] / pivot;
+        row_i[k] = l;
+        for (int j = k + 1; j < n; j++) {
+          row_i[j] -= l * row_k[j];
+        }
+      }
+    }
+  }
+
+  return sign;
+}
+
+double _diagonal_product(const double *a, int n, int *exponent) {
+  double mantissa = 1.0;
+  int total = 0;
+  for (int k = 0; k < n; k++) {
+    int e = 0;
+    mantissa = frexp(mantissa * a[(size_t)k * n + k], &e);
+    total += e;
+  }
+  *exponent = total;
+  return mantissa;
+}
+
+int _pivots_well_conditioned(const double *a, int n, size_t stride,
+                             int squared) {
+  double min = INFINITY;
+  double max = 0.0;
+  int finite = 1;
+  for (int k = 0; k < n && finite; k++) {
+    double v = fabs(a[(size_t)k * stride]);
+    if (squared) {
+      v *= v;
+    }
+    if (!isfinite(v)) {
+      finite = 0;
+    } else {
+      min = v < min ? v : min;
+      max = v > max ? v : max;
+    }
+  }
+  return finite && min > n * DBL_EPSILON * max;
+}
+
+int _well_conditioned(const double *a, int n, int squared) {
+  return _pivots_well_conditioned(a, n, (size_t)n + 1, squared);
+}
+
+double _lu_determinant(const double *lu, int n, int sign) {
+  int exponent = 0;
+  double mantissa = _diagonal_product(lu, n, &exponent);
+  return ldexp(sign * mantissa, exponent);
+}
+
+double _lu_log_determinant(const double *lu, int n, int sign, int *det_sign) {
+  int exponent = 0;
+  double mantissa = sign * _diagonal_product(lu, n, &exponent);
+  *det_sign = (mantissa > 0.0) - (mantissa < 0.0);
+  return log(fabs(mantissa)) + exponent * log(2.0);
+}
+
+void _lu_solve(const double *lu, int n, const int *pivots, double **x,
+               int nrhs) {
+  for (int k = 0; k < n; k++) {
+    if (pivots[k] != k) {
+      double *row_k = x[k];
+      double *row_p = x[pivots[k]];
+      for (int j = 0; j < nrhs; j++) {
+        double tmp = row_k[j];
+        row_k[j] = row_p[j];
+        row_p[j] = tmp;
+      }
+    }
+  }
+
+  int blocked = _trsm_dense(lu, n, 0, 0, 1, x, nrhs);
+  for (int i = 1; !blocked && i < n; i++) {
+    const double *l = lu + (size_t)i * n;
+    double *row_i = x[i];
+    for (int k = 0; k < i; k++) {
+      double f = l[k];
+      const double *row_k = x[k];
+      for (int j = 0; j < nrhs; j++) {
+        row_i[j] -= f * row_k[j];
+      }
+    }
+  }
+
+  blocked = _trsm_dense(lu, n, 1, 0, 0, x, nrhs);
+  for (int i = n - 1; !blocked && i >= 0; i--) {
+    const double *u = lu + (size_t)i * n;
+    double *row_i = x[i];
+    for (int k = i + 1; k < n; k++) {
+      double f = u[k];
+      const double *row_k = x[k];
+      for (int j = 0; j < nrhs; j++) {
+        row_i[j] -= f * row_k[j];
+      }
+    }
+    double d = u[i];
+    for (int j = 0; j < nrhs; j++) {
+      row_i[j] /= d;
+    }
+  }
+}
+
+void _lu_solve_vector(const double *lu, int n, const int *pivots,
+                      double *x) {
+  for (int k = 0; k < n; k++) {
+    if (pivots[k] != k) {
+      double tmp = x[k];
+      x[k] = x[pivots[k]];
+      x[pivots[k]] = tmp;
+    }
+  }
+
+  for (int i = 1; i < n; i++) {
+    x[i] -= _dot(lu + (size_t)i * n, x, i);
+  }
+
+  for (int i = n - 1; i >= 0; i--) {
+    const double *u = lu + (size_t)i * n;
+    x[i] = (x[i] - _dot(u + i + 1, x + i + 1, n - i - 1)) / u[i];
+  }
+}
@@ -0,0 +1,168 @@
+#include <pthread.h>
+#include <stdatomic.h>
+#include <string.h>
+
+#include "../include/s21_helpers.h"
+#include "../include/s21_matrix.h"
+
+#define S21_RECYCLE_SHAPES 16
+
+typedef struct recycle_shape_struct {
+  int rows;
+  int columns;
+  size_t count;
+  double **head;
+} recycle_shape_t;
+
+typedef struct recycle_struct {
+  recycle_shape_t shapes[S21_RECYCLE_SHAPES];
+  size_t bytes;
+  size_t blocks;
+  unsigned long long hits;
+  unsigned long long misses;
+} recycle_t;
+
+static atomic_size_t _limit = 0;
+static _Thread_local recycle_t *_local = NULL;
+static pthread_key_t _local_key;
+static pthread_once_t _local_once = PTHREAD_ONCE_INIT;
+
+static double **_next(double **block) {
+  double **next;
+  memcpy(&next, block, sizeof(next));
+  return next;
+}
+
+static void _set_next(double **block, double **next) {
+  memcpy(block, &next, sizeof(next));
+}
+
+static size_t _block_bytes(int rows, int columns) {
+  return (size_t)rows * sizeof(double *) +
+         (size_t)rows * (size_t)columns * sizeof(double);
+}
+
+static void _trim(recycle_t *pool) {
+  for (int s = 0; s < S21_RECYCLE_SHAPES; s++) {
+    double **block = pool->shapes[s].head;
+    while (block != NULL) {
+      double **next = _next(block);
+      free(block);
+      block = next;
+    }
+    pool->shapes[s].head = NULL;
+    pool->shapes[s].count = 0;
+  }
+  pool->bytes = 0;
+  pool->blocks = 0;
+}
+
+static void _local_free(void *pool) {
+  _trim((recycle_t *)pool);
+  free(pool);
+}
+
+static void _local_key_create(void) {
+  pthread_key_create(&_local_key, _local_free);
+}
+
+static recycle_t *_local_pool(void) {
+  if (_local == NULL) {
+    pthread_once(&_local_once, _local_key_create);
+    recycle_t *pool = (recycle_t *)calloc(1, sizeof(recycle_t));
+    if (pool != NULL && pthread_setspecific(_local_key, pool) != 0) {
+      free(pool);
+      pool = NULL;
+    }
+    _local = pool;
+  }
+  return _local;
+}
+
+double **_recycle_take(int rows, int columns) {
+  double **block = NULL;
+
+  if (atomic_load_explicit(&_limit, memory_order_relaxed) > 0) {
+    recycle_t *pool = _local_pool();
+    for (int s = 0; pool != NULL && s < S21_RECYCLE_SHAPES; s++) {
+      recycle_shape_t *shape = &pool->shapes[s];
+      if (shape->head != NULL && shape->rows == rows &&
+          shape->columns == columns) {
+        block = shape->head;
+        shape->head = _next(block);
+        shape->count--;
+        pool->bytes -= _block_bytes(rows, columns);
+        pool->blocks--;
+      }
+    }
+    if (pool != NULL) {
+      if (block != NULL) {
+        pool->hits++;
+      } else {
+        pool->misses++;
+      }
+    }
+  }
+
+  return block;
+}
+
+int _recycle_put(double **block, int rows, int columns) {
+  size_t limit = atomic_load_explicit(&_limit, memory_order_relaxed);
+  size_t bytes = _block_bytes(rows, columns);
+  recycle_t *pool = limit > 0 ? _local_pool() : NULL;
+  recycle_shape_t *target = NULL;
+
+  if (pool != NULL && bytes <= limit && pool->bytes <= limit - bytes) {
+    recycle_shape_t *empty = NULL;
+    for (int s = 0; target == NULL && s < S21_RECYCLE_SHAPES; s++) {
+      recycle_shape_t *shape = &pool->shapes[s];
+      if (shape->count > 0 && shape->rows == rows &&
+          shape->columns == columns) {
+        target = shape;
+      } else if (shape->count == 0 && empty == NULL) {
+        empty = shape;
+      }
+    }
+    if (target == NULL && empty != NULL) {
+      target = empty;
+      target->rows = rows;
+      target->columns = columns;
+    }
+  }
+
+  if (target != NULL) {
+    _set_next(block, target->head);
+    target->head = block;
+    target->count++;
+    pool->bytes += bytes;
+    pool->blocks++;
+  }
+
+  return target != NULL;
+}
+
+void s21_set_matrix_pool(size_t max_bytes) {
+  atomic_store(&_limit, max_bytes);
+  if (_local != NULL && _local->bytes > max_bytes) {
+    _trim(_local);
+  }
+}
+
+void s21_matrix_pool_trim(void) {
+  if (_local != NULL) {
+    _trim(_local);
+  }
+}
+
+void s21_matrix_pool_stats(s21_matrix_pool_stats_t *stats) {
+  if (stats != NULL) {
+    memset(stats, 0, sizeof(*stats));
+    if (_local != NULL) {
+      stats->hits = _local->hits;
+      stats->misses = _local->misses;
+      stats->retained_bytes = _local->bytes;
+      stats->retained_blocks = _local->blocks;
+    }
+  }
+}
@@ -0,0 +1,160 @@
+#include "../include/s21_helpers.h"
+#include "../include/s21_matrix.h"
+
+/* An optimal parenthesization: split[i * count + j] is the last factor of
+   the left operand of the outermost product of factors i .. j. */
+typedef struct chain_struct {
+  matrix_t **factors;
+  int count;
+  const int *split;
+  s21_arena_t *arena;
+} chain_t;
+
+static int _chain_invalid(int count, matrix_t **chain) {
+  int invalid = count < 1 || chain == NULL;
+  for (int i = 0; !invalid && i < count; i++) {
+    invalid = _validation_matrix(chain[i]);
+  }
+  return invalid;
+}
+
+static int _chain_conforms(int count, matrix_t **chain) {
+  int conforms = 1;
+  for (int i = 1; conforms && i < count; i++) {
+    conforms = chain[i - 1]->columns == chain[i]->rows;
+  }
+  return conforms;
+}
+
+/* Classic O(count^3) dynamic programme over the dimension vector; fills
+   `split` and returns the flop count of the whole chain, two per
+   multiply-add. */
+static double _chain_plan(matrix_t **chain, int count, int *split,
+                          double *cost) {
+  for (int i = 0; i < count; i++) {
+    cost[i * count + i] = 0.0;
+  }
+  for (int len = 2; len <= count; len++) {
+    for (int i = 0; i + len <= count; i++) {
+      int j = i + len - 1;
+      double rows = chain[i]->rows, columns = chain[j]->columns;
+      double best = -1.0;
+      for (int s = i; s < j; s++) {
+        double c = cost[i * count + s] + cost[(s + 1) * count + j] +
+                   2.0 * rows * chain[s]->columns * columns;
+        if (best < 0.0 || c < best) {
+          best = c;
+          split[i * count + j] = s;
+        }
+      }
+      cost[i * count + j] = best;
+    }
+  }
+  return cost[count - 1];
+}
+
+/* Row pointers of a dense rows x columns temporary in the arena. */
+static double **_chain_temp(s21_arena_t *arena, int rows, int columns) {
+  double **temp = (double **)s21_arena_alloc(
+      arena, (size_t)rows * (sizeof(double *) + columns * sizeof(double)));
+  if (temp != NULL) {
+    double *data = (double *)(temp + rows);
+    for (int i = 0; i < rows; i++) {
+      temp[i] = data + (size_t)i * columns;
+    }
+  }
+  return temp;
+}
+
+/* Operand for factors i .. j: the matrix itself for a single factor,
+   otherwise their product in a temporary. */
+static int _chain_operand(const chain_t *chain, int i, int j,
+                          double ***rows);
+
+/* C = factors i .. j, i < j. Temporaries are released on return, so the
+   arena memory of one subtree is reused by the next and the peak is that of
+   a single root-to-leaf path of the plan. */
+static int _chain_product(const chain_t *chain, int i, int j, double **c) {
+  int s = chain->split[i * chain->count + j];
+  int m = chain->factors[i]->rows;
+  int k = chain->factors[s]->columns;
+  int n = chain->factors[j]->columns;
+  s21_arena_mark_t mark = s21_arena_mark(chain->arena);
+  double **a = NULL, **b = NULL;
+
+  int error = _chain_operand(chain, i, s, &a);
+  if (!error) {
+    error = _chain_operand(chain, s + 1, j, &b);
+  }
+  if (!error) {
+    error = _use_strassen(m, n, k)
+                ? _strassen(m, n, k, a, b, c)
+                : _gemm_scaled(m, n, k, 1.0, a, b, 0.0, c);
+  }
+
+  s21_arena_release(chain->arena, mark);
+  return error;
+}
+
+static int _chain_operand(const chain_t *chain, int i, int j,
+                          double ***rows) {
+  int error = S21_OK;
+  if (i == j) {
+    *rows = chain->factors[i]->matrix;
+  } else {
+    *rows = _chain_temp(chain->arena, chain->factors[i]->rows,
+                        chain->factors[j]->columns);
+    error = *rows == NULL ? S21_INCORRECT_MATRIX
+                          : _chain_product(chain, i, j, *rows);
+  }
+  return error;
+}
+
+int s21_mult_chain(int count, matrix_t **chain, matrix_t *result,
+                   double *flops) {
+  if (_chain_invalid(count, chain) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (!_chain_conforms(count, chain)) {
+    error = S21_CALC_ERROR;
+  }
+
+  s21_arena_t *arena = _arena();
+  s21_arena_mark_t mark = s21_arena_mark(arena);
+  size_t cells = (size_t)count * count;
+  int *split = NULL;
+  double *cost = NULL;
+
+  if (!error) {
+    split = (int *)s21_arena_alloc(arena, cells * sizeof(int));
+    cost = (double *)s21_arena_alloc(arena, cells * sizeof(double));
+    if (split == NULL || cost == NULL) {
+      error = S21_INCORRECT_MATRIX;
+    }
+  }
+
+  if (!error) {
+    double planned = _chain_plan(chain, count, split, cost);
+    if (flops != NULL) {
+      *flops = planned;
+    }
+    error = _create_matrix(chain[0]->rows, chain[count - 1]->columns, result,
+                           0);
+  }
+
+  if (!error && count == 1) {
+    _copy_rows(chain[0], result);
+  } else if (!error) {
+    chain_t plan = {chain, count, split, arena};
+    error = _chain_product(&plan, 0, count - 1, result->matrix);
+    if (error) {
+      s21_remove_matrix(result);
+    }
+  }
+
+  s21_arena_release(arena, mark);
+  return error;
+}
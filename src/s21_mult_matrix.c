@@ -1,6 +1,23 @@
+#include <string.h>
+
 #include "../include/s21_helpers.h"
 #include "../include/s21_matrix.h"
 
+static int _is_small_square(const matrix_t *A, const matrix_t *B) {
+  return A->rows >= 2 && A->rows <= S21_SMALL_MAX && A->rows == A->columns &&
+         B->rows == B->columns && A->columns == B->rows;
+}
+
+/* C = A * B for C not sharing storage with A or B, by Strassen-Winograd
+   when the product is above the configured threshold. */
+static int _product(matrix_t *A, matrix_t *B, matrix_t *C) {
+  int m = A->rows, n = B->columns, k = A->columns;
+  return _use_strassen(m, n, k)
+             ? _strassen(m, n, k, A->matrix, B->matrix, C->matrix)
+             : _gemm_scaled(m, n, k, 1.0, A->matrix, B->matrix, 0.0,
+                            C->matrix);
+}
+
 int s21_mult_matrix(matrix_t *A, matrix_t *B, matrix_t *result) {
   if (_validation_matrix(A) || _validation_matrix(B) || result == NULL) {
     return S21_INCORRECT_MATRIX;
@@ -12,17 +29,168 @@ int s21_mult_matrix(matrix_t *A, matrix_t *B, matrix_t *result) {
     error = S21_CALC_ERROR;
   }
 
+  int small = !error && _is_small_square(A, B);
+
   if (!error) {
-    error = s21_create_matrix(A->rows, B->columns, result);
+    error = _create_matrix(A->rows, B->columns, result, 0);
+  }
+
+  if (!error && small) {
+    _mult_small(A->matrix, B->matrix, result->matrix, A->rows);
+  } else if (!error) {
+    error = _product(A, B, result);
+    if (error) {
+      s21_remove_matrix(result);
+    }
+  }
+
+  return error;
+}
+
+static int _trans_flag(int trans) {
+  return trans == S21_NO_TRANS || trans == S21_TRANS;
+}
+
+/* Rows and columns of op(X). */
+static int _op_rows(const matrix_t *X, int trans) {
+  return trans ? X->columns : X->rows;
+}
+
+static int _op_columns(const matrix_t *X, int trans) {
+  return trans ? X->rows : X->columns;
+}
+
+/* C = alpha * op(A) * op(B) + beta * C through an arena buffer, for C
+   sharing storage with A/B. */
+static int _mult_via_scratch(int trans_a, int trans_b, double alpha,
+                             const matrix_t *A, const matrix_t *B,
+                             double beta, matrix_t *C) {
+  int m = C->rows;
+  int n = C->columns;
+  s21_arena_t *arena = _arena();
+  s21_arena_mark_t mark = s21_arena_mark(arena);
+  double **rows = (double **)s21_arena_alloc(arena, m * sizeof(double *));
+  double *data =
+      (double *)s21_arena_alloc(arena, (size_t)m * n * sizeof(double));
+  int error = (rows == NULL || data == NULL) ? S21_INCORRECT_MATRIX : S21_OK;
+
+  if (!error) {
+    for (int i = 0; i < m; i++) {
+      rows[i] = data + (size_t)i * n;
+    }
+    error = _gemm_trans(trans_a, trans_b, m, n, _op_columns(A, trans_a), alpha,
+                        A->matrix, B->matrix, 0.0, rows);
   }
 
-  for (int i = 0; i < A->rows && !error; i++) {
-    for (int j = 0; j < B->columns && !error; j++) {
-      for (int k = 0; k < A->columns && !error; k++) {
-        result->matrix[i][j] += A->matrix[i][k] * B->matrix[k][j];
+  for (int i = 0; i < m && !error; i++) {
+    double *c_row = C->matrix[i];
+    const double *t_row = rows[i];
+    if (beta == 0.0) {
+      memcpy(c_row, t_row, (size_t)n * sizeof(double));
+    } else {
+      for (int j = 0; j < n; j++) {
+        c_row[j] = beta * c_row[j] + t_row[j];
       }
     }
   }
 
+  s21_arena_release(arena, mark);
+  return error;
+}
+
+static int _gemm_into(int trans_a, int trans_b, double alpha, matrix_t *A,
+                      matrix_t *B, double beta, matrix_t *C) {
+  int error = S21_OK;
+  if (_shares_storage(C, A) || _shares_storage(C, B)) {
+    error = _mult_via_scratch(trans_a, trans_b, alpha, A, B, beta, C);
+  } else {
+    error = _gemm_trans(trans_a, trans_b, C->rows, C->columns,
+                        _op_columns(A, trans_a), alpha, A->matrix, B->matrix,
+                        beta, C->matrix);
+  }
+  return error;
+}
+
+int s21_mult_matrix_into(matrix_t *A, matrix_t *B, matrix_t *result) {
+  if (_validation_matrix(A) || _validation_matrix(B) ||
+      _validation_matrix(result)) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (A->columns != B->rows || result->rows != A->rows ||
+      result->columns != B->columns) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    if (_is_small_square(A, B)) {
+      _mult_small(A->matrix, B->matrix, result->matrix, A->rows);
+    } else if (!_shares_storage(result, A) && !_shares_storage(result, B)) {
+      error = _product(A, B, result);
+    } else {
+      error = _gemm_into(S21_NO_TRANS, S21_NO_TRANS, 1.0, A, B, 0.0, result);
+    }
+  }
+
+  return error;
+}
+
+int s21_gemm(double alpha, matrix_t *A, matrix_t *B, double beta,
+             matrix_t *C) {
+  return s21_gemm_trans(S21_NO_TRANS, S21_NO_TRANS, alpha, A, B, beta, C);
+}
+
+int s21_mult_matrix_trans(matrix_t *A, int trans_a, matrix_t *B, int trans_b,
+                          matrix_t *result) {
+  if (_validation_matrix(A) || _validation_matrix(B) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (!_trans_flag(trans_a) || !_trans_flag(trans_b) ||
+      _op_columns(A, trans_a) != _op_rows(B, trans_b)) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    error = _create_matrix(_op_rows(A, trans_a), _op_columns(B, trans_b),
+                           result, 0);
+  }
+
+  if (!error) {
+    error = _gemm_trans(trans_a, trans_b, result->rows, result->columns,
+                        _op_columns(A, trans_a), 1.0, A->matrix, B->matrix,
+                        0.0, result->matrix);
+    if (error) {
+      s21_remove_matrix(result);
+    }
+  }
+
+  return error;
+}
+
+int s21_gemm_trans(int trans_a, int trans_b, double alpha, matrix_t *A,
+                   matrix_t *B, double beta, matrix_t *C) {
+  if (_validation_matrix(A) || _validation_matrix(B) ||
+      _validation_matrix(C)) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (!_trans_flag(trans_a) || !_trans_flag(trans_b) ||
+      _op_columns(A, trans_a) != _op_rows(B, trans_b) ||
+      C->rows != _op_rows(A, trans_a) ||
+      C->columns != _op_columns(B, trans_b)) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    error = _gemm_into(trans_a, trans_b, alpha, A, B, beta, C);
+  }
+
   return error;
-}
\ No newline at end of file
+}
@@ -1,4 +1,5 @@
 #include "../include/s21_helpers.h"
+#include "../include/s21_kernels.h"
 #include "../include/s21_matrix.h"
 
 int s21_mult_number(matrix_t *A, double number, matrix_t *result) {
@@ -8,13 +9,29 @@ int s21_mult_number(matrix_t *A, double number, matrix_t *result) {
 
   int error = S21_OK;
 
-  error = s21_create_matrix(A->rows, A->columns, result);
+  error = _create_matrix(A->rows, A->columns, result, 0);
 
-  for (int i = 0; i < A->rows && !error; i++) {
-    for (int j = 0; j < A->columns && !error; j++) {
-      result->matrix[i][j] = A->matrix[i][j] * number;
-    }
+  if (!error) {
+    _apply_scale(_kernels()->scale, A, number, result);
   }
 
   return error;
-}
\ No newline at end of file
+}
+
+int s21_mult_number_into(matrix_t *A, double number, matrix_t *result) {
+  if (_validation_matrix(A) || _validation_matrix(result)) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (result->rows != A->rows || result->columns != A->columns) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    _apply_scale(_kernels()->scale, A, number, result);
+  }
+
+  return error;
+}
@@ -0,0 +1,275 @@
+#include <string.h>
+
+#include "../include/s21_helpers.h"
+
+#define S21_PACKED_BLOCK 256
+
+static int _layout_invalid(int n, int kind, int uplo) {
+  return n < 1 || kind < S21_PACKED_SYMMETRIC ||
+         kind > S21_PACKED_UNIT_TRIANGULAR ||
+         (uplo != S21_PACKED_LOWER && uplo != S21_PACKED_UPPER);
+}
+
+int _packed_invalid(const s21_packed_t *A) {
+  return A == NULL || _layout_invalid(A->n, A->kind, A->uplo) ||
+         A->data == NULL;
+}
+
+/* Offset of element (i, 0) of row i as if the row were complete. */
+static size_t _row_base(const s21_packed_t *A, int i) {
+  size_t k = (size_t)i;
+  return A->uplo == S21_PACKED_LOWER ? k * (k + 1) / 2
+                                     : k * A->n - k * (k - 1) / 2 - k;
+}
+
+static int _stored(const s21_packed_t *A, int row, int column) {
+  return A->uplo == S21_PACKED_LOWER ? column <= row : column >= row;
+}
+
+/* First and one-past-last stored columns of row i. */
+static void _row_span(const s21_packed_t *A, int i, int *first, int *last) {
+  *first = A->uplo == S21_PACKED_LOWER ? 0 : i;
+  *last = A->uplo == S21_PACKED_LOWER ? i + 1 : A->n;
+}
+
+void _packed_rows(const s21_packed_t *A, double **rows) {
+  for (int i = 0; i < A->n; i++) {
+    rows[i] = A->data + _row_base(A, i);
+  }
+}
+
+int s21_packed_create(int n, int kind, int uplo, s21_packed_t *result) {
+  if (_layout_invalid(n, kind, uplo) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  double *data = (double *)calloc((size_t)n * (n + 1) / 2, sizeof(double));
+  if (data == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  result->n = n;
+  result->kind = kind;
+  result->uplo = uplo;
+  result->data = data;
+  return S21_OK;
+}
+
+int s21_packed_from_dense(matrix_t *A, int kind, int uplo,
+                          s21_packed_t *result) {
+  if (_validation_matrix(A) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (A->rows != A->columns) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    error = s21_packed_create(A->rows, kind, uplo, result);
+  }
+
+  for (int i = 0; !error && i < A->rows; i++) {
+    int first = 0;
+    int last = 0;
+    _row_span(result, i, &first, &last);
+    memcpy(result->data + _row_base(result, i) + first, A->matrix[i] + first,
+           (size_t)(last - first) * sizeof(double));
+  }
+
+  return error;
+}
+
+int s21_packed_to_dense(const s21_packed_t *A, matrix_t *result) {
+  if (_packed_invalid(A) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = _create_matrix(A->n, A->n, result, 1);
+
+  for (int i = 0; !error && i < A->n; i++) {
+    int first = 0;
+    int last = 0;
+    _row_span(A, i, &first, &last);
+    const double *row = A->data + _row_base(A, i);
+    memcpy(result->matrix[i] + first, row + first,
+           (size_t)(last - first) * sizeof(double));
+    for (int j = first; A->kind == S21_PACKED_SYMMETRIC && j < last; j++) {
+      result->matrix[j][i] = row[j];
+    }
+    if (A->kind == S21_PACKED_UNIT_TRIANGULAR) {
+      result->matrix[i][i] = 1.0;
+    }
+  }
+
+  return error;
+}
+
+int s21_packed_get(const s21_packed_t *A, int row, int column,
+                   double *value) {
+  if (_packed_invalid(A) || value == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  if (row < 0 || row >= A->n || column < 0 || column >= A->n) {
+    return S21_CALC_ERROR;
+  }
+
+  if (A->kind == S21_PACKED_UNIT_TRIANGULAR && row == column) {
+    *value = 1.0;
+  } else if (_stored(A, row, column)) {
+    *value = A->data[_row_base(A, row) + column];
+  } else if (A->kind == S21_PACKED_SYMMETRIC) {
+    *value = A->data[_row_base(A, column) + row];
+  } else {
+    *value = 0.0;
+  }
+
+  return S21_OK;
+}
+
+int s21_packed_set(s21_packed_t *A, int row, int column, double value) {
+  if (_packed_invalid(A)) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  if (row < 0 || row >= A->n || column < 0 || column >= A->n ||
+      (A->kind != S21_PACKED_SYMMETRIC && !_stored(A, row, column)) ||
+      (A->kind == S21_PACKED_UNIT_TRIANGULAR && row == column)) {
+    return S21_CALC_ERROR;
+  }
+
+  if (_stored(A, row, column)) {
+    A->data[_row_base(A, row) + column] = value;
+  } else {
+    A->data[_row_base(A, column) + row] = value;
+  }
+
+  return S21_OK;
+}
+
+/* Expands the diagonal block b0 .. b0 + m - 1 into the dense m x m tile:
+   mirrored when symmetric, zero outside the triangle otherwise. */
+static void _packed_diagonal(const s21_packed_t *A, double **rows, int b0,
+                             int m, double **tile) {
+  for (int i = 0; i < m; i++) {
+    for (int j = 0; j < m; j++) {
+      int row = b0 + i;
+      int column = b0 + j;
+      if (_stored(A, row, column)) {
+        tile[i][j] = rows[row][column];
+      } else if (A->kind == S21_PACKED_SYMMETRIC) {
+        tile[i][j] = rows[column][row];
+      } else {
+        tile[i][j] = 0.0;
+      }
+    }
+    if (A->kind == S21_PACKED_UNIT_TRIANGULAR) {
+      tile[i][i] = 1.0;
+    }
+  }
+}
+
+/* C = op(A) * B by blocks of the stored triangle: the off-diagonal block
+   A(I, J) adds A(I, J) * B(J) to C(I) and, for symmetric matrices or A^T,
+   A(I, J)^T * B(I) to C(J). Diagonal blocks are expanded into a dense tile
+   so that every flop goes through the packed GEMM. */
+static int _packed_product(const s21_packed_t *A, int trans, double **rows,
+                           double **block, double **tile, double **b,
+                           double **c, int k) {
+  int n = A->n;
+  int symmetric = A->kind == S21_PACKED_SYMMETRIC;
+  int direct = symmetric || !trans;
+  int mirror = symmetric || trans;
+  int error = S21_OK;
+
+  for (int i0 = 0; !error && i0 < n; i0 += S21_PACKED_BLOCK) {
+    int mi = n - i0 < S21_PACKED_BLOCK ? n - i0 : S21_PACKED_BLOCK;
+    int j0 = A->uplo == S21_PACKED_LOWER ? 0 : i0 + mi;
+    int j1 = A->uplo == S21_PACKED_LOWER ? i0 : n;
+    for (; !error && j0 < j1; j0 += S21_PACKED_BLOCK) {
+      int mj = j1 - j0 < S21_PACKED_BLOCK ? j1 - j0 : S21_PACKED_BLOCK;
+      for (int i = 0; i < mi; i++) {
+        block[i] = rows[i0 + i] + j0;
+      }
+      if (direct) {
+        error = _gemm_trans(0, 0, mi, k, mj, 1.0, block, b + j0, 1.0,
+                            c + i0);
+      }
+      if (!error && mirror) {
+        error = _gemm_trans(1, 0, mj, k, mi, 1.0, block, b + i0, 1.0,
+                            c + j0);
+      }
+    }
+    if (!error) {
+      _packed_diagonal(A, rows, i0, mi, tile);
+      error = _gemm_trans(trans && !symmetric, 0, mi, k, mi, 1.0, tile,
+                          b + i0, 1.0, c + i0);
+    }
+  }
+
+  return error;
+}
+
+int s21_packed_mult_dense(const s21_packed_t *A, int trans, matrix_t *B,
+                          matrix_t *result) {
+  if (_packed_invalid(A) || _validation_matrix(B) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+  int n = A->n;
+
+  if (B->rows != n || (trans != S21_NO_TRANS && trans != S21_TRANS)) {
+    error = S21_CALC_ERROR;
+  }
+
+  s21_arena_t *arena = _arena();
+  s21_arena_mark_t mark = s21_arena_mark(arena);
+  int order = n < S21_PACKED_BLOCK ? n : S21_PACKED_BLOCK;
+  double **rows = NULL;
+  double *tile = NULL;
+
+  if (!error) {
+    rows = (double **)s21_arena_alloc(
+        arena, ((size_t)n + 2 * order) * sizeof(double *));
+    tile = (double *)s21_arena_alloc(arena,
+                                     (size_t)order * order * sizeof(double));
+    if (rows == NULL || tile == NULL) {
+      error = S21_INCORRECT_MATRIX;
+    }
+  }
+
+  if (!error) {
+    error = _create_matrix(n, B->columns, result, 1);
+  }
+
+  if (!error) {
+    double **tile_rows = rows + n + order;
+    for (int i = 0; i < order; i++) {
+      tile_rows[i] = tile + (size_t)i * order;
+    }
+    _packed_rows(A, rows);
+    error = _packed_product(A, trans, rows, rows + n, tile_rows, B->matrix,
+                            result->matrix, B->columns);
+    if (error) {
+      s21_remove_matrix(result);
+    }
+  }
+
+  s21_arena_release(arena, mark);
+
+  return error;
+}
+
+void s21_packed_free(s21_packed_t *A) {
+  if (A != NULL) {
+    free(A->data);
+    A->data = NULL;
+    A->n = 0;
+    A->kind = S21_PACKED_SYMMETRIC;
+    A->uplo = S21_PACKED_LOWER;
+  }
+}
@@ -0,0 +1,124 @@
+#include <string.h>
+
+#include "../include/s21_helpers.h"
+
+/* Pivot-ratio test on the diagonal, the same one the dense solvers use. */
+static int _packed_singular(const s21_packed_t *A, double *const *rows,
+                            double *diagonal) {
+  int singular = 0;
+  if (A->kind != S21_PACKED_UNIT_TRIANGULAR) {
+    for (int i = 0; i < A->n; i++) {
+      diagonal[i] = rows[i][i];
+    }
+    singular = !_pivots_well_conditioned(diagonal, A->n, 1, 0);
+  }
+  return singular;
+}
+
+int s21_packed_trsm(const s21_packed_t *A, int trans, matrix_t *B,
+                    matrix_t *result) {
+  if (_packed_invalid(A) || _validation_matrix(B) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+  int n = A->n;
+
+  if (A->kind == S21_PACKED_SYMMETRIC || B->rows != n ||
+      (trans != S21_NO_TRANS && trans != S21_TRANS)) {
+    error = S21_CALC_ERROR;
+  }
+
+  s21_arena_t *arena = _arena();
+  s21_arena_mark_t mark = s21_arena_mark(arena);
+  double **rows = NULL;
+
+  if (!error) {
+    rows = (double **)s21_arena_alloc(
+        arena, (size_t)n * (sizeof(double *) + sizeof(double)));
+    if (rows == NULL) {
+      error = S21_INCORRECT_MATRIX;
+    }
+  }
+
+  if (!error) {
+    _packed_rows(A, rows);
+    if (_packed_singular(A, rows, (double *)(rows + n))) {
+      error = S21_CALC_ERROR;
+    }
+  }
+
+  if (!error) {
+    error = _create_matrix(n, B->columns, result, 0);
+  }
+
+  if (!error) {
+    _copy_rows(B, result);
+    error = _trsm(n, rows, A->uplo == S21_PACKED_UPPER, trans,
+                  A->kind == S21_PACKED_UNIT_TRIANGULAR, result->matrix,
+                  result->columns);
+    if (error) {
+      s21_remove_matrix(result);
+    }
+  }
+
+  s21_arena_release(arena, mark);
+
+  return error;
+}
+
+/* Packs one triangle of a row-major n x n factor buffer; the stored rows
+   follow each other without gaps. */
+static void _pack_factor(const double *a, s21_packed_t *result) {
+  int n = result->n;
+  double *dst = result->data;
+  for (int i = 0; i < n; i++) {
+    int first = result->uplo == S21_PACKED_LOWER ? 0 : i;
+    int last = result->uplo == S21_PACKED_LOWER ? i + 1 : n;
+    memcpy(dst, a + (size_t)i * n + first,
+           (size_t)(last - first) * sizeof(double));
+    dst += last - first;
+  }
+}
+
+int s21_packed_from_lu(const s21_lu_t *lu, s21_packed_t *lower,
+                       s21_packed_t *upper) {
+  if (lu == NULL || lu->n < 1 || lu->lu == NULL || lower == NULL ||
+      upper == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = s21_packed_create(lu->n, S21_PACKED_UNIT_TRIANGULAR,
+                                S21_PACKED_LOWER, lower);
+
+  if (!error) {
+    error = s21_packed_create(lu->n, S21_PACKED_TRIANGULAR, S21_PACKED_UPPER,
+                              upper);
+    if (error) {
+      s21_packed_free(lower);
+    }
+  }
+
+  if (!error) {
+    _pack_factor(lu->lu, lower);
+    _pack_factor(lu->lu, upper);
+  }
+
+  return error;
+}
+
+int s21_packed_from_cholesky(const s21_cholesky_t *factor,
+                             s21_packed_t *result) {
+  if (factor == NULL || factor->n < 1 || factor->l == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = s21_packed_create(factor->n, S21_PACKED_TRIANGULAR,
+                                S21_PACKED_LOWER, result);
+
+  if (!error) {
+    _pack_factor(factor->l, result);
+  }
+
+  return error;
+}
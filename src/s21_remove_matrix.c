@@ -1,13 +1,21 @@
+#include "../include/s21_helpers.h"
 #include "../include/s21_matrix.h"
 
 void s21_remove_matrix(matrix_t *A) {
   if (A != NULL && A->matrix != NULL) {
-    for (int i = 0; i < A->rows; i++) {
-      free(A->matrix[i]);
+    if (_is_aligned_block(A)) {
+      _aligned_free(A->matrix, A->rows);
+    } else if (!_is_single_block(A)) {
+      for (int i = 0; i < A->rows; i++) {
+        free(A->matrix[i]);
+      }
+      free(A->matrix);
+    } else if (A->columns <= 0 || !_is_dense(A) ||
+               !_recycle_put(A->matrix, A->rows, A->columns)) {
+      free(A->matrix);
     }
-    free(A->matrix);
     A->matrix = NULL;
     A->rows = 0;
     A->columns = 0;
   }
-}
\ No newline at end of file
+}
@@ -0,0 +1,399 @@
+#include <float.h>
+#include <string.h>
+
+#include "../include/s21_helpers.h"
+#include "../include/s21_kernels.h"
+#include "../include/s21_matrix.h"
+
+#define S21_BATCH_LANES 8
+#define S21_BATCH_DET 0
+#define S21_BATCH_INVERSE 1
+#define S21_BATCH_MULT 2
+
+#define S21_INLINE static inline __attribute__((always_inline))
+
+/* Fully unrolled kernels for matrices up to 4x4 on row-major value arrays.
+   The 4x4 forms share the 2x2 sub-determinants of the top two rows (s) and
+   bottom two rows (c), as in the Laplace expansion by complementary minors.
+   They are always inlined so that the batched drivers below, which apply
+   them to one matrix per SIMD lane, vectorize across matrices. */
+
+S21_INLINE double _det_values(int n, const double *a) {
+  double det = a[0];
+  if (n == 2) {
+    det = a[0] * a[3] - a[1] * a[2];
+  } else if (n == 3) {
+    det = a[0] * (a[4] * a[8] - a[5] * a[7]) -
+          a[1] * (a[3] * a[8] - a[5] * a[6]) +
+          a[2] * (a[3] * a[7] - a[4] * a[6]);
+  } else if (n == 4) {
+    double s0 = a[0] * a[5] - a[4] * a[1];
+    double s1 = a[0] * a[6] - a[4] * a[2];
+    double s2 = a[0] * a[7] - a[4] * a[3];
+    double s3 = a[1] * a[6] - a[5] * a[2];
+    double s4 = a[1] * a[7] - a[5] * a[3];
+    double s5 = a[2] * a[7] - a[6] * a[3];
+    double c5 = a[10] * a[15] - a[14] * a[11];
+    double c4 = a[9] * a[15] - a[13] * a[11];
+    double c3 = a[9] * a[14] - a[13] * a[10];
+    double c2 = a[8] * a[15] - a[12] * a[11];
+    double c1 = a[8] * a[14] - a[12] * a[10];
+    double c0 = a[8] * a[13] - a[12] * a[9];
+    det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+  }
+  return det;
+}
+
+S21_INLINE double _adjugate2(const double *a, double *adj) {
+  adj[0] = a[3];
+  adj[1] = -a[1];
+  adj[2] = -a[2];
+  adj[3] = a[0];
+  return a[0] * a[3] - a[1] * a[2];
+}
+
+S21_INLINE double _adjugate3(const double *a, double *adj) {
+  adj[0] = a[4] * a[8] - a[5] * a[7];
+  adj[1] = a[2] * a[7] - a[1] * a[8];
+  adj[2] = a[1] * a[5] - a[2] * a[4];
+  adj[3] = a[5] * a[6] - a[3] * a[8];
+  adj[4] = a[0] * a[8] - a[2] * a[6];
+  adj[5] = a[2] * a[3] - a[0] * a[5];
+  adj[6] = a[3] * a[7] - a[4] * a[6];
+  adj[7] = a[1] * a[6] - a[0] * a[7];
+  adj[8] = a[0] * a[4] - a[1] * a[3];
+  return a[0] * adj[0] + a[1] * adj[3] + a[2] * adj[6];
+}
+
+S21_INLINE double _adjugate4(const double *a, double *adj) {
+  double s0 = a[0] * a[5] - a[4] * a[1];
+  double s1 = a[0] * a[6] - a[4] * a[2];
+  double s2 = a[0] * a[7] - a[4] * a[3];
+  double s3 = a[1] * a[6] - a[5] * a[2];
+  double s4 = a[1] * a[7] - a[5] * a[3];
+  double s5 = a[2] * a[7] - a[6] * a[3];
+  double c5 = a[10] * a[15] - a[14] * a[11];
+  double c4 = a[9] * a[15] - a[13] * a[11];
+  double c3 = a[9] * a[14] - a[13] * a[10];
+  double c2 = a[8] * a[15] - a[12] * a[11];
+  double c1 = a[8] * a[14] - a[12] * a[10];
+  double c0 = a[8] * a[13] - a[12] * a[9];
+
+  adj[0] = a[5] * c5 - a[6] * c4 + a[7] * c3;
+  adj[1] = -a[1] * c5 + a[2] * c4 - a[3] * c3;
+  adj[2] = a[13] * s5 - a[14] * s4 + a[15] * s3;
+  adj[3] = -a[9] * s5 + a[10] * s4 - a[11] * s3;
+  adj[4] = -a[4] * c5 + a[6] * c2 - a[7] * c1;
+  adj[5] = a[0] * c5 - a[2] * c2 + a[3] * c1;
+  adj[6] = -a[12] * s5 + a[14] * s2 - a[15] * s1;
+  adj[7] = a[8] * s5 - a[10] * s2 + a[11] * s1;
+  adj[8] = a[4] * c4 - a[5] * c2 + a[7] * c0;
+  adj[9] = -a[0] * c4 + a[1] * c2 - a[3] * c0;
+  adj[10] = a[12] * s4 - a[13] * s2 + a[15] * s0;
+  adj[11] = -a[8] * s4 + a[9] * s2 - a[11] * s0;
+  adj[12] = -a[4] * c3 + a[5] * c1 - a[6] * c0;
+  adj[13] = a[0] * c3 - a[1] * c1 + a[2] * c0;
+  adj[14] = -a[12] * s3 + a[13] * s1 - a[14] * s0;
+  adj[15] = a[8] * s3 - a[9] * s1 + a[10] * s0;
+
+  return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+}
+
+S21_INLINE double _adjugate_values(int n, const double *a, double *adj) {
+  double det = a[0];
+  if (n == 1) {
+    adj[0] = 1.0;
+  } else if (n == 2) {
+    det = _adjugate2(a, adj);
+  } else if (n == 3) {
+    det = _adjugate3(a, adj);
+  } else {
+    det = _adjugate4(a, adj);
+  }
+  return det;
+}
+
+S21_INLINE void _mult_values(int n, const double *a, const double *b,
+                             double *c) {
+#pragma GCC unroll 4
+  for (int i = 0; i < n; i++) {
+#pragma GCC unroll 4
+    for (int j = 0; j < n; j++) {
+      double sum = a[i * n] * b[j];
+#pragma GCC unroll 4
+      for (int k = 1; k < n; k++) {
+        sum += a[i * n + k] * b[k * n + j];
+      }
+      c[i * n + j] = sum;
+    }
+  }
+}
+
+/* Product of the row 1-norms, an upper bound of |det| (Hadamard). */
+S21_INLINE double _row_norm_product(int n, const double *a) {
+  double bound = 1.0;
+#pragma GCC unroll 4
+  for (int i = 0; i < n; i++) {
+    double sum = 0.0;
+#pragma GCC unroll 4
+    for (int j = 0; j < n; j++) {
+      sum += fabs(a[i * n + j]);
+    }
+    bound *= sum;
+  }
+  return bound;
+}
+
+/* A determinant within rounding of zero relative to its Hadamard bound
+   marks a singular matrix, whatever the scale of the entries. */
+S21_INLINE int _negligible_det(int n, double det, double bound) {
+  return !(fabs(det) > n * DBL_EPSILON * bound);
+}
+
+static void _load(double *const *a, int n, double *values) {
+  for (int i = 0; i < n; i++) {
+    memcpy(values + i * n, a[i], (size_t)n * sizeof(double));
+  }
+}
+
+double _det_small(double *const *a, int n) {
+  double values[S21_SMALL_MAX * S21_SMALL_MAX] = {0.0};
+  _load(a, n, values);
+  return _det_values(n, values);
+}
+
+double _adjugate_small(double *const *a, int n, double *adj) {
+  double values[S21_SMALL_MAX * S21_SMALL_MAX] = {0.0};
+  _load(a, n, values);
+  return _adjugate_values(n, values, adj);
+}
+
+int _small_singular(double *const *a, int n, double det) {
+  double values[S21_SMALL_MAX * S21_SMALL_MAX] = {0.0};
+  _load(a, n, values);
+  return _negligible_det(n, det, _row_norm_product(n, values));
+}
+
+void _mult_small(double *const *a, double *const *b, double **c, int n) {
+  double x[S21_SMALL_MAX * S21_SMALL_MAX] = {0.0};
+  double y[S21_SMALL_MAX * S21_SMALL_MAX] = {0.0};
+  double z[S21_SMALL_MAX * S21_SMALL_MAX];
+  _load(a, n, x);
+  _load(b, n, y);
+  if (n == 2) {
+    _mult_values(2, x, y, z);
+  } else if (n == 3) {
+    _mult_values(3, x, y, z);
+  } else {
+    _mult_values(4, x, y, z);
+  }
+  for (int i = 0; i < n; i++) {
+    memcpy(c[i], z + i * n, (size_t)n * sizeof(double));
+  }
+}
+
+/*======================================================================
+    BATCHED STRUCTURE-OF-ARRAYS KERNELS
+======================================================================*/
+
+/* One chunk of S21_BATCH_LANES matrices. Element e of lane l is read from
+   a[e * stride + l] and written to out[e * S21_BATCH_LANES + l]; the output
+   is a local block, so it never aliases the inputs. The determinant of lane
+   l goes to det[l]; inversion also leaves its Hadamard bound in
+   det[S21_BATCH_LANES + l]. */
+typedef void (*batch_chunk_t)(int op, int n, const double *restrict a,
+                              const double *restrict b, long stride,
+                              double *restrict out, double *restrict det);
+
+S21_INLINE void _chunk_lanes(int op, int n, const double *restrict a,
+                             const double *restrict b, long stride,
+                             double *restrict out, double *restrict det) {
+  for (int l = 0; l < S21_BATCH_LANES; l++) {
+    double x[S21_SMALL_MAX * S21_SMALL_MAX];
+    double z[S21_SMALL_MAX * S21_SMALL_MAX];
+#pragma GCC unroll 16
+    for (int e = 0; e < n * n; e++) {
+      x[e] = a[e * stride + l];
+    }
+    if (op == S21_BATCH_DET) {
+      det[l] = _det_values(n, x);
+    } else if (op == S21_BATCH_INVERSE) {
+      det[l] = _adjugate_values(n, x, z);
+      det[S21_BATCH_LANES + l] = _row_norm_product(n, x);
+      double scale = 1.0 / det[l];
+#pragma GCC unroll 16
+      for (int e = 0; e < n * n; e++) {
+        out[e * S21_BATCH_LANES + l] = z[e] * scale;
+      }
+    } else {
+      double y[S21_SMALL_MAX * S21_SMALL_MAX];
+#pragma GCC unroll 16
+      for (int e = 0; e < n * n; e++) {
+        y[e] = b[e * stride + l];
+      }
+      _mult_values(n, x, y, z);
+#pragma GCC unroll 16
+      for (int e = 0; e < n * n; e++) {
+        out[e * S21_BATCH_LANES + l] = z[e];
+      }
+    }
+  }
+}
+
+/* Expands the lane loop once per (operation, order) pair with constants. */
+S21_INLINE void _chunk_dispatch(int op, int n, const double *restrict a,
+                                const double *restrict b, long stride,
+                                double *restrict out, double *restrict det) {
+  if (op == S21_BATCH_DET) {
+    if (n == 2) {
+      _chunk_lanes(S21_BATCH_DET, 2, a, b, stride, out, det);
+    } else if (n == 3) {
+      _chunk_lanes(S21_BATCH_DET, 3, a, b, stride, out, det);
+    } else {
+      _chunk_lanes(S21_BATCH_DET, 4, a, b, stride, out, det);
+    }
+  } else if (op == S21_BATCH_INVERSE) {
+    if (n == 2) {
+      _chunk_lanes(S21_BATCH_INVERSE, 2, a, b, stride, out, det);
+    } else if (n == 3) {
+      _chunk_lanes(S21_BATCH_INVERSE, 3, a, b, stride, out, det);
+    } else {
+      _chunk_lanes(S21_BATCH_INVERSE, 4, a, b, stride, out, det);
+    }
+  } else {
+    if (n == 2) {
+      _chunk_lanes(S21_BATCH_MULT, 2, a, b, stride, out, det);
+    } else if (n == 3) {
+      _chunk_lanes(S21_BATCH_MULT, 3, a, b, stride, out, det);
+    } else {
+      _chunk_lanes(S21_BATCH_MULT, 4, a, b, stride, out, det);
+    }
+  }
+}
+
+static void _chunk_scalar(int op, int n, const double *restrict a,
+                          const double *restrict b, long stride,
+                          double *restrict out, double *restrict det) {
+  _chunk_dispatch(op, n, a, b, stride, out, det);
+}
+
+#if S21_HAVE_X86_SIMD
+S21_TARGET_AVX2 static void _chunk_avx2(int op, int n, const double *restrict a,
+                                        const double *restrict b, long stride,
+                                        double *restrict out,
+                                        double *restrict det) {
+  _chunk_dispatch(op, n, a, b, stride, out, det);
+}
+
+S21_TARGET_AVX512 static void _chunk_avx512(int op, int n,
+                                            const double *restrict a,
+                                            const double *restrict b,
+                                            long stride, double *restrict out,
+                                            double *restrict det) {
+  _chunk_dispatch(op, n, a, b, stride, out, det);
+}
+#endif
+
+static batch_chunk_t _chunk_kernel(void) {
+  batch_chunk_t chunk = _chunk_scalar;
+#if S21_HAVE_X86_SIMD
+  int isa = _kernels()->isa;
+  if (isa == S21_ISA_AVX512) {
+    chunk = _chunk_avx512;
+  } else if (isa == S21_ISA_AVX2) {
+    chunk = _chunk_avx2;
+  }
+#endif
+  return chunk;
+}
+
+/* Runs `op` over `count` matrices stored element-major with stride `count`.
+   The last partial chunk is staged through zero-padded local buffers. */
+static int _batch(int op, int n, int count, const double *a, const double *b,
+                  double *out, double *det, int *status) {
+  enum { BLOCK = S21_SMALL_MAX * S21_SMALL_MAX * S21_BATCH_LANES };
+  batch_chunk_t chunk = _chunk_kernel();
+  int elements = n * n;
+  int singular = 0;
+
+  for (int k0 = 0; k0 < count; k0 += S21_BATCH_LANES) {
+    int lanes = count - k0 < S21_BATCH_LANES ? count - k0 : S21_BATCH_LANES;
+    double block[BLOCK];
+    double chunk_det[2 * S21_BATCH_LANES];
+
+    if (lanes == S21_BATCH_LANES) {
+      chunk(op, n, a + k0, b != NULL ? b + k0 : NULL, count, block, chunk_det);
+    } else {
+      double ta[BLOCK] = {0.0};
+      double tb[BLOCK] = {0.0};
+      for (int e = 0; e < elements; e++) {
+        memcpy(ta + e * S21_BATCH_LANES, a + (size_t)e * count + k0,
+               (size_t)lanes * sizeof(double));
+        if (b != NULL) {
+          memcpy(tb + e * S21_BATCH_LANES, b + (size_t)e * count + k0,
+                 (size_t)lanes * sizeof(double));
+        }
+      }
+      chunk(op, n, ta, tb, S21_BATCH_LANES, block, chunk_det);
+    }
+
+    if (op == S21_BATCH_DET) {
+      memcpy(det + k0, chunk_det, (size_t)lanes * sizeof(double));
+    } else {
+      for (int e = 0; e < elements; e++) {
+        memcpy(out + (size_t)e * count + k0, block + e * S21_BATCH_LANES,
+               (size_t)lanes * sizeof(double));
+      }
+    }
+
+    if (op == S21_BATCH_INVERSE) {
+      for (int l = 0; l < lanes; l++) {
+        int error =
+            _negligible_det(n, chunk_det[l], chunk_det[S21_BATCH_LANES + l])
+                ? S21_CALC_ERROR
+                : S21_OK;
+        if (error) {
+          singular = 1;
+          for (int e = 0; e < elements; e++) {
+            out[(size_t)e * count + k0 + l] = NAN;
+          }
+        }
+        if (status != NULL) {
+          status[k0 + l] = error;
+        }
+      }
+    }
+  }
+
+  return singular ? S21_CALC_ERROR : S21_OK;
+}
+
+static int _batch_invalid(int n, int count, const void *a, const void *out) {
+  return n < 2 || n > S21_SMALL_MAX || count < 0 || a == NULL || out == NULL;
+}
+
+int s21_batch_determinant(int n, int count, const double *A, double *result) {
+  if (_batch_invalid(n, count, A, result)) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  return _batch(S21_BATCH_DET, n, count, A, NULL, NULL, result, NULL);
+}
+
+int s21_batch_inverse(int n, int count, const double *A, double *result,
+                      int *status) {
+  if (_batch_invalid(n, count, A, result)) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  return _batch(S21_BATCH_INVERSE, n, count, A, NULL, result, NULL, status);
+}
+
+int s21_batch_mult(int n, int count, const double *A, const double *B,
+                   double *result) {
+  if (_batch_invalid(n, count, A, result) || B == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  return _batch(S21_BATCH_MULT, n, count, A, B, result, NULL, NULL);
+}
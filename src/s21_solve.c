@@ -0,0 +1,211 @@
+#include "../include/s21_helpers.h"
+#include "../include/s21_matrix.h"
+
+static int _lu_invalid(const s21_lu_t *lu) {
+  return lu == NULL || lu->n < 1 || lu->lu == NULL || lu->pivots == NULL;
+}
+
+static int _lu_singular(const double *lu, int n) {
+  return !_well_conditioned(lu, n, 0);
+}
+
+/* Overwrites X, which holds the right-hand side, with the solution. The
+   factor is a Cholesky one when there are no pivots. */
+static void _substitute(const double *lu, int n, const int *pivots,
+                        matrix_t *X) {
+  int vector = X->columns == 1 && _is_dense(X);
+  if (pivots == NULL && vector) {
+    _cholesky_solve_vector(lu, n, X->matrix[0]);
+  } else if (pivots == NULL) {
+    _cholesky_solve(lu, n, X->matrix, X->columns);
+  } else if (vector) {
+    _lu_solve_vector(lu, n, pivots, X->matrix[0]);
+  } else {
+    _lu_solve(lu, n, pivots, X->matrix, X->columns);
+  }
+}
+
+int s21_lu_factor(matrix_t *A, s21_lu_t *lu) {
+  if (_validation_matrix(A) || lu == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+  int n = A->rows;
+  double *factors = NULL;
+
+  if (A->rows != A->columns) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    factors = (double *)malloc((size_t)n * n * sizeof(double) +
+                               (size_t)n * sizeof(int));
+    if (factors == NULL) {
+      error = S21_INCORRECT_MATRIX;
+    }
+  }
+
+  if (!error) {
+    lu->n = n;
+    lu->lu = factors;
+    lu->pivots = (int *)(factors + (size_t)n * n);
+    _copy_to_buffer(A, lu->lu);
+    lu->sign = _lu_decompose(lu->lu, n, lu->pivots);
+  }
+
+  return error;
+}
+
+int s21_lu_solve(const s21_lu_t *lu, matrix_t *B, matrix_t *result) {
+  if (_lu_invalid(lu) || _validation_matrix(B) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (B->rows != lu->n || _lu_singular(lu->lu, lu->n)) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    error = _create_matrix(B->rows, B->columns, result, 0);
+  }
+
+  if (!error) {
+    _copy_rows(B, result);
+    _substitute(lu->lu, lu->n, lu->pivots, result);
+  }
+
+  return error;
+}
+
+int s21_lu_solve_into(const s21_lu_t *lu, matrix_t *B, matrix_t *result) {
+  if (_lu_invalid(lu) || _validation_matrix(B) || _validation_matrix(result)) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (B->rows != lu->n || result->rows != B->rows ||
+      result->columns != B->columns || _lu_singular(lu->lu, lu->n)) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    if (result->matrix[0] != B->matrix[0]) {
+      _copy_rows(B, result);
+    }
+    _substitute(lu->lu, lu->n, lu->pivots, result);
+  }
+
+  return error;
+}
+
+int s21_lu_determinant(const s21_lu_t *lu, double *result) {
+  if (_lu_invalid(lu) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  *result = _lu_determinant(lu->lu, lu->n, lu->sign);
+
+  return S21_OK;
+}
+
+int s21_lu_log_determinant(const s21_lu_t *lu, int *sign, double *result) {
+  if (_lu_invalid(lu) || sign == NULL || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  *result = _lu_log_determinant(lu->lu, lu->n, lu->sign, sign);
+
+  return S21_OK;
+}
+
+int s21_lu_inverse(const s21_lu_t *lu, matrix_t *result) {
+  if (_lu_invalid(lu) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+  int n = lu->n;
+
+  if (_lu_singular(lu->lu, n)) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    error = s21_create_matrix(n, n, result);
+  }
+
+  if (!error) {
+    for (int i = 0; i < n; i++) {
+      result->matrix[i][i] = 1.0;
+    }
+    _lu_solve(lu->lu, n, lu->pivots, result->matrix, n);
+  }
+
+  return error;
+}
+
+void s21_lu_free(s21_lu_t *lu) {
+  if (lu != NULL) {
+    free(lu->lu);
+    lu->lu = NULL;
+    lu->pivots = NULL;
+    lu->n = 0;
+    lu->sign = 1;
+  }
+}
+
+int s21_solve(matrix_t *A, matrix_t *B, matrix_t *result) {
+  if (_validation_matrix(A) || _validation_matrix(B) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+  int n = A->rows;
+
+  if (A->rows != A->columns || B->rows != n) {
+    error = S21_CALC_ERROR;
+  }
+
+  double *lu = NULL;
+  s21_arena_t *arena = _arena();
+  s21_arena_mark_t mark = s21_arena_mark(arena);
+
+  if (!error) {
+    lu = (double *)s21_arena_alloc(
+        arena, (size_t)n * n * sizeof(double) + (size_t)n * sizeof(int));
+    if (lu == NULL) {
+      error = S21_INCORRECT_MATRIX;
+    }
+  }
+
+  int *pivots = NULL;
+  if (!error && _spd_factor(A, lu)) {
+    if (!_well_conditioned(lu, n, 1)) {
+      error = S21_CALC_ERROR;
+    }
+  } else if (!error) {
+    pivots = (int *)(lu + (size_t)n * n);
+    _copy_to_buffer(A, lu);
+    _lu_decompose(lu, n, pivots);
+    if (_lu_singular(lu, n)) {
+      error = S21_CALC_ERROR;
+    }
+  }
+
+  if (!error) {
+    error = _create_matrix(n, B->columns, result, 0);
+  }
+
+  if (!error) {
+    _copy_rows(B, result);
+    _substitute(lu, n, pivots, result);
+  }
+
+  s21_arena_release(arena, mark);
+
+  return error;
+}
@@ -0,0 +1,466 @@
+#include <limits.h>
+#include <string.h>
+
+#include "../include/s21_helpers.h"
+#include "../include/s21_kernels.h"
+#include "../include/s21_matrix.h"
+
+static int _format_invalid(int format) {
+  return format != S21_SPARSE_CSR && format != S21_SPARSE_CSC;
+}
+
+int _sparse_invalid(const s21_sparse_t *A) {
+  return A == NULL || A->rows < 1 || A->columns < 1 || A->nnz < 0 ||
+         _format_invalid(A->format) || A->offsets == NULL ||
+         A->indices == NULL || A->values == NULL;
+}
+
+int _sparse_major(const s21_sparse_t *A) {
+  return A->format == S21_SPARSE_CSR ? A->rows : A->columns;
+}
+
+static int _sparse_minor(const s21_sparse_t *A) {
+  return A->format == S21_SPARSE_CSR ? A->columns : A->rows;
+}
+
+int _sparse_alloc(int rows, int columns, int format, int nnz,
+                  s21_sparse_t *result) {
+  int major = format == S21_SPARSE_CSR ? rows : columns;
+  double *block = (double *)malloc((size_t)nnz * sizeof(double) +
+                                   (size_t)nnz * sizeof(int) +
+                                   (size_t)(major + 1) * sizeof(int));
+  if (block == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  result->rows = rows;
+  result->columns = columns;
+  result->format = format;
+  result->nnz = nnz;
+  result->values = block;
+  result->indices = (int *)(block + nnz);
+  result->offsets = result->indices + nnz;
+  return S21_OK;
+}
+
+/* Turns per-slot counts in offsets[1 .. n] into start positions. */
+static void _prefix_sum(int *offsets, int n) {
+  offsets[0] = 0;
+  for (int i = 0; i < n; i++) {
+    offsets[i + 1] += offsets[i];
+  }
+}
+
+/* After entries were placed with offsets[i]++ as the cursor of slot i, every
+   offset has advanced to the start of the next slot; shift them back. */
+static void _restore_offsets(int *offsets, int n) {
+  memmove(offsets + 1, offsets, (size_t)n * sizeof(int));
+  offsets[0] = 0;
+}
+
+void _sparse_transpose(int major, int minor, const int *offsets,
+                       const int *indices, const double *values,
+                       int *t_offsets, int *t_indices, double *t_values) {
+  memset(t_offsets, 0, (size_t)(minor + 1) * sizeof(int));
+  for (int p = 0; p < offsets[major]; p++) {
+    t_offsets[indices[p] + 1]++;
+  }
+  _prefix_sum(t_offsets, minor);
+
+  for (int i = 0; i < major; i++) {
+    for (int p = offsets[i]; p < offsets[i + 1]; p++) {
+      int q = t_offsets[indices[p]]++;
+      t_indices[q] = i;
+      t_values[q] = values[p];
+    }
+  }
+  _restore_offsets(t_offsets, minor);
+}
+
+/* Arrays of a major x minor compressed matrix with room for nnz entries. */
+static int _arena_arrays(s21_arena_t *arena, int major, int nnz,
+                         s21_sparse_t *result) {
+  result->values =
+      (double *)s21_arena_alloc(arena, (size_t)nnz * sizeof(double));
+  result->indices = (int *)s21_arena_alloc(arena, (size_t)nnz * sizeof(int));
+  result->offsets =
+      (int *)s21_arena_alloc(arena, (size_t)(major + 1) * sizeof(int));
+  return result->values == NULL || result->indices == NULL ||
+                 result->offsets == NULL
+             ? S21_INCORRECT_MATRIX
+             : S21_OK;
+}
+
+int _sparse_in_format(const s21_sparse_t *A, int format, s21_arena_t *arena,
+                      s21_sparse_t *result) {
+  *result = *A;
+  if (A->format == format) {
+    return S21_OK;
+  }
+
+  result->format = format;
+  int error = _arena_arrays(arena, _sparse_minor(A), A->nnz, result);
+  if (!error) {
+    _sparse_transpose(_sparse_major(A), _sparse_minor(A), A->offsets,
+                      A->indices, A->values, result->offsets,
+                      result->indices, result->values);
+  }
+  return error;
+}
+
+static int _triplets_invalid(int rows, int columns, int nnz,
+                             const int *row_indices,
+                             const int *column_indices, const double *values,
+                             int format, const s21_sparse_t *result) {
+  return rows < 1 || columns < 1 || nnz < 0 || _format_invalid(format) ||
+         result == NULL ||
+         (nnz > 0 &&
+          (row_indices == NULL || column_indices == NULL || values == NULL));
+}
+
+static int _triplets_in_range(int rows, int columns, int nnz,
+                              const int *row_indices,
+                              const int *column_indices) {
+  int in_range = 1;
+  for (int t = 0; in_range && t < nnz; t++) {
+    in_range = row_indices[t] >= 0 && row_indices[t] < rows &&
+               column_indices[t] >= 0 && column_indices[t] < columns;
+  }
+  return in_range;
+}
+
+/* Copies sorted compressed arrays into result, summing runs of equal
+   indices. */
+static int _compress_duplicates(const s21_sparse_t *sorted, int major,
+                                s21_sparse_t *result) {
+  int unique = 0;
+  for (int i = 0; i < major; i++) {
+    for (int p = sorted->offsets[i]; p < sorted->offsets[i + 1]; p++) {
+      unique += p == sorted->offsets[i] ||
+                sorted->indices[p] != sorted->indices[p - 1];
+    }
+  }
+
+  int error = _sparse_alloc(sorted->rows, sorted->columns, sorted->format,
+                            unique, result);
+  int q = -1;
+  for (int i = 0; !error && i < major; i++) {
+    result->offsets[i] = q + 1;
+    for (int p = sorted->offsets[i]; p < sorted->offsets[i + 1]; p++) {
+      if (p == sorted->offsets[i] ||
+          sorted->indices[p] != sorted->indices[p - 1]) {
+        result->indices[++q] = sorted->indices[p];
+        result->values[q] = sorted->values[p];
+      } else {
+        result->values[q] += sorted->values[p];
+      }
+    }
+  }
+  if (!error) {
+    result->offsets[major] = unique;
+  }
+  return error;
+}
+
+int s21_sparse_from_triplets(int rows, int columns, int nnz,
+                             const int *row_indices, const int *column_indices,
+                             const double *values, int format,
+                             s21_sparse_t *result) {
+  if (_triplets_invalid(rows, columns, nnz, row_indices, column_indices,
+                        values, format, result)) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (!_triplets_in_range(rows, columns, nnz, row_indices, column_indices)) {
+    error = S21_CALC_ERROR;
+  }
+
+  int csr = format == S21_SPARSE_CSR;
+  const int *major_of = csr ? row_indices : column_indices;
+  const int *minor_of = csr ? column_indices : row_indices;
+  int major = csr ? rows : columns;
+  int minor = csr ? columns : rows;
+  s21_arena_t *arena = _arena();
+  s21_arena_mark_t mark = s21_arena_mark(arena);
+  int other = csr ? S21_SPARSE_CSC : S21_SPARSE_CSR;
+  s21_sparse_t by_minor = {rows, columns, other, nnz, NULL, NULL, NULL};
+  s21_sparse_t sorted = {rows, columns, format, nnz, NULL, NULL, NULL};
+
+  if (!error) {
+    error = _arena_arrays(arena, minor, nnz, &by_minor);
+  }
+  if (!error) {
+    error = _arena_arrays(arena, major, nnz, &sorted);
+  }
+
+  /* Bucket by minor index in input order, then transpose, which visits the
+     buckets in order and so leaves every major slot sorted with duplicates
+     adjacent. */
+  if (!error) {
+    memset(by_minor.offsets, 0, (size_t)(minor + 1) * sizeof(int));
+    for (int t = 0; t < nnz; t++) {
+      by_minor.offsets[minor_of[t] + 1]++;
+    }
+    _prefix_sum(by_minor.offsets, minor);
+    for (int t = 0; t < nnz; t++) {
+      int q = by_minor.offsets[minor_of[t]]++;
+      by_minor.indices[q] = major_of[t];
+      by_minor.values[q] = values[t];
+    }
+    _restore_offsets(by_minor.offsets, minor);
+    _sparse_transpose(minor, major, by_minor.offsets, by_minor.indices,
+                      by_minor.values, sorted.offsets, sorted.indices,
+                      sorted.values);
+    error = _compress_duplicates(&sorted, major, result);
+  }
+
+  s21_arena_release(arena, mark);
+  return error;
+}
+
+int s21_sparse_from_dense(matrix_t *A, int format, s21_sparse_t *result) {
+  if (_validation_matrix(A) || _format_invalid(format) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int csr = format == S21_SPARSE_CSR;
+  int major = csr ? A->rows : A->columns;
+  int nnz = 0;
+  for (int i = 0; i < A->rows; i++) {
+    for (int j = 0; j < A->columns; j++) {
+      nnz += A->matrix[i][j] != 0.0;
+    }
+  }
+
+  int error = _sparse_alloc(A->rows, A->columns, format, nnz, result);
+
+  /* Row-major traversal keeps the indices of every slot ascending in both
+     formats. */
+  if (!error) {
+    int *offsets = result->offsets;
+    memset(offsets, 0, (size_t)(major + 1) * sizeof(int));
+    for (int i = 0; i < A->rows; i++) {
+      for (int j = 0; j < A->columns; j++) {
+        offsets[(csr ? i : j) + 1] += A->matrix[i][j] != 0.0;
+      }
+    }
+    _prefix_sum(offsets, major);
+    for (int i = 0; i < A->rows; i++) {
+      for (int j = 0; j < A->columns; j++) {
+        if (A->matrix[i][j] != 0.0) {
+          int q = offsets[csr ? i : j]++;
+          result->indices[q] = csr ? j : i;
+          result->values[q] = A->matrix[i][j];
+        }
+      }
+    }
+    _restore_offsets(offsets, major);
+  }
+
+  return error;
+}
+
+int s21_sparse_to_dense(const s21_sparse_t *A, matrix_t *result) {
+  if (_sparse_invalid(A) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = _create_matrix(A->rows, A->columns, result, 1);
+  int csr = A->format == S21_SPARSE_CSR;
+
+  for (int i = 0; !error && i < _sparse_major(A); i++) {
+    for (int p = A->offsets[i]; p < A->offsets[i + 1]; p++) {
+      int row = csr ? i : A->indices[p];
+      int column = csr ? A->indices[p] : i;
+      result->matrix[row][column] = A->values[p];
+    }
+  }
+
+  return error;
+}
+
+static void _copy_arrays(const s21_sparse_t *A, s21_sparse_t *result) {
+  memcpy(result->offsets, A->offsets,
+         (size_t)(_sparse_major(A) + 1) * sizeof(int));
+  memcpy(result->indices, A->indices, (size_t)A->nnz * sizeof(int));
+  memcpy(result->values, A->values, (size_t)A->nnz * sizeof(double));
+}
+
+int s21_sparse_convert(const s21_sparse_t *A, int format,
+                       s21_sparse_t *result) {
+  if (_sparse_invalid(A) || _format_invalid(format) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = _sparse_alloc(A->rows, A->columns, format, A->nnz, result);
+
+  if (!error && format == A->format) {
+    _copy_arrays(A, result);
+  } else if (!error) {
+    _sparse_transpose(_sparse_major(A), _sparse_minor(A), A->offsets,
+                      A->indices, A->values, result->offsets,
+                      result->indices, result->values);
+  }
+
+  return error;
+}
+
+int s21_sparse_get(const s21_sparse_t *A, int row, int column,
+                   double *value) {
+  if (_sparse_invalid(A) || value == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  if (row < 0 || row >= A->rows || column < 0 || column >= A->columns) {
+    return S21_CALC_ERROR;
+  }
+
+  int csr = A->format == S21_SPARSE_CSR;
+  int slot = csr ? row : column;
+  int index = csr ? column : row;
+  int lo = A->offsets[slot], hi = A->offsets[slot + 1];
+  while (lo < hi) {
+    int mid = lo + (hi - lo) / 2;
+    if (A->indices[mid] < index) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  *value = lo < A->offsets[slot + 1] && A->indices[lo] == index
+               ? A->values[lo]
+               : 0.0;
+
+  return S21_OK;
+}
+
+int s21_sparse_transpose(const s21_sparse_t *A, s21_sparse_t *result) {
+  if (_sparse_invalid(A) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  /* The other-format arrays of A are the same-format arrays of A^T. */
+  int error = _sparse_alloc(A->columns, A->rows, A->format, A->nnz, result);
+  if (!error) {
+    _sparse_transpose(_sparse_major(A), _sparse_minor(A), A->offsets,
+                      A->indices, A->values, result->offsets,
+                      result->indices, result->values);
+  }
+
+  return error;
+}
+
+/* Length of the merged pattern of slot i of A and B. */
+static int _merged_length(const s21_sparse_t *A, const s21_sparse_t *B,
+                          int i) {
+  int p = A->offsets[i], p_end = A->offsets[i + 1];
+  int q = B->offsets[i], q_end = B->offsets[i + 1];
+  int length = 0;
+  while (p < p_end && q < q_end) {
+    int a = A->indices[p], b = B->indices[q];
+    p += a <= b;
+    q += b <= a;
+    length++;
+  }
+  return length + (p_end - p) + (q_end - q);
+}
+
+static void _merge(const s21_sparse_t *A, const s21_sparse_t *B, double sign,
+                   int i, s21_sparse_t *result) {
+  int p = A->offsets[i], p_end = A->offsets[i + 1];
+  int q = B->offsets[i], q_end = B->offsets[i + 1];
+  int r = result->offsets[i];
+  while (p < p_end || q < q_end) {
+    int a = p < p_end ? A->indices[p] : INT_MAX;
+    int b = q < q_end ? B->indices[q] : INT_MAX;
+    double value = 0.0;
+    if (a <= b) {
+      value = A->values[p++];
+    }
+    if (b <= a) {
+      value += sign * B->values[q++];
+    }
+    result->indices[r] = a < b ? a : b;
+    result->values[r++] = value;
+  }
+}
+
+static int _sparse_add(const s21_sparse_t *A, const s21_sparse_t *B,
+                       double sign, s21_sparse_t *result) {
+  if (_sparse_invalid(A) || _sparse_invalid(B) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (A->rows != B->rows || A->columns != B->columns) {
+    error = S21_CALC_ERROR;
+  }
+
+  int major = _sparse_major(A);
+  s21_arena_t *arena = _arena();
+  s21_arena_mark_t mark = s21_arena_mark(arena);
+  s21_sparse_t b;
+  long long nnz = 0;
+
+  if (!error) {
+    error = _sparse_in_format(B, A->format, arena, &b);
+  }
+  for (int i = 0; !error && i < major; i++) {
+    nnz += _merged_length(A, &b, i);
+  }
+  if (!error && nnz > INT_MAX) {
+    error = S21_INCORRECT_MATRIX;
+  }
+
+  if (!error) {
+    error = _sparse_alloc(A->rows, A->columns, A->format, (int)nnz, result);
+  }
+  if (!error) {
+    result->offsets[0] = 0;
+    for (int i = 0; i < major; i++) {
+      result->offsets[i + 1] = result->offsets[i] + _merged_length(A, &b, i);
+      _merge(A, &b, sign, i, result);
+    }
+  }
+
+  s21_arena_release(arena, mark);
+  return error;
+}
+
+int s21_sparse_sum(const s21_sparse_t *A, const s21_sparse_t *B,
+                   s21_sparse_t *result) {
+  return _sparse_add(A, B, 1.0, result);
+}
+
+int s21_sparse_sub(const s21_sparse_t *A, const s21_sparse_t *B,
+                   s21_sparse_t *result) {
+  return _sparse_add(A, B, -1.0, result);
+}
+
+int s21_sparse_mult_number(const s21_sparse_t *A, double number,
+                           s21_sparse_t *result) {
+  if (_sparse_invalid(A) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = _sparse_alloc(A->rows, A->columns, A->format, A->nnz, result);
+  if (!error) {
+    _copy_arrays(A, result);
+    _kernels()->scale(A->values, number, result->values, A->nnz);
+  }
+
+  return error;
+}
+
+void s21_sparse_free(s21_sparse_t *A) {
+  if (A != NULL) {
+    free(A->values);
+    A->values = NULL;
+    A->indices = NULL;
+    A->offsets = NULL;
+    A->nnz = 0;
+  }
+}
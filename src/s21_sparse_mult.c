@@ -0,0 +1,325 @@
+#include <limits.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../include/s21_helpers.h"
+#include "../include/s21_kernels.h"
+#include "../include/s21_thread_pool.h"
+
+/* C = A * B with sparse A and dense B. CSR splits the rows of C, each one a
+   combination of rows of B; CSC splits the columns of C, scattering every
+   column of A times a row of B. `x` and `y` are B and C themselves when both
+   are single contiguous columns, which saves a row-pointer load per entry. */
+typedef struct spmm_struct {
+  const kernels_t *kern;
+  const s21_sparse_t *a;
+  double *const *b;
+  const double *x;
+  double *y;
+  double **c;
+  int n;
+  int chunk;
+} spmm_t;
+
+static void _spmm_rows(const spmm_t *g, int i0, int i1) {
+  const s21_sparse_t *a = g->a;
+  for (int i = i0; i < i1; i++) {
+    double *c = g->c[i];
+    int p = a->offsets[i], end = a->offsets[i + 1];
+    if (g->x != NULL) {
+      double sum = 0.0;
+      for (; p < end; p++) {
+        sum += a->values[p] * g->x[a->indices[p]];
+      }
+      c[0] = sum;
+      continue;
+    }
+    for (; p + S21_KERNEL_GEMV_ROWS <= end; p += S21_KERNEL_GEMV_ROWS) {
+      const double *rows[S21_KERNEL_GEMV_ROWS];
+      for (int r = 0; r < S21_KERNEL_GEMV_ROWS; r++) {
+        rows[r] = g->b[a->indices[p + r]];
+      }
+      g->kern->axpy4(rows, a->values + p, c, g->n);
+    }
+    for (; p < end; p++) {
+      const double *row = g->b[a->indices[p]];
+      double f = a->values[p];
+      for (int j = 0; j < g->n; j++) {
+        c[j] += f * row[j];
+      }
+    }
+  }
+}
+
+static void _spmm_columns(const spmm_t *g, int j0, int j1) {
+  const s21_sparse_t *a = g->a;
+  for (int k = 0; k < a->columns; k++) {
+    if (g->x != NULL) {
+      double f = g->x[k];
+      for (int p = a->offsets[k]; p < a->offsets[k + 1]; p++) {
+        g->y[a->indices[p]] += a->values[p] * f;
+      }
+      continue;
+    }
+    const double *row = g->b[k] + j0;
+    for (int p = a->offsets[k]; p < a->offsets[k + 1]; p++) {
+      double f = a->values[p];
+      double *c = g->c[a->indices[p]] + j0;
+      for (int j = 0; j < j1 - j0; j++) {
+        c[j] += f * row[j];
+      }
+    }
+  }
+}
+
+static void _spmm_task(void *ctx, int task, int worker) {
+  (void)worker;
+  const spmm_t *g = (const spmm_t *)ctx;
+  int csr = g->a->format == S21_SPARSE_CSR;
+  int extent = csr ? g->a->rows : g->n;
+  int first = task * g->chunk;
+  int last = first + g->chunk < extent ? first + g->chunk : extent;
+  if (csr) {
+    _spmm_rows(g, first, last);
+  } else {
+    _spmm_columns(g, first, last);
+  }
+}
+
+static int _spmm_parallel(spmm_t *g) {
+  int threads = _pool_size();
+  int extent = g->a->format == S21_SPARSE_CSR ? g->a->rows : g->n;
+  int done = 0;
+
+  if (threads > 1 && extent >= 2 &&
+      (long long)g->a->nnz * g->n >= _pool_threshold()) {
+    int tasks = 4 * threads < extent ? 4 * threads : extent;
+    g->chunk = (extent + tasks - 1) / tasks;
+    tasks = (extent + g->chunk - 1) / g->chunk;
+    done = _pool_run(tasks, _spmm_task, g) > 0;
+  }
+
+  return done;
+}
+
+int s21_sparse_mult_dense(const s21_sparse_t *A, matrix_t *B,
+                          matrix_t *result) {
+  if (_sparse_invalid(A) || _validation_matrix(B) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (A->columns != B->rows) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    error = _create_matrix(A->rows, B->columns, result, 1);
+  }
+
+  if (!error) {
+    spmm_t g = {_kernels(), A, B->matrix, NULL, NULL, result->matrix,
+                B->columns, 0};
+    if (B->columns == 1 && _is_dense(B) && _is_dense(result)) {
+      g.x = B->matrix[0];
+      g.y = result->matrix[0];
+    }
+    int serial = !_spmm_parallel(&g);
+    if (serial && A->format == S21_SPARSE_CSR) {
+      _spmm_rows(&g, 0, A->rows);
+    } else if (serial) {
+      _spmm_columns(&g, 0, g.n);
+    }
+  }
+
+  return error;
+}
+
+/* C = L * R in compressed-row terms: slot i of C combines the slots of R
+   named by slot i of L. For CSC operands L and R are B and A, since the CSC
+   arrays of A * B are the CSR arrays of B^T * A^T. */
+typedef struct spgemm_struct {
+  const s21_sparse_t *l;
+  const s21_sparse_t *r;
+  int minor;
+  int numeric;
+  int *offsets;
+  int *indices;
+  double *values;
+  int chunk;
+  atomic_int failed;
+} spgemm_t;
+
+static int _compare_index(const void *a, const void *b) {
+  int x = *(const int *)a, y = *(const int *)b;
+  return (x > y) - (x < y);
+}
+
+/* Slots [i0, i1) of C. The symbolic pass stores the length of slot i in
+   offsets[i + 1]; the numeric pass fills it through the dense accumulator
+   `acc`. `mark[j] == i` flags column j as already present in slot i. */
+static void _spgemm_rows(const spgemm_t *g, int i0, int i1, int *mark,
+                         double *acc) {
+  const s21_sparse_t *l = g->l, *r = g->r;
+  for (int j = 0; j < g->minor; j++) {
+    mark[j] = -1;
+  }
+
+  for (int i = i0; i < i1; i++) {
+    int length = 0;
+    int *indices = g->numeric ? g->indices + g->offsets[i] : NULL;
+    for (int p = l->offsets[i]; p < l->offsets[i + 1]; p++) {
+      int k = l->indices[p];
+      double f = l->values[p];
+      for (int q = r->offsets[k]; q < r->offsets[k + 1]; q++) {
+        int j = r->indices[q];
+        if (mark[j] != i) {
+          mark[j] = i;
+          if (g->numeric) {
+            indices[length] = j;
+            acc[j] = 0.0;
+          }
+          length++;
+        }
+        if (g->numeric) {
+          acc[j] += f * r->values[q];
+        }
+      }
+    }
+
+    if (g->numeric) {
+      qsort(indices, (size_t)length, sizeof(int), _compare_index);
+      double *values = g->values + g->offsets[i];
+      for (int t = 0; t < length; t++) {
+        values[t] = acc[indices[t]];
+      }
+    } else {
+      g->offsets[i + 1] = length;
+    }
+  }
+}
+
+static size_t _spgemm_scratch_bytes(const spgemm_t *g) {
+  return (size_t)g->minor * (sizeof(double) + sizeof(int));
+}
+
+static void _spgemm_task(void *ctx, int task, int worker) {
+  spgemm_t *g = (spgemm_t *)ctx;
+  int major = _sparse_major(g->l);
+  int first = task * g->chunk;
+  int last = first + g->chunk < major ? first + g->chunk : major;
+  double *acc = (double *)_pool_scratch(worker, _spgemm_scratch_bytes(g));
+  if (acc != NULL) {
+    _spgemm_rows(g, first, last, (int *)(acc + g->minor), acc);
+  } else {
+    atomic_store(&g->failed, 1);
+  }
+}
+
+/* Runs one pass over all slots; `parallel` chooses the pool. */
+static int _spgemm_pass(spgemm_t *g, int parallel) {
+  int major = _sparse_major(g->l);
+  int done = 0;
+  if (parallel) {
+    int tasks = (major + g->chunk - 1) / g->chunk;
+    done = _pool_run(tasks, _spgemm_task, g) > 0;
+  }
+
+  int error = done && atomic_load(&g->failed) ? S21_INCORRECT_MATRIX : S21_OK;
+  if (!done) {
+    s21_arena_t *arena = _arena();
+    s21_arena_mark_t mark = s21_arena_mark(arena);
+    double *acc = (double *)s21_arena_alloc(arena, _spgemm_scratch_bytes(g));
+    if (acc == NULL) {
+      error = S21_INCORRECT_MATRIX;
+    } else {
+      _spgemm_rows(g, 0, major, (int *)(acc + g->minor), acc);
+    }
+    s21_arena_release(arena, mark);
+  }
+  return error;
+}
+
+/* Multiply-adds of the product, for the parallel cutoff. */
+static long long _spgemm_work(const s21_sparse_t *l, const s21_sparse_t *r) {
+  long long work = 0;
+  for (int p = 0; p < l->nnz; p++) {
+    int k = l->indices[p];
+    work += r->offsets[k + 1] - r->offsets[k];
+  }
+  return work;
+}
+
+int s21_sparse_mult(const s21_sparse_t *A, const s21_sparse_t *B,
+                    s21_sparse_t *result) {
+  if (_sparse_invalid(A) || _sparse_invalid(B) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (A->columns != B->rows) {
+    error = S21_CALC_ERROR;
+  }
+
+  int csr = A->format == S21_SPARSE_CSR;
+  s21_arena_t *arena = _arena();
+  s21_arena_mark_t mark = s21_arena_mark(arena);
+  s21_sparse_t b;
+  int *counts = NULL;
+
+  if (!error) {
+    error = _sparse_in_format(B, A->format, arena, &b);
+  }
+
+  spgemm_t g = {csr ? A : &b, csr ? &b : A, 0, 0, NULL, NULL, NULL, 0, 0};
+  int major = csr ? A->rows : B->columns;
+  int parallel = 0;
+
+  if (!error) {
+    g.minor = csr ? B->columns : A->rows;
+    counts = (int *)s21_arena_alloc(arena, (size_t)(major + 1) * sizeof(int));
+    error = counts == NULL ? S21_INCORRECT_MATRIX : S21_OK;
+  }
+
+  if (!error) {
+    int threads = _pool_size();
+    parallel = threads > 1 && major >= 2 &&
+               _spgemm_work(g.l, g.r) >= _pool_threshold();
+    int tasks = 4 * threads < major ? 4 * threads : major;
+    g.chunk = (major + tasks - 1) / tasks;
+    g.offsets = counts;
+    counts[0] = 0;
+    error = _spgemm_pass(&g, parallel);
+  }
+
+  long long nnz = 0;
+  for (int i = 0; !error && i < major; i++) {
+    nnz += counts[i + 1];
+    if (nnz > INT_MAX) {
+      error = S21_INCORRECT_MATRIX;
+    }
+    counts[i + 1] = (int)nnz;
+  }
+
+  if (!error) {
+    error = _sparse_alloc(A->rows, B->columns, A->format, (int)nnz, result);
+  }
+
+  if (!error) {
+    memcpy(result->offsets, counts, (size_t)(major + 1) * sizeof(int));
+    g.numeric = 1;
+    g.offsets = result->offsets;
+    g.indices = result->indices;
+    g.values = result->values;
+    error = _spgemm_pass(&g, parallel);
+    if (error) {
+      s21_sparse_free(result);
+    }
+  }
+
+  s21_arena_release(arena, mark);
+  return error;
+}
@@ -0,0 +1,277 @@
+#include <stdatomic.h>
+
+#include "../include/s21_helpers.h"
+#include "../include/s21_kernels.h"
+#include "../include/s21_matrix.h"
+
+/* Default cutover, from `bench_strassen 2048 <cutover>` on one AVX-512 core
+   (median of 5 runs, Winograd ms / error in u |A| |B|): 256: 493 / 6325,
+   384: 523 / 4275, 512: 547 / 4275, 768: 446 / 3312, against 513 ms for
+   the classical product. Deeper recursion was no faster and less accurate.
+   Adjustable with s21_set_strassen_cutover. */
+#define S21_STRASSEN_CUTOVER 768
+
+static atomic_int _strassen_threshold = 0;
+static atomic_int _strassen_cutover = S21_STRASSEN_CUTOVER;
+
+/* A block of a row-pointer matrix: element (i, j) is rows[i][col + j]. */
+typedef struct strassen_block {
+  double **rows;
+  int col;
+} block_t;
+
+static block_t _sub(block_t x, int row, int col) {
+  block_t sub = {x.rows + row, x.col + col};
+  return sub;
+}
+
+static int _is_leaf(int m, int k, int n, int cutover) {
+  return m < 2 * cutover || k < 2 * cutover || n < 2 * cutover;
+}
+
+static size_t _dense_bytes(int rows, int cols) {
+  return (size_t)rows * (sizeof(double *) + (size_t)cols * sizeof(double));
+}
+
+/* Bytes of workspace used by _winograd for an m x k by k x n product: two
+   temporaries per level plus row pointers handed to the blocked kernel. */
+static size_t _workspace(int m, int k, int n, int cutover) {
+  size_t bytes = (size_t)(2 * m + k) * sizeof(double *);
+  if (!_is_leaf(m, k, n, cutover)) {
+    int m2 = m / 2, k2 = k / 2, n2 = n / 2;
+    bytes += _dense_bytes(m2, k2 > n2 ? k2 : n2) + _dense_bytes(k2, n2) +
+             _workspace(m2, k2, n2, cutover);
+  }
+  return bytes;
+}
+
+/* Carves a dense rows x cols temporary off the front of the workspace. */
+static block_t _dense_block(unsigned char **work, int rows, int cols) {
+  block_t x = {(double **)*work, 0};
+  double *data = (double *)(*work + (size_t)rows * sizeof(double *));
+  for (int i = 0; i < rows; i++) {
+    x.rows[i] = data + (size_t)i * cols;
+  }
+  *work += _dense_bytes(rows, cols);
+  return x;
+}
+
+/* Row pointers of `count` rows of x starting at column `col`. */
+static double **_row_pointers(block_t x, int count, int col, double **out) {
+  for (int i = 0; i < count; i++) {
+    out[i] = x.rows[i] + x.col + col;
+  }
+  return out;
+}
+
+/* dst = p + q, or p - q when `subtract` is set; dst may alias p or q. */
+static void _combine(const kernels_t *kern, block_t dst, block_t p, block_t q,
+                     int rows, int cols, int subtract) {
+  for (int i = 0; i < rows; i++) {
+    double *d = dst.rows[i] + dst.col;
+    const double *a = p.rows[i] + p.col;
+    const double *b = q.rows[i] + q.col;
+    if (subtract) {
+      kern->sub(a, b, d, cols);
+    } else {
+      kern->add(a, b, d, cols);
+    }
+  }
+}
+
+/* C = A * B through the blocked kernel. */
+static int _leaf(block_t a, block_t b, block_t c, int m, int k, int n,
+                 unsigned char *work) {
+  double **pa = _row_pointers(a, m, 0, (double **)work);
+  double **pb = _row_pointers(b, k, 0, pa + m);
+  double **pc = _row_pointers(c, m, 0, pb + k);
+  return _gemm_scaled(m, n, k, 1.0, pa, pb, 0.0, pc);
+}
+
+/* Completes C = A * B for odd dimensions once the leading even part of C
+   holds the product of the leading even parts of A and B. */
+static int _peel(block_t a, block_t b, block_t c, int m, int k, int n,
+                 unsigned char *work) {
+  int me = m & ~1, ke = k & ~1, ne = n & ~1;
+  int error = S21_OK;
+  double **pa = (double **)work;
+  double **pb = pa + m;
+  double **pc = pb + k;
+
+  if (ke < k) {
+    const double *b_row = b.rows[ke] + b.col;
+    for (int i = 0; i < me; i++) {
+      double f = a.rows[i][a.col + ke];
+      double *c_row = c.rows[i] + c.col;
+      for (int j = 0; j < ne; j++) {
+        c_row[j] += f * b_row[j];
+      }
+    }
+  }
+
+  if (ne < n) {
+    error = _gemm_scaled(m, 1, k, 1.0, _row_pointers(a, m, 0, pa),
+                         _row_pointers(b, k, ne, pb), 0.0,
+                         _row_pointers(c, m, ne, pc));
+  }
+
+  if (!error && me < m) {
+    error = _gemm_scaled(1, ne, k, 1.0, _row_pointers(_sub(a, me, 0), 1, 0, pa),
+                         _row_pointers(b, k, 0, pb), 0.0,
+                         _row_pointers(_sub(c, me, 0), 1, 0, pc));
+  }
+
+  return error;
+}
+
+/* C = A * B by Strassen-Winograd (7 half-size products, 15 additions) in
+   the two-temporary schedule of Boyer, Dumas, Pernet and Zhou; quadrants of
+   C hold intermediate products until they are combined. */
+static int _winograd(const kernels_t *kern, int cutover, block_t a, block_t b,
+                     block_t c, int m, int k, int n, unsigned char *work) {
+  if (_is_leaf(m, k, n, cutover)) {
+    return _leaf(a, b, c, m, k, n, work);
+  }
+
+  int m2 = m / 2, k2 = k / 2, n2 = n / 2;
+  unsigned char *peel = work;
+  work += (size_t)(2 * m + k) * sizeof(double *);
+  block_t x = _dense_block(&work, m2, k2 > n2 ? k2 : n2);
+  block_t y = _dense_block(&work, k2, n2);
+
+  block_t a11 = a, a12 = _sub(a, 0, k2);
+  block_t a21 = _sub(a, m2, 0), a22 = _sub(a, m2, k2);
+  block_t b11 = b, b12 = _sub(b, 0, n2);
+  block_t b21 = _sub(b, k2, 0), b22 = _sub(b, k2, n2);
+  block_t c11 = c, c12 = _sub(c, 0, n2);
+  block_t c21 = _sub(c, m2, 0), c22 = _sub(c, m2, n2);
+
+  /* C21 = P7 = (A11 - A21)(B22 - B12) */
+  _combine(kern, x, a11, a21, m2, k2, 1);
+  _combine(kern, y, b22, b12, k2, n2, 1);
+  int error = _winograd(kern, cutover, x, y, c21, m2, k2, n2, work);
+
+  /* C22 = P5 = S1 T1 with S1 = A21 + A22, T1 = B12 - B11 */
+  _combine(kern, x, a21, a22, m2, k2, 0);
+  _combine(kern, y, b12, b11, k2, n2, 1);
+  if (!error) {
+    error = _winograd(kern, cutover, x, y, c22, m2, k2, n2, work);
+  }
+
+  /* C12 = P6 = S2 T2 with S2 = S1 - A11, T2 = B22 - T1 */
+  _combine(kern, x, x, a11, m2, k2, 1);
+  _combine(kern, y, b22, y, k2, n2, 1);
+  if (!error) {
+    error = _winograd(kern, cutover, x, y, c12, m2, k2, n2, work);
+  }
+
+  /* C11 = P3 = (A12 - S2) B22, X = P1 = A11 B11 */
+  _combine(kern, x, a12, x, m2, k2, 1);
+  if (!error) {
+    error = _winograd(kern, cutover, x, b22, c11, m2, k2, n2, work);
+  }
+  if (!error) {
+    error = _winograd(kern, cutover, a11, b11, x, m2, k2, n2, work);
+  }
+
+  /* U2 = P1 + P6, U3 = U2 + P7, U4 = U2 + P5, C22 = U3 + P5,
+     C12 = U4 + P3 */
+  _combine(kern, c12, x, c12, m2, n2, 0);
+  _combine(kern, c21, c12, c21, m2, n2, 0);
+  _combine(kern, c12, c12, c22, m2, n2, 0);
+  _combine(kern, c22, c21, c22, m2, n2, 0);
+  _combine(kern, c12, c12, c11, m2, n2, 0);
+
+  /* C21 = U3 - P4 with P4 = A22 (T2 - B21) */
+  _combine(kern, y, y, b21, k2, n2, 1);
+  if (!error) {
+    error = _winograd(kern, cutover, a22, y, c11, m2, k2, n2, work);
+  }
+  _combine(kern, c21, c21, c11, m2, n2, 1);
+
+  /* C11 = P1 + P2 with P2 = A12 B21 */
+  if (!error) {
+    error = _winograd(kern, cutover, a12, b21, c11, m2, k2, n2, work);
+  }
+  _combine(kern, c11, x, c11, m2, n2, 0);
+
+  if (!error && ((m | k | n) & 1)) {
+    error = _peel(a, b, c, m, k, n, peel);
+  }
+
+  return error;
+}
+
+int _strassen(int m, int n, int k, double *const *a, double *const *b,
+              double **c) {
+  s21_arena_t *arena = _arena();
+  s21_arena_mark_t mark = s21_arena_mark(arena);
+  int cutover = atomic_load_explicit(&_strassen_cutover, memory_order_relaxed);
+  unsigned char *work =
+      (unsigned char *)s21_arena_alloc(arena, _workspace(m, k, n, cutover));
+  int error = work == NULL ? S21_INCORRECT_MATRIX : S21_OK;
+
+  if (!error) {
+    block_t ba = {(double **)a, 0}, bb = {(double **)b, 0}, bc = {c, 0};
+    error = _winograd(_kernels(), cutover, ba, bb, bc, m, k, n, work);
+  }
+
+  s21_arena_release(arena, mark);
+  return error;
+}
+
+int _use_strassen(int m, int n, int k) {
+  int threshold = atomic_load_explicit(&_strassen_threshold,
+                                       memory_order_relaxed);
+  return threshold > 0 && m >= threshold && n >= threshold && k >= threshold;
+}
+
+int s21_mult_matrix_strassen(matrix_t *A, matrix_t *B, matrix_t *result) {
+  if (_validation_matrix(A) || _validation_matrix(B) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (A->columns != B->rows) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    error = _create_matrix(A->rows, B->columns, result, 0);
+  }
+
+  if (!error) {
+    error = _strassen(A->rows, B->columns, A->columns, A->matrix, B->matrix,
+                      result->matrix);
+    if (error) {
+      s21_remove_matrix(result);
+    }
+  }
+
+  return error;
+}
+
+int s21_set_strassen_threshold(int min_order) {
+  if (min_order < 0) {
+    return S21_CALC_ERROR;
+  }
+  atomic_store(&_strassen_threshold, min_order);
+  return S21_OK;
+}
+
+int s21_get_strassen_threshold(void) {
+  return atomic_load_explicit(&_strassen_threshold, memory_order_relaxed);
+}
+
+int s21_set_strassen_cutover(int min_order) {
+  if (min_order < 1) {
+    return S21_CALC_ERROR;
+  }
+  atomic_store(&_strassen_cutover, min_order);
+  return S21_OK;
+}
+
+int s21_get_strassen_cutover(void) {
+  return atomic_load_explicit(&_strassen_cutover, memory_order_relaxed);
+}
@@ -1,4 +1,5 @@
 #include "../include/s21_helpers.h"
+#include "../include/s21_kernels.h"
 #include "../include/s21_matrix.h"
 
 int s21_sum_matrix(matrix_t *A, matrix_t *B, matrix_t *result) {
@@ -13,14 +14,32 @@ int s21_sum_matrix(matrix_t *A, matrix_t *B, matrix_t *result) {
   }
 
   if (!error) {
-    error = s21_create_matrix(A->rows, A->columns, result);
+    error = _create_matrix(A->rows, A->columns, result, 0);
   }
 
-  for (int i = 0; i < A->rows && !error; i++) {
-    for (int j = 0; j < A->columns && !error; j++) {
-      result->matrix[i][j] = A->matrix[i][j] + B->matrix[i][j];
-    }
+  if (!error) {
+    _apply_binary(_kernels()->add, A, B, result);
+  }
+
+  return error;
+}
+
+int s21_sum_matrix_into(matrix_t *A, matrix_t *B, matrix_t *result) {
+  if (_validation_matrix(A) || _validation_matrix(B) ||
+      _validation_matrix(result)) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (A->rows != B->rows || A->columns != B->columns ||
+      result->rows != A->rows || result->columns != A->columns) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    _apply_binary(_kernels()->add, A, B, result);
   }
 
   return error;
-}
\ No newline at end of file
+}
@@ -0,0 +1,255 @@
+#define _DEFAULT_SOURCE
+
+#include "../include/s21_thread_pool.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "../include/s21_matrix.h"
+
+#define S21_POOL_MAX_THREADS 256
+#define S21_POOL_DEFAULT_THRESHOLD (128LL * 128LL * 128LL)
+
+typedef struct pool_struct {
+  pthread_mutex_t lock;
+  pthread_cond_t wake;
+  pthread_cond_t done;
+  pthread_t *threads;
+  int workers;
+  int started;
+  int stop;
+  unsigned generation;
+  int running;
+  pool_task_t fn;
+  void *ctx;
+  int tasks;
+  atomic_int next;
+  void **scratch;
+  size_t *scratch_size;
+} pool_t;
+
+static pool_t _pool = {PTHREAD_MUTEX_INITIALIZER,
+                       PTHREAD_COND_INITIALIZER,
+                       PTHREAD_COND_INITIALIZER,
+                       NULL,
+                       0,
+                       0,
+                       0,
+                       0u,
+                       0,
+                       NULL,
+                       NULL,
+                       0,
+                       0,
+                       NULL,
+                       NULL};
+
+/* Held by the thread that currently owns the workers. */
+static pthread_mutex_t _owner = PTHREAD_MUTEX_INITIALIZER;
+
+static atomic_int _threads_wanted = 0;
+static atomic_int _threads_auto = 0;
+static atomic_llong _threshold = S21_POOL_DEFAULT_THRESHOLD;
+static int _atexit_registered = 0;
+
+static int _auto_threads(void) {
+  int threads = atomic_load(&_threads_auto);
+  if (threads > 0) {
+    return threads;
+  }
+  const char *env = getenv("S21_NUM_THREADS");
+  if (env != NULL) {
+    threads = atoi(env);
+  }
+  if (threads <= 0) {
+    long online = sysconf(_SC_NPROCESSORS_ONLN);
+    threads = online > 0 ? (int)online : 1;
+  }
+  threads = threads < S21_POOL_MAX_THREADS ? threads : S21_POOL_MAX_THREADS;
+  atomic_store(&_threads_auto, threads);
+  return threads;
+}
+
+static void _drain(int worker) {
+  int task;
+  while ((task = atomic_fetch_add(&_pool.next, 1)) < _pool.tasks) {
+    _pool.fn(_pool.ctx, task, worker);
+  }
+}
+
+static void *_worker(void *arg) {
+  int id = (int)(intptr_t)arg;
+  unsigned seen = 0u;
+
+  pthread_mutex_lock(&_pool.lock);
+  for (;;) {
+    while (!_pool.stop && _pool.generation == seen) {
+      pthread_cond_wait(&_pool.wake, &_pool.lock);
+    }
+    if (_pool.stop) {
+      break;
+    }
+    seen = _pool.generation;
+    pthread_mutex_unlock(&_pool.lock);
+
+    _drain(id);
+
+    pthread_mutex_lock(&_pool.lock);
+    if (--_pool.running == 0) {
+      pthread_cond_signal(&_pool.done);
+    }
+  }
+  pthread_mutex_unlock(&_pool.lock);
+
+  return NULL;
+}
+
+/* Must be called with _owner held. */
+static void _stop(void) {
+  if (_pool.started) {
+    pthread_mutex_lock(&_pool.lock);
+    _pool.stop = 1;
+    pthread_cond_broadcast(&_pool.wake);
+    pthread_mutex_unlock(&_pool.lock);
+    for (int i = 0; i < _pool.workers; i++) {
+      pthread_join(_pool.threads[i], NULL);
+    }
+  }
+  if (_pool.scratch != NULL) {
+    for (int i = 0; i <= _pool.workers; i++) {
+      free(_pool.scratch[i]);
+    }
+  }
+  free(_pool.scratch);
+  free(_pool.scratch_size);
+  free(_pool.threads);
+  _pool.scratch = NULL;
+  _pool.scratch_size = NULL;
+  _pool.threads = NULL;
+  _pool.workers = 0;
+  _pool.started = 0;
+  _pool.stop = 0;
+  _pool.generation = 0u;
+}
+
+static void _shutdown(void) {
+  pthread_mutex_lock(&_owner);
+  _stop();
+  pthread_mutex_unlock(&_owner);
+}
+
+/* Must be called with _owner held. */
+static int _start(void) {
+  int error = S21_OK;
+  int threads = _pool_size();
+  int workers = threads - 1;
+
+  _pool.threads = (pthread_t *)calloc((size_t)workers, sizeof(pthread_t));
+  _pool.scratch = (void **)calloc((size_t)threads, sizeof(void *));
+  _pool.scratch_size = (size_t *)calloc((size_t)threads, sizeof(size_t));
+  if ((workers > 0 && _pool.threads == NULL) || _pool.scratch == NULL ||
+      _pool.scratch_size == NULL) {
+    error = S21_INCORRECT_MATRIX;
+  }
+
+  for (int i = 0; i < workers && !error; i++) {
+    if (pthread_create(&_pool.threads[i], NULL, _worker,
+                       (void *)(intptr_t)(i + 1)) != 0) {
+      error = S21_INCORRECT_MATRIX;
+    } else {
+      _pool.workers = i + 1;
+    }
+  }
+  _pool.started = 1;
+
+  if (error) {
+    _stop();
+  } else if (!_atexit_registered) {
+    _atexit_registered = 1;
+    atexit(_shutdown);
+  }
+
+  return error;
+}
+
+int _pool_run(int tasks, pool_task_t fn, void *ctx) {
+  int threads = 0;
+
+  if (tasks > 1 && pthread_mutex_trylock(&_owner) == 0) {
+    int error = S21_OK;
+    if (!_pool.started) {
+      error = _start();
+    }
+
+    if (!error && _pool.workers > 0) {
+      pthread_mutex_lock(&_pool.lock);
+      _pool.fn = fn;
+      _pool.ctx = ctx;
+      _pool.tasks = tasks;
+      atomic_store(&_pool.next, 0);
+      _pool.running = _pool.workers;
+      _pool.generation++;
+      pthread_cond_broadcast(&_pool.wake);
+      pthread_mutex_unlock(&_pool.lock);
+
+      _drain(0);
+
+      pthread_mutex_lock(&_pool.lock);
+      while (_pool.running > 0) {
+        pthread_cond_wait(&_pool.done, &_pool.lock);
+      }
+      pthread_mutex_unlock(&_pool.lock);
+
+      threads = _pool.workers + 1;
+    }
+
+    pthread_mutex_unlock(&_owner);
+  }
+
+  return threads;
+}
+
+void *_pool_scratch(int worker, size_t size) {
+  size = (size + 63u) & ~(size_t)63u;
+  if (_pool.scratch_size[worker] < size) {
+    free(_pool.scratch[worker]);
+    _pool.scratch[worker] = aligned_alloc(64, size);
+    _pool.scratch_size[worker] = _pool.scratch[worker] != NULL ? size : 0;
+  }
+  return _pool.scratch[worker];
+}
+
+long long _pool_threshold(void) { return atomic_load(&_threshold); }
+
+int s21_set_num_threads(int threads) {
+  if (threads < 0) {
+    return S21_CALC_ERROR;
+  }
+
+  pthread_mutex_lock(&_owner);
+  _stop();
+  atomic_store(&_threads_wanted, threads < S21_POOL_MAX_THREADS
+                                      ? threads
+                                      : S21_POOL_MAX_THREADS);
+  pthread_mutex_unlock(&_owner);
+
+  return S21_OK;
+}
+
+int _pool_size(void) {
+  int threads = atomic_load(&_threads_wanted);
+  return threads > 0 ? threads : _auto_threads();
+}
+
+int s21_get_num_threads(void) { return _pool_size(); }
+
+int s21_set_parallel_threshold(long long min_ops) {
+  if (min_ops < 0) {
+    return S21_CALC_ERROR;
+  }
+  atomic_store(&_threshold, min_ops);
+  return S21_OK;
+}
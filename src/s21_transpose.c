@@ -1,6 +1,72 @@
+#include <string.h>
+
 #include "../include/s21_helpers.h"
 #include "../include/s21_matrix.h"
 
+#define S21_TRANSPOSE_TILE 32
+
+static void _transpose_tiles(const matrix_t *A, matrix_t *result) {
+  for (int i0 = 0; i0 < A->rows; i0 += S21_TRANSPOSE_TILE) {
+    int i1 = i0 + S21_TRANSPOSE_TILE < A->rows ? i0 + S21_TRANSPOSE_TILE
+                                                 : A->rows;
+    for (int j0 = 0; j0 < A->columns; j0 += S21_TRANSPOSE_TILE) {
+      int j1 = j0 + S21_TRANSPOSE_TILE < A->columns ? j0 + S21_TRANSPOSE_TILE
+                                                      : A->columns;
+      for (int i = i0; i < i1; i++) {
+        const double *row = A->matrix[i];
+        for (int j = j0; j < j1; j++) {
+          result->matrix[j][i] = row[j];
+        }
+      }
+    }
+  }
+}
+
+/* Swaps the tiles above the diagonal with their mirror images below it. */
+static void _transpose_square_in_place(matrix_t *A) {
+  int n = A->rows;
+  for (int i0 = 0; i0 < n; i0 += S21_TRANSPOSE_TILE) {
+    int i1 = i0 + S21_TRANSPOSE_TILE < n ? i0 + S21_TRANSPOSE_TILE : n;
+    for (int j0 = i0; j0 < n; j0 += S21_TRANSPOSE_TILE) {
+      int j1 = j0 + S21_TRANSPOSE_TILE < n ? j0 + S21_TRANSPOSE_TILE : n;
+      for (int i = i0; i < i1; i++) {
+        for (int j = j0 > i + 1 ? j0 : i + 1; j < j1; j++) {
+          double t = A->matrix[i][j];
+          A->matrix[i][j] = A->matrix[j][i];
+          A->matrix[j][i] = t;
+        }
+      }
+    }
+  }
+}
+
+/* Transposes into arena scratch first when the result may share storage
+   with A, then copies the rows over. */
+static int _transpose_via_scratch(const matrix_t *A, matrix_t *result) {
+  int m = result->rows;
+  int n = result->columns;
+  s21_arena_t *arena = _arena();
+  s21_arena_mark_t mark = s21_arena_mark(arena);
+  double **rows = (double **)s21_arena_alloc(arena, m * sizeof(double *));
+  double *data =
+      (double *)s21_arena_alloc(arena, (size_t)m * n * sizeof(double));
+  int error = (rows == NULL || data == NULL) ? S21_INCORRECT_MATRIX : S21_OK;
+
+  if (!error) {
+    for (int i = 0; i < m; i++) {
+      rows[i] = data + (size_t)i * n;
+    }
+    matrix_t scratch = {rows, m, n};
+    _transpose_tiles(A, &scratch);
+    for (int i = 0; i < m; i++) {
+      memcpy(result->matrix[i], rows[i], (size_t)n * sizeof(double));
+    }
+  }
+
+  s21_arena_release(arena, mark);
+  return error;
+}
+
 int s21_transpose(matrix_t *A, matrix_t *result) {
   if (_validation_matrix(A) || result == NULL) {
     return S21_INCORRECT_MATRIX;
@@ -8,13 +74,37 @@ int s21_transpose(matrix_t *A, matrix_t *result) {
 
   int error = S21_OK;
 
-  error = s21_create_matrix(A->columns, A->rows, result);
+  error = _create_matrix(A->columns, A->rows, result, 0);
+
+  if (!error) {
+    _transpose_tiles(A, result);
+  }
+
+  return error;
+}
+
+int s21_transpose_into(matrix_t *A, matrix_t *result) {
+  if (_validation_matrix(A) || _validation_matrix(result)) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  int in_place = result->matrix == A->matrix && A->rows == A->columns;
+
+  if (result->rows != A->columns || result->columns != A->rows) {
+    error = S21_CALC_ERROR;
+  }
 
-  for (int i = 0; i < result->rows && !error; i++) {
-    for (int j = 0; j < result->columns && !error; j++) {
-      result->matrix[i][j] += A->matrix[j][i];
+  if (!error) {
+    if (in_place) {
+      _transpose_square_in_place(result);
+    } else if (_shares_storage(A, result)) {
+      error = _transpose_via_scratch(A, result);
+    } else {
+      _transpose_tiles(A, result);
     }
   }
 
   return error;
-}
\ No newline at end of file
+}
@@ -0,0 +1,164 @@
+#include "../include/s21_helpers.h"
+
+#define S21_TRSM_BLOCK 64
+#define S21_TRSM_MIN_RHS 8
+
+/* op(T) = T or T^T, with rows t[i][j] addressing element (i, j) of T. */
+typedef struct trsm_struct {
+  double *const *t;
+  int trans;
+  int unit;
+  double **x;
+  int nrhs;
+  double **rows;
+} trsm_t;
+
+static void _sub_scaled(double *y, double f, const double *x, int n) {
+  for (int j = 0; j < n; j++) {
+    y[j] -= f * x[j];
+  }
+}
+
+static void _divide(double *y, double d, int n) {
+  for (int j = 0; j < n; j++) {
+    y[j] /= d;
+  }
+}
+
+/* Forward substitution on the diagonal block k0 .. k1 - 1 of a lower op(T).
+   The transposed case is column-oriented so rows of T stay contiguous. */
+static void _trsm_forward(const trsm_t *s, int k0, int k1) {
+  double *const *t = s->t;
+  double **x = s->x;
+  if (!s->trans) {
+    for (int i = k0; i < k1; i++) {
+      for (int k = k0; k < i; k++) {
+        _sub_scaled(x[i], t[i][k], x[k], s->nrhs);
+      }
+      if (!s->unit) {
+        _divide(x[i], t[i][i], s->nrhs);
+      }
+    }
+  } else {
+    for (int k = k0; k < k1; k++) {
+      if (!s->unit) {
+        _divide(x[k], t[k][k], s->nrhs);
+      }
+      for (int i = k + 1; i < k1; i++) {
+        _sub_scaled(x[i], t[k][i], x[k], s->nrhs);
+      }
+    }
+  }
+}
+
+/* Backward substitution on the diagonal block k0 .. k1 - 1 of an upper
+   op(T). */
+static void _trsm_backward(const trsm_t *s, int k0, int k1) {
+  double *const *t = s->t;
+  double **x = s->x;
+  if (!s->trans) {
+    for (int i = k1 - 1; i >= k0; i--) {
+      for (int k = i + 1; k < k1; k++) {
+        _sub_scaled(x[i], t[i][k], x[k], s->nrhs);
+      }
+      if (!s->unit) {
+        _divide(x[i], t[i][i], s->nrhs);
+      }
+    }
+  } else {
+    for (int k = k1 - 1; k >= k0; k--) {
+      if (!s->unit) {
+        _divide(x[k], t[k][k], s->nrhs);
+      }
+      for (int i = k0; i < k; i++) {
+        _sub_scaled(x[i], t[k][i], x[k], s->nrhs);
+      }
+    }
+  }
+}
+
+/* X[r0 .. r1) -= op(T)[r0 .. r1, k0 .. k1) * X[k0 .. k1) through the GEMM;
+   without T^T the block is read through row pointers offset to k0, with
+   it the stored block T[k0 .. k1, r0 .. r1) is multiplied transposed. */
+static void _trsm_update(const trsm_t *s, int r0, int r1, int k0, int k1) {
+  int m = r1 - r0;
+  int k = k1 - k0;
+  int error = S21_OK;
+
+  if (!s->trans) {
+    for (int i = 0; i < m; i++) {
+      s->rows[i] = s->t[r0 + i] + k0;
+    }
+  } else {
+    for (int p = 0; p < k; p++) {
+      s->rows[p] = s->t[k0 + p] + r0;
+    }
+  }
+  error = _gemm_trans(s->trans, 0, m, s->nrhs, k, -1.0, s->rows, s->x + k0,
+                      1.0, s->x + r0);
+
+  for (int i = r0; error && i < r1; i++) {
+    for (int p = k0; p < k1; p++) {
+      double f = s->trans ? s->t[p][i] : s->t[i][p];
+      _sub_scaled(s->x[i], f, s->x[p], s->nrhs);
+    }
+  }
+}
+
+int _trsm(int n, double *const *t, int upper, int trans, int unit,
+          double **x, int nrhs) {
+  trsm_t s = {t, trans, unit, x, nrhs, NULL};
+  int block = nrhs < S21_TRSM_MIN_RHS ? n : S21_TRSM_BLOCK;
+  s21_arena_t *arena = _arena();
+  s21_arena_mark_t mark = s21_arena_mark(arena);
+
+  if (block < n) {
+    s.rows = (double **)s21_arena_alloc(arena, n * sizeof(double *));
+    if (s.rows == NULL) {
+      return S21_INCORRECT_MATRIX;
+    }
+  }
+
+  if (!upper == !trans) {
+    for (int k0 = 0; k0 < n; k0 += block) {
+      int k1 = n - k0 < block ? n : k0 + block;
+      _trsm_forward(&s, k0, k1);
+      if (k1 < n) {
+        _trsm_update(&s, k1, n, k0, k1);
+      }
+    }
+  } else {
+    for (int k1 = n; k1 > 0; k1 -= block) {
+      int k0 = k1 < block ? 0 : k1 - block;
+      _trsm_backward(&s, k0, k1);
+      if (k0 > 0) {
+        _trsm_update(&s, 0, k0, k0, k1);
+      }
+    }
+  }
+
+  s21_arena_release(arena, mark);
+  return S21_OK;
+}
+
+int _trsm_dense(const double *a, int n, int upper, int trans, int unit,
+                double **x, int nrhs) {
+  if (nrhs < S21_TRSM_MIN_RHS || n <= S21_TRSM_BLOCK) {
+    return 0;
+  }
+
+  s21_arena_t *arena = _arena();
+  s21_arena_mark_t mark = s21_arena_mark(arena);
+  double **rows = (double **)s21_arena_alloc(arena, n * sizeof(double *));
+  int solved = 0;
+
+  if (rows != NULL) {
+    for (int i = 0; i < n; i++) {
+      rows[i] = (double *)a + (size_t)i * n;
+    }
+    solved = _trsm(n, rows, upper, trans, unit, x, nrhs) == S21_OK;
+  }
+
+  s21_arena_release(arena, mark);
+  return solved;
+}
@@ -0,0 +1,362 @@
+#include <math.h>
+#include <string.h>
+
+#include "../include/s21_helpers.h"
+#include "../include/s21_kernels.h"
+#include "../include/s21_matrix.h"
+
+static int _validation_view(const s21_view_t *V) {
+  return (V == NULL || V->matrix == NULL || V->rows <= 0 || V->columns <= 0);
+}
+
+static int _in_range(int first, int count, int step, int limit) {
+  long long last = (long long)first + (long long)(count - 1) * step;
+  return first >= 0 && first < limit && last >= 0 && last < limit;
+}
+
+static int _index(const int *map, int offset, int step, int skip, int k) {
+  int index = map != NULL ? map[k] : offset + k * step;
+  return (skip >= 0 && index >= skip) ? index + 1 : index;
+}
+
+static int _source_row(const s21_view_t *V, int k) {
+  return _index(V->row_map, V->row_offset, V->row_step, V->skip_row, k);
+}
+
+static int _source_column(const s21_view_t *V, int k) {
+  return _index(V->column_map, V->column_offset, V->column_step,
+                V->skip_column, k);
+}
+
+static double _at(const s21_view_t *V, int i, int j) {
+  if (V->transposed) {
+    int t = i;
+    i = j;
+    j = t;
+  }
+  return V->matrix[_source_row(V, i)][_source_column(V, j)];
+}
+
+/* Rows of the view are contiguous runs of a source row. */
+static int _rows_contiguous(const s21_view_t *V) {
+  return !V->transposed && V->column_map == NULL && V->column_step == 1 &&
+         V->skip_column < 0;
+}
+
+static const double *_row(const s21_view_t *V, int i) {
+  return V->matrix[_source_row(V, i)] + V->column_offset;
+}
+
+static void _gather(const s21_view_t *V, double *dst) {
+  for (int i = 0; i < V->rows; i++) {
+    if (_rows_contiguous(V)) {
+      memcpy(dst, _row(V, i), (size_t)V->columns * sizeof(double));
+    } else {
+      for (int j = 0; j < V->columns; j++) {
+        dst[j] = _at(V, i, j);
+      }
+    }
+    dst += V->columns;
+  }
+}
+
+/* Row pointers of the view: aliases of the source when its rows are
+   contiguous, otherwise a gathered copy. Both live in `arena`. */
+static double **_view_rows(const s21_view_t *V, s21_arena_t *arena) {
+  double **rows =
+      (double **)s21_arena_alloc(arena, (size_t)V->rows * sizeof(double *));
+  if (rows != NULL && _rows_contiguous(V)) {
+    for (int i = 0; i < V->rows; i++) {
+      rows[i] = (double *)_row(V, i);
+    }
+  } else if (rows != NULL) {
+    double *data = (double *)s21_arena_alloc(
+        arena, (size_t)V->rows * V->columns * sizeof(double));
+    if (data == NULL) {
+      rows = NULL;
+    } else {
+      _gather(V, data);
+      for (int i = 0; i < V->rows; i++) {
+        rows[i] = data + (size_t)i * V->columns;
+      }
+    }
+  }
+  return rows;
+}
+
+/* Row pointers for a product operand. A transposed view over contiguous
+   source rows is passed as those rows with `*trans` set, so the product
+   reads it transposed while packing instead of gathering a copy. */
+static double **_view_operand(const s21_view_t *V, s21_arena_t *arena,
+                              int *trans) {
+  s21_view_t source = *V;
+  source.rows = V->columns;
+  source.columns = V->rows;
+  source.transposed = 0;
+  *trans = V->transposed && _rows_contiguous(&source);
+  return _view_rows(*trans ? &source : V, arena);
+}
+
+static void _view_init(matrix_t *A, s21_view_t *view) {
+  view->matrix = A->matrix;
+  view->rows = A->rows;
+  view->columns = A->columns;
+  view->row_offset = 0;
+  view->column_offset = 0;
+  view->row_step = 1;
+  view->column_step = 1;
+  view->skip_row = -1;
+  view->skip_column = -1;
+  view->row_map = NULL;
+  view->column_map = NULL;
+  view->transposed = 0;
+}
+
+int s21_view_matrix(matrix_t *A, s21_view_t *view) {
+  if (_validation_matrix(A) || view == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  _view_init(A, view);
+
+  return S21_OK;
+}
+
+int s21_view_strided(matrix_t *A, int row, int column, int rows, int columns,
+                     int row_step, int column_step, s21_view_t *view) {
+  if (_validation_matrix(A) || view == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (rows <= 0 || columns <= 0 ||
+      !_in_range(row, rows, row_step, A->rows) ||
+      !_in_range(column, columns, column_step, A->columns)) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    _view_init(A, view);
+    view->rows = rows;
+    view->columns = columns;
+    view->row_offset = row;
+    view->column_offset = column;
+    view->row_step = row_step;
+    view->column_step = column_step;
+  }
+
+  return error;
+}
+
+int s21_view_block(matrix_t *A, int row, int column, int rows, int columns,
+                   s21_view_t *view) {
+  return s21_view_strided(A, row, column, rows, columns, 1, 1, view);
+}
+
+int s21_view_minor(matrix_t *A, int row, int column, s21_view_t *view) {
+  if (_validation_matrix(A) || view == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (A->rows < 2 || A->columns < 2 || row < 0 || row >= A->rows ||
+      column < 0 || column >= A->columns) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    _view_init(A, view);
+    view->rows = A->rows - 1;
+    view->columns = A->columns - 1;
+    view->skip_row = row;
+    view->skip_column = column;
+  }
+
+  return error;
+}
+
+static int _map_valid(const int *map, int count, int limit) {
+  int valid = 1;
+  for (int k = 0; map != NULL && valid && k < count; k++) {
+    valid = map[k] >= 0 && map[k] < limit;
+  }
+  return valid;
+}
+
+int s21_view_indexed(matrix_t *A, int rows, const int *row_map, int columns,
+                     const int *column_map, s21_view_t *view) {
+  if (_validation_matrix(A) || view == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (rows <= 0 || columns <= 0 || (row_map == NULL && rows != A->rows) ||
+      (column_map == NULL && columns != A->columns) ||
+      !_map_valid(row_map, rows, A->rows) ||
+      !_map_valid(column_map, columns, A->columns)) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    _view_init(A, view);
+    view->rows = rows;
+    view->columns = columns;
+    view->row_map = row_map;
+    view->column_map = column_map;
+  }
+
+  return error;
+}
+
+int s21_view_transpose(const s21_view_t *view, s21_view_t *result) {
+  if (_validation_view(view) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  s21_view_t source = *view;
+  *result = source;
+  result->rows = source.columns;
+  result->columns = source.rows;
+  result->transposed = !source.transposed;
+
+  return S21_OK;
+}
+
+int s21_view_get(const s21_view_t *view, int row, int column, double *value) {
+  if (_validation_view(view) || value == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (row < 0 || row >= view->rows || column < 0 || column >= view->columns) {
+    error = S21_CALC_ERROR;
+  } else {
+    *value = _at(view, row, column);
+  }
+
+  return error;
+}
+
+int s21_view_copy(const s21_view_t *view, matrix_t *result) {
+  if (_validation_view(view) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = _create_matrix(view->rows, view->columns, result, 0);
+
+  if (!error) {
+    for (int i = 0; i < view->rows; i++) {
+      double *dst = result->matrix[i];
+      if (_rows_contiguous(view)) {
+        memcpy(dst, _row(view, i), (size_t)view->columns * sizeof(double));
+      } else {
+        for (int j = 0; j < view->columns; j++) {
+          dst[j] = _at(view, i, j);
+        }
+      }
+    }
+  }
+
+  return error;
+}
+
+int s21_view_eq(const s21_view_t *A, const s21_view_t *B) {
+  if (_validation_view(A) || _validation_view(B) || A->rows != B->rows ||
+      A->columns != B->columns) {
+    return FAILURE;
+  }
+
+  int result = SUCCESS;
+
+  if (_rows_contiguous(A) && _rows_contiguous(B)) {
+    const kernels_t *kern = _kernels();
+    for (int i = 0; result && i < A->rows; i++) {
+      result = kern->eq(_row(A, i), _row(B, i), A->columns);
+    }
+  } else {
+    for (int i = 0; result && i < A->rows; i++) {
+      for (int j = 0; result && j < A->columns; j++) {
+        if (!(fabs(_at(A, i, j) - _at(B, i, j)) < S21_EPS)) {
+          result = FAILURE;
+        }
+      }
+    }
+  }
+
+  return result;
+}
+
+int s21_view_determinant(const s21_view_t *A, double *result) {
+  if (_validation_view(A) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+  int n = A->rows;
+
+  if (A->rows != A->columns) {
+    error = S21_CALC_ERROR;
+  } else if (n == 1) {
+    *result = _at(A, 0, 0);
+  } else if (n == 2) {
+    *result = _at(A, 0, 0) * _at(A, 1, 1) - _at(A, 0, 1) * _at(A, 1, 0);
+  } else {
+    s21_arena_t *arena = _arena();
+    s21_arena_mark_t mark = s21_arena_mark(arena);
+    double *lu = (double *)s21_arena_alloc(
+        arena, (size_t)n * n * sizeof(double) + (size_t)n * sizeof(int));
+    if (lu == NULL) {
+      error = S21_INCORRECT_MATRIX;
+    } else {
+      int *pivots = (int *)(lu + (size_t)n * n);
+      _gather(A, lu);
+      int sign = _lu_decompose(lu, n, pivots);
+      *result = _lu_determinant(lu, n, sign);
+    }
+    s21_arena_release(arena, mark);
+  }
+
+  return error;
+}
+
+int s21_view_mult_matrix(const s21_view_t *A, const s21_view_t *B,
+                         matrix_t *result) {
+  if (_validation_view(A) || _validation_view(B) || result == NULL) {
+    return S21_INCORRECT_MATRIX;
+  }
+
+  int error = S21_OK;
+
+  if (A->columns != B->rows) {
+    error = S21_CALC_ERROR;
+  }
+
+  if (!error) {
+    error = _create_matrix(A->rows, B->columns, result, 0);
+  }
+
+  if (!error) {
+    s21_arena_t *arena = _arena();
+    s21_arena_mark_t mark = s21_arena_mark(arena);
+    int trans_a = 0;
+    int trans_b = 0;
+    double **a = _view_operand(A, arena, &trans_a);
+    double **b = a != NULL ? _view_operand(B, arena, &trans_b) : NULL;
+    if (b == NULL) {
+      error = S21_INCORRECT_MATRIX;
+    } else {
+      error = _gemm_trans(trans_a, trans_b, A->rows, B->columns, A->columns,
+                          1.0, a, b, 0.0, result->matrix);
+    }
+    s21_arena_release(arena, mark);
+    if (error) {
+      s21_remove_matrix(result);
+    }
+  }
+
+  return error;
+}
@@ -19,6 +19,19 @@ int main(void) {
   srunner_add_suite(sr, s21_calc_complements_suite());
   srunner_add_suite(sr, s21_determinant_suite());
   srunner_add_suite(sr, s21_inverse_matrix_suite());
+  srunner_add_suite(sr, s21_isa_suite());
+  srunner_add_suite(sr, s21_parallel_suite());
+  srunner_add_suite(sr, s21_arena_suite());
+  srunner_add_suite(sr, s21_matrix_pool_suite());
+  srunner_add_suite(sr, s21_view_suite());
+  srunner_add_suite(sr, s21_batch_suite());
+  srunner_add_suite(sr, s21_solve_suite());
+  srunner_add_suite(sr, s21_cholesky_suite());
+  srunner_add_suite(sr, s21_strassen_suite());
+  srunner_add_suite(sr, s21_mult_chain_suite());
+  srunner_add_suite(sr, s21_sparse_suite());
+  srunner_add_suite(sr, s21_band_suite());
+  srunner_add_suite(sr, s21_packed_suite());
 
   //  Check for CK_RUN_SUITE and set a custom log file
   const char *suite = getenv("CK_RUN_SUITE");
@@ -0,0 +1,191 @@
+#include <check.h>
+#include <stdint.h>
+
+#include "../include/s21_matrix.h"
+#include "../include/s21_suites.h"
+#include "../include/test_helpers.h"
+
+START_TEST(test_arena_invalid_init) {
+  double buffer[2];
+  s21_arena_t arena;
+  ck_assert_int_eq(s21_arena_init(NULL, NULL, 0), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_arena_init(&arena, buffer, sizeof(buffer)),
+                   S21_INCORRECT_MATRIX);
+  ck_assert_ptr_null(s21_arena_alloc(NULL, 8));
+}
+END_TEST
+
+START_TEST(test_arena_caller_buffer) {
+  static double buffer[1024];
+  s21_arena_t arena;
+  ck_assert_int_eq(s21_arena_init(&arena, buffer, sizeof(buffer)), S21_OK);
+
+  char *a = s21_arena_alloc(&arena, 3);
+  char *b = s21_arena_alloc(&arena, 100);
+  ck_assert_ptr_nonnull(a);
+  ck_assert_ptr_nonnull(b);
+  ck_assert_int_eq((int)((uintptr_t)a % 64), 0);
+  ck_assert_int_eq((int)((uintptr_t)b % 64), 0);
+  ck_assert(b >= a + 3);
+  ck_assert(a >= (char *)buffer && b + 100 <= (char *)(buffer + 1024));
+
+  s21_arena_destroy(&arena);
+  ck_assert_ptr_null(arena.head);
+}
+END_TEST
+
+START_TEST(test_arena_mark_release) {
+  s21_arena_t arena;
+  ck_assert_int_eq(s21_arena_init(&arena, NULL, 4096), S21_OK);
+
+  s21_arena_alloc(&arena, 10);
+  s21_arena_mark_t mark = s21_arena_mark(&arena);
+  void *first = s21_arena_alloc(&arena, 256);
+  s21_arena_alloc(&arena, 512);
+  s21_arena_release(&arena, mark);
+  ck_assert_ptr_eq(s21_arena_alloc(&arena, 256), first);
+
+  s21_arena_reset(&arena);
+  void *again = s21_arena_alloc(&arena, 10);
+  ck_assert_ptr_nonnull(again);
+  ck_assert_ptr_eq(s21_arena_alloc(&arena, 256), first);
+
+  s21_arena_destroy(&arena);
+}
+END_TEST
+
+START_TEST(test_arena_grows_and_reuses) {
+  static double buffer[64];
+  s21_arena_t arena;
+  ck_assert_int_eq(s21_arena_init(&arena, buffer, sizeof(buffer)), S21_OK);
+
+  s21_arena_mark_t mark = s21_arena_mark(&arena);
+  double *big = s21_arena_alloc(&arena, 100000 * sizeof(double));
+  ck_assert_ptr_nonnull(big);
+  big[0] = 1.0;
+  big[99999] = 2.0;
+  ck_assert_ptr_ne(arena.current, arena.head);
+
+  s21_arena_release(&arena, mark);
+  ck_assert_ptr_eq(s21_arena_alloc(&arena, 100000 * sizeof(double)), big);
+
+  s21_arena_destroy(&arena);
+}
+END_TEST
+
+START_TEST(test_arena_bound_to_operations) {
+  static double buffer[1 << 16];
+  s21_arena_t arena;
+  ck_assert_int_eq(s21_arena_init(&arena, buffer, sizeof(buffer)), S21_OK);
+
+  matrix_t A, B;
+  _alloc_matrix(&A, 9, 9);
+  _alloc_matrix(&B, 9, 9);
+  _fill_matrix(&A, 0.5);
+  _fill_matrix(&B, 1.5);
+  for (int i = 0; i < 9; ++i) A.matrix[i][i] += 4.0;
+
+  double det_default;
+  matrix_t inv_default, comp_default, mult_default;
+  ck_assert_int_eq(s21_determinant(&A, &det_default), S21_OK);
+  ck_assert_int_eq(s21_inverse_matrix(&A, &inv_default), S21_OK);
+  ck_assert_int_eq(s21_calc_complements(&A, &comp_default), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix(&A, &B, &mult_default), S21_OK);
+
+  ck_assert_ptr_null(s21_set_arena(&arena));
+
+  double det;
+  matrix_t inv, comp, mult;
+  ck_assert_int_eq(s21_determinant(&A, &det), S21_OK);
+  ck_assert_int_eq(s21_inverse_matrix(&A, &inv), S21_OK);
+  ck_assert_int_eq(s21_calc_complements(&A, &comp), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix(&A, &B, &mult), S21_OK);
+
+  ck_assert_ptr_eq(s21_set_arena(NULL), &arena);
+
+  /* Every operation gave its workspace back. */
+  ck_assert_ptr_eq(arena.current, arena.head);
+  ck_assert_uint_eq(arena.used, 0);
+
+  ck_assert_double_eq(det, det_default);
+  ck_assert_int_eq(s21_eq_matrix(&inv, &inv_default), SUCCESS);
+  ck_assert_int_eq(s21_eq_matrix(&comp, &comp_default), SUCCESS);
+  ck_assert_int_eq(s21_eq_matrix(&mult, &mult_default), SUCCESS);
+
+  _free_matrix(&mult);
+  _free_matrix(&comp);
+  _free_matrix(&inv);
+  _free_matrix(&mult_default);
+  _free_matrix(&comp_default);
+  _free_matrix(&inv_default);
+  _free_matrix(&B);
+  _free_matrix(&A);
+  s21_arena_destroy(&arena);
+}
+END_TEST
+
+START_TEST(test_arena_grows_for_operations) {
+  static double buffer[64];
+  s21_arena_t arena;
+  ck_assert_int_eq(s21_arena_init(&arena, buffer, sizeof(buffer)), S21_OK);
+  s21_set_arena(&arena);
+
+  matrix_t A, inv;
+  _alloc_matrix(&A, 40, 40);
+  _fill_matrix(&A, 2.0);
+  for (int i = 0; i < 40; ++i) A.matrix[i][i] += 40.0;
+
+  ck_assert_int_eq(s21_inverse_matrix(&A, &inv), S21_OK);
+  ck_assert_ptr_eq(arena.current, arena.head);
+  ck_assert_uint_eq(arena.used, 0);
+
+  s21_set_arena(NULL);
+  s21_arena_destroy(&arena);
+
+  matrix_t check;
+  ck_assert_int_eq(s21_mult_matrix(&A, &inv, &check), S21_OK);
+  for (int i = 0; i < 40; ++i)
+    for (int j = 0; j < 40; ++j)
+      ck_assert_double_eq_tol(check.matrix[i][j], i == j ? 1.0 : 0.0, 1e-12);
+
+  _free_matrix(&check);
+  _free_matrix(&inv);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_arena_default_trim) {
+  matrix_t A, inv, again;
+  _alloc_matrix(&A, 400, 400);
+  _fill_matrix(&A, 0.5);
+  for (int i = 0; i < 400; ++i) A.matrix[i][i] += 400.0;
+
+  ck_assert_int_eq(s21_inverse_matrix(&A, &inv), S21_OK);
+  s21_arena_trim();
+  s21_arena_trim();
+  ck_assert_int_eq(s21_inverse_matrix(&A, &again), S21_OK);
+  for (int i = 0; i < 400; ++i)
+    for (int j = 0; j < 400; ++j)
+      ck_assert_double_eq(again.matrix[i][j], inv.matrix[i][j]);
+
+  _free_matrix(&again);
+  _free_matrix(&inv);
+  _free_matrix(&A);
+}
+END_TEST
+
+Suite *s21_arena_suite(void) {
+  Suite *s = suite_create("arena");
+  TCase *tc = tcase_create("core");
+
+  tcase_add_test(tc, test_arena_invalid_init);
+  tcase_add_test(tc, test_arena_caller_buffer);
+  tcase_add_test(tc, test_arena_mark_release);
+  tcase_add_test(tc, test_arena_grows_and_reuses);
+  tcase_add_test(tc, test_arena_bound_to_operations);
+  tcase_add_test(tc, test_arena_grows_for_operations);
+  tcase_add_test(tc, test_arena_default_trim);
+
+  suite_add_tcase(s, tc);
+  return s;
+}
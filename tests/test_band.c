@@ -0,0 +1,306 @@
+#include <check.h>
+
+#include "../include/s21_matrix.h"
+#include "../include/s21_suites.h"
+#include "../include/test_helpers.h"
+
+/* Dense n x n matrix that is zero outside the band; the diagonal is scaled
+   by `diagonal` so small values force row interchanges. */
+static void fill_band(matrix_t *M, int kl, int ku, double diagonal) {
+  for (int i = 0; i < M->rows; ++i)
+    for (int j = 0; j < M->columns; ++j) {
+      double v = sin(1.7 * i + 0.9 * j + 0.3) + 0.25 * cos(0.31 * i * j);
+      M->matrix[i][j] = j < i - kl || j > i + ku ? 0.0
+                        : i == j                ? diagonal * v
+                                                : v;
+    }
+}
+
+/* Checks A * X == B for the dense A. */
+static void assert_solves(matrix_t *A, matrix_t *X, matrix_t *B, double tol) {
+  matrix_t AX;
+  ck_assert_int_eq(s21_mult_matrix(A, X, &AX), S21_OK);
+  for (int i = 0; i < B->rows; ++i)
+    for (int j = 0; j < B->columns; ++j)
+      ck_assert_double_eq_tol(AX.matrix[i][j], B->matrix[i][j], tol);
+  _free_matrix(&AX);
+}
+
+START_TEST(test_band_storage) {
+  s21_band_t A;
+  ck_assert_int_eq(s21_band_create(5, 1, 2, &A), S21_OK);
+  ck_assert_int_eq(s21_band_set(&A, 0, 2, 3.5), S21_OK);
+  ck_assert_int_eq(s21_band_set(&A, 4, 3, -1.0), S21_OK);
+  ck_assert_int_eq(s21_band_set(&A, 0, 3, 1.0), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_band_set(&A, 3, 1, 1.0), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_band_set(&A, 5, 5, 1.0), S21_CALC_ERROR);
+
+  double value = -7.0;
+  ck_assert_int_eq(s21_band_get(&A, 0, 2, &value), S21_OK);
+  ck_assert_double_eq(value, 3.5);
+  ck_assert_int_eq(s21_band_get(&A, 4, 0, &value), S21_OK);
+  ck_assert_double_eq(value, 0.0);
+  ck_assert_int_eq(s21_band_get(&A, -1, 0, &value), S21_CALC_ERROR);
+
+  matrix_t D;
+  ck_assert_int_eq(s21_band_to_dense(&A, &D), S21_OK);
+  ck_assert_double_eq(D.matrix[0][2], 3.5);
+  ck_assert_double_eq(D.matrix[4][3], -1.0);
+  ck_assert_double_eq(D.matrix[2][2], 0.0);
+  _free_matrix(&D);
+  s21_band_free(&A);
+  ck_assert_ptr_null(A.data);
+
+  ck_assert_int_eq(s21_band_create(0, 0, 0, &A), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_band_create(3, 3, 0, &A), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_band_create(3, 0, -1, &A), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_band_create(3, 1, 1, NULL), S21_INCORRECT_MATRIX);
+}
+END_TEST
+
+START_TEST(test_band_dense_round_trip) {
+  matrix_t D, R, W;
+  _alloc_matrix(&D, 9, 9);
+  fill_band(&D, 2, 3, 1.0);
+  s21_band_t A;
+  ck_assert_int_eq(s21_band_from_dense(&D, 2, 3, &A), S21_OK);
+  ck_assert_int_eq(s21_band_to_dense(&A, &R), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&D, &R), SUCCESS);
+  _free_matrix(&R);
+  s21_band_free(&A);
+
+  /* A narrower band drops the outer diagonals. */
+  ck_assert_int_eq(s21_band_from_dense(&D, 0, 1, &A), S21_OK);
+  ck_assert_int_eq(s21_band_to_dense(&A, &R), S21_OK);
+  for (int i = 0; i < 9; ++i)
+    for (int j = 0; j < 9; ++j)
+      ck_assert_double_eq(R.matrix[i][j],
+                          j == i || j == i + 1 ? D.matrix[i][j] : 0.0);
+  _free_matrix(&R);
+  s21_band_free(&A);
+
+  _alloc_matrix(&W, 3, 4);
+  ck_assert_int_eq(s21_band_from_dense(&W, 1, 1, &A), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_band_from_dense(NULL, 1, 1, &A), S21_INCORRECT_MATRIX);
+  _free_matrix(&W);
+  _free_matrix(&D);
+}
+END_TEST
+
+START_TEST(test_band_mult_dense) {
+  const int shapes[][2] = {{0, 0}, {1, 1}, {3, 0}, {0, 4}, {2, 5}};
+  const int n = 23;
+  for (int s = 0; s < 5; ++s) {
+    matrix_t D, B, ref, C, x;
+    _alloc_matrix(&D, n, n);
+    _alloc_matrix(&B, n, 6);
+    fill_band(&D, shapes[s][0], shapes[s][1], 2.0);
+    _fill_rhs(&B, 0.1 * s);
+    s21_band_t A;
+    ck_assert_int_eq(s21_band_from_dense(&D, shapes[s][0], shapes[s][1], &A),
+                     S21_OK);
+
+    ck_assert_int_eq(s21_mult_matrix(&D, &B, &ref), S21_OK);
+    ck_assert_int_eq(s21_band_mult_dense(&A, &B, &C), S21_OK);
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j < 6; ++j)
+        ck_assert_double_eq_tol(C.matrix[i][j], ref.matrix[i][j], 1e-12);
+    _free_matrix(&C);
+    _free_matrix(&ref);
+
+    ck_assert_int_eq(s21_create_matrix(n, 1, &x), S21_OK);
+    _fill_rhs(&x, 2.0);
+    ck_assert_int_eq(s21_mult_matrix(&D, &x, &ref), S21_OK);
+    ck_assert_int_eq(s21_band_mult_dense(&A, &x, &C), S21_OK);
+    for (int i = 0; i < n; ++i)
+      ck_assert_double_eq_tol(C.matrix[i][0], ref.matrix[i][0], 1e-12);
+    _free_matrix(&C);
+    _free_matrix(&ref);
+    _free_matrix(&x);
+
+    s21_band_free(&A);
+    _free_matrix(&B);
+    _free_matrix(&D);
+  }
+
+  s21_band_t A;
+  matrix_t B, C;
+  ck_assert_int_eq(s21_band_create(4, 1, 1, &A), S21_OK);
+  _alloc_matrix(&B, 5, 1);
+  ck_assert_int_eq(s21_band_mult_dense(&A, &B, &C), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_band_mult_dense(&A, NULL, &C), S21_INCORRECT_MATRIX);
+  _free_matrix(&B);
+  s21_band_free(&A);
+}
+END_TEST
+
+START_TEST(test_band_lu_pivoting) {
+  const int shapes[][2] = {{1, 1}, {2, 1}, {1, 3}, {4, 2}, {0, 2}};
+  const int n = 41;
+  for (int s = 0; s < 5; ++s) {
+    matrix_t D, B, X;
+    _alloc_matrix(&D, n, n);
+    _alloc_matrix(&B, n, 3);
+    /* A tiny diagonal makes every step pick an off-diagonal pivot. */
+    fill_band(&D, shapes[s][0], shapes[s][1], s == 4 ? 1.0 : 1e-3);
+    _fill_rhs(&B, 0.5);
+    s21_band_t A;
+    s21_band_lu_t lu;
+    ck_assert_int_eq(s21_band_from_dense(&D, shapes[s][0], shapes[s][1], &A),
+                     S21_OK);
+
+    ck_assert_int_eq(s21_band_lu_factor(&A, &lu), S21_OK);
+    ck_assert_int_eq(s21_band_lu_solve(&lu, &B, &X), S21_OK);
+    assert_solves(&D, &X, &B, 1e-9);
+    _free_matrix(&X);
+    s21_band_lu_free(&lu);
+    ck_assert_ptr_null(lu.lu);
+
+    ck_assert_int_eq(s21_band_solve(&A, &B, &X), S21_OK);
+    assert_solves(&D, &X, &B, 1e-9);
+    _free_matrix(&X);
+
+    s21_band_free(&A);
+    _free_matrix(&B);
+    _free_matrix(&D);
+  }
+}
+END_TEST
+
+START_TEST(test_band_lu_singular) {
+  s21_band_t A;
+  s21_band_lu_t lu;
+  matrix_t B, X;
+  ck_assert_int_eq(s21_band_create(4, 1, 1, &A), S21_OK);
+  for (int i = 0; i < 4; ++i) s21_band_set(&A, i, i, 1.0);
+  for (int i = 0; i < 3; ++i) {
+    s21_band_set(&A, i, i + 1, 1.0);
+    s21_band_set(&A, i + 1, i, 1.0);
+  }
+  /* Rows 0 and 1 are both (1, 1, 0, 0). */
+  s21_band_set(&A, 1, 2, 0.0);
+  _alloc_matrix(&B, 4, 1);
+
+  ck_assert_int_eq(s21_band_lu_factor(&A, &lu), S21_OK);
+  ck_assert_int_eq(s21_band_lu_solve(&lu, &B, &X), S21_CALC_ERROR);
+  s21_band_lu_free(&lu);
+  ck_assert_int_eq(s21_band_solve(&A, &B, &X), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_tridiagonal_solve(&A, &B, &X), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_band_lu_solve(NULL, &B, &X), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_band_lu_factor(NULL, &lu), S21_INCORRECT_MATRIX);
+
+  _free_matrix(&B);
+  s21_band_free(&A);
+}
+END_TEST
+
+START_TEST(test_tridiagonal_spline) {
+  /* Natural cubic spline system: 4 on the diagonal, 1 beside it. */
+  const int n = 500;
+  s21_band_t A;
+  matrix_t D, B, X;
+  ck_assert_int_eq(s21_band_create(n, 1, 1, &A), S21_OK);
+  for (int i = 0; i < n; ++i) {
+    s21_band_set(&A, i, i, 4.0 + 0.01 * (i % 3));
+    if (i > 0) s21_band_set(&A, i, i - 1, 1.0);
+    if (i < n - 1) s21_band_set(&A, i, i + 1, 1.0 - 0.002 * (i % 5));
+  }
+  ck_assert_int_eq(s21_band_to_dense(&A, &D), S21_OK);
+
+  ck_assert_int_eq(s21_create_matrix(n, 1, &B), S21_OK);
+  _fill_rhs(&B, 0.0);
+  ck_assert_int_eq(s21_tridiagonal_solve(&A, &B, &X), S21_OK);
+  assert_solves(&D, &X, &B, 1e-12);
+  _free_matrix(&X);
+  _free_matrix(&B);
+
+  _alloc_matrix(&B, n, 4);
+  _fill_rhs(&B, 1.0);
+  ck_assert_int_eq(s21_tridiagonal_solve(&A, &B, &X), S21_OK);
+  assert_solves(&D, &X, &B, 1e-12);
+  _free_matrix(&X);
+  _free_matrix(&B);
+
+  _free_matrix(&D);
+  s21_band_free(&A);
+}
+END_TEST
+
+START_TEST(test_tridiagonal_shapes) {
+  /* Upper bidiagonal and diagonal systems go through the same sweeps. */
+  for (int kl = 0; kl <= 1; ++kl)
+    for (int ku = 0; ku <= 1; ++ku) {
+      matrix_t D, B, X;
+      _alloc_matrix(&D, 7, 7);
+      _alloc_matrix(&B, 7, 2);
+      fill_band(&D, kl, ku, 5.0);
+      _fill_rhs(&B, 0.2);
+      s21_band_t A;
+      ck_assert_int_eq(s21_band_from_dense(&D, kl, ku, &A), S21_OK);
+      ck_assert_int_eq(s21_tridiagonal_solve(&A, &B, &X), S21_OK);
+      assert_solves(&D, &X, &B, 1e-12);
+      _free_matrix(&X);
+      s21_band_free(&A);
+      _free_matrix(&B);
+      _free_matrix(&D);
+    }
+
+  s21_band_t A;
+  matrix_t B, X;
+  _alloc_matrix(&B, 5, 1);
+  ck_assert_int_eq(s21_band_create(5, 2, 1, &A), S21_OK);
+  ck_assert_int_eq(s21_tridiagonal_solve(&A, &B, &X), S21_CALC_ERROR);
+  s21_band_free(&A);
+  ck_assert_int_eq(s21_band_create(5, 1, 1, &A), S21_OK);
+  ck_assert_int_eq(s21_tridiagonal_solve(&A, &B, &X), S21_CALC_ERROR);
+  s21_band_free(&A);
+  ck_assert_int_eq(s21_band_create(6, 1, 1, &A), S21_OK);
+  ck_assert_int_eq(s21_tridiagonal_solve(&A, &B, &X), S21_CALC_ERROR);
+  s21_band_free(&A);
+  _free_matrix(&B);
+}
+END_TEST
+
+START_TEST(test_band_parallel_matches_serial) {
+  const int n = 3001;
+  matrix_t D, B, serial, parallel;
+  _alloc_matrix(&D, n, n);
+  _alloc_matrix(&B, n, 3);
+  fill_band(&D, 3, 4, 1.0);
+  _fill_rhs(&B, 0.0);
+  s21_band_t A;
+  ck_assert_int_eq(s21_band_from_dense(&D, 3, 4, &A), S21_OK);
+
+  ck_assert_int_eq(s21_set_num_threads(1), S21_OK);
+  ck_assert_int_eq(s21_band_mult_dense(&A, &B, &serial), S21_OK);
+  ck_assert_int_eq(s21_set_num_threads(4), S21_OK);
+  ck_assert_int_eq(s21_set_parallel_threshold(0), S21_OK);
+  ck_assert_int_eq(s21_band_mult_dense(&A, &B, &parallel), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&serial, &parallel), SUCCESS);
+
+  s21_set_parallel_threshold(128LL * 128LL * 128LL);
+  s21_set_num_threads(0);
+  _free_matrix(&parallel);
+  _free_matrix(&serial);
+  s21_band_free(&A);
+  _free_matrix(&B);
+  _free_matrix(&D);
+}
+END_TEST
+
+Suite *s21_band_suite(void) {
+  Suite *s = suite_create("band");
+  TCase *tc = tcase_create("core");
+
+  tcase_add_test(tc, test_band_storage);
+  tcase_add_test(tc, test_band_dense_round_trip);
+  tcase_add_test(tc, test_band_mult_dense);
+  tcase_add_test(tc, test_band_lu_pivoting);
+  tcase_add_test(tc, test_band_lu_singular);
+  tcase_add_test(tc, test_tridiagonal_spline);
+  tcase_add_test(tc, test_tridiagonal_shapes);
+  tcase_add_test(tc, test_band_parallel_matches_serial);
+
+  suite_add_tcase(s, tc);
+  return s;
+}
@@ -0,0 +1,163 @@
+#include <check.h>
+
+#include "../include/s21_matrix.h"
+#include "../include/s21_suites.h"
+#include "../include/test_helpers.h"
+
+#define BATCH_COUNT 19
+
+/* Diagonally dominant matrix k of order n, so every inverse exists. */
+static double entry(int n, int k, int i, int j) {
+  return (i == j ? n + 1.0 : 0.0) + sin(k * 7 + i * 3 + j + 1);
+}
+
+static void fill_soa(int n, int count, double *soa, int seed) {
+  for (int k = 0; k < count; ++k)
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j < n; ++j)
+        soa[(i * n + j) * count + k] = entry(n, k + seed, i, j);
+}
+
+static void extract(int n, int count, const double *soa, int k, matrix_t *M) {
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j) M->matrix[i][j] = soa[(i * n + j) * count + k];
+}
+
+START_TEST(test_batch_invalid) {
+  double a[4] = {1.0, 2.0, 3.0, 4.0};
+  double out[4];
+
+  ck_assert_int_eq(s21_batch_determinant(1, 1, a, out), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_batch_determinant(5, 1, a, out), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_batch_determinant(2, -1, a, out),
+                   S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_batch_determinant(2, 1, NULL, out),
+                   S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_batch_inverse(2, 1, a, NULL, NULL),
+                   S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_batch_mult(2, 1, a, NULL, out), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_batch_determinant(2, 0, a, out), S21_OK);
+}
+END_TEST
+
+START_TEST(test_batch_determinant) {
+  for (int n = 2; n <= 4; ++n) {
+    double a[16 * BATCH_COUNT];
+    double det[BATCH_COUNT];
+    matrix_t M;
+    _alloc_matrix(&M, n, n);
+    fill_soa(n, BATCH_COUNT, a, 0);
+
+    ck_assert_int_eq(s21_batch_determinant(n, BATCH_COUNT, a, det), S21_OK);
+    for (int k = 0; k < BATCH_COUNT; ++k) {
+      double expected = 0.0;
+      extract(n, BATCH_COUNT, a, k, &M);
+      ck_assert_int_eq(s21_determinant(&M, &expected), S21_OK);
+      ck_assert_double_eq_tol(det[k], expected, 1e-9);
+    }
+    _free_matrix(&M);
+  }
+}
+END_TEST
+
+START_TEST(test_batch_inverse) {
+  for (int n = 2; n <= 4; ++n) {
+    double a[16 * BATCH_COUNT];
+    double inv[16 * BATCH_COUNT];
+    int status[BATCH_COUNT];
+    matrix_t M, R, expected;
+    _alloc_matrix(&M, n, n);
+    _alloc_matrix(&R, n, n);
+    fill_soa(n, BATCH_COUNT, a, 3);
+
+    ck_assert_int_eq(s21_batch_inverse(n, BATCH_COUNT, a, inv, status),
+                     S21_OK);
+    for (int k = 0; k < BATCH_COUNT; ++k) {
+      ck_assert_int_eq(status[k], S21_OK);
+      extract(n, BATCH_COUNT, a, k, &M);
+      extract(n, BATCH_COUNT, inv, k, &R);
+      ck_assert_int_eq(s21_inverse_matrix(&M, &expected), S21_OK);
+      ck_assert_int_eq(s21_eq_matrix(&R, &expected), SUCCESS);
+      s21_remove_matrix(&expected);
+    }
+
+    ck_assert_int_eq(s21_batch_inverse(n, BATCH_COUNT, a, a, NULL), S21_OK);
+    for (int e = 0; e < n * n * BATCH_COUNT; ++e)
+      ck_assert_double_eq_tol(a[e], inv[e], 1e-12);
+
+    _free_matrix(&R);
+    _free_matrix(&M);
+  }
+}
+END_TEST
+
+START_TEST(test_batch_inverse_singular) {
+  const int n = 3;
+  double a[9 * BATCH_COUNT];
+  double inv[9 * BATCH_COUNT];
+  int status[BATCH_COUNT];
+  fill_soa(n, BATCH_COUNT, a, 0);
+  for (int j = 0; j < n; ++j) {
+    a[(2 * n + j) * BATCH_COUNT + 5] = a[(0 * n + j) * BATCH_COUNT + 5];
+    a[(1 * n + j) * BATCH_COUNT + 17] = 0.0;
+  }
+
+  ck_assert_int_eq(s21_batch_inverse(n, BATCH_COUNT, a, inv, status),
+                   S21_CALC_ERROR);
+  for (int k = 0; k < BATCH_COUNT; ++k) {
+    int singular = k == 5 || k == 17;
+    ck_assert_int_eq(status[k], singular ? S21_CALC_ERROR : S21_OK);
+    for (int e = 0; e < n * n; ++e) {
+      double value = inv[e * BATCH_COUNT + k];
+      ck_assert_int_eq(isnan(value) != 0, singular);
+    }
+  }
+}
+END_TEST
+
+START_TEST(test_batch_mult) {
+  for (int n = 2; n <= 4; ++n) {
+    double a[16 * BATCH_COUNT];
+    double b[16 * BATCH_COUNT];
+    double c[16 * BATCH_COUNT];
+    matrix_t A, B, C, expected;
+    _alloc_matrix(&A, n, n);
+    _alloc_matrix(&B, n, n);
+    _alloc_matrix(&C, n, n);
+    fill_soa(n, BATCH_COUNT, a, 1);
+    fill_soa(n, BATCH_COUNT, b, 11);
+
+    ck_assert_int_eq(s21_batch_mult(n, BATCH_COUNT, a, b, c), S21_OK);
+    for (int k = 0; k < BATCH_COUNT; ++k) {
+      extract(n, BATCH_COUNT, a, k, &A);
+      extract(n, BATCH_COUNT, b, k, &B);
+      extract(n, BATCH_COUNT, c, k, &C);
+      ck_assert_int_eq(s21_mult_matrix(&A, &B, &expected), S21_OK);
+      ck_assert_int_eq(s21_eq_matrix(&C, &expected), SUCCESS);
+      s21_remove_matrix(&expected);
+    }
+
+    ck_assert_int_eq(s21_batch_mult(n, BATCH_COUNT, a, b, b), S21_OK);
+    for (int e = 0; e < n * n * BATCH_COUNT; ++e)
+      ck_assert_double_eq_tol(b[e], c[e], 1e-12);
+
+    _free_matrix(&C);
+    _free_matrix(&B);
+    _free_matrix(&A);
+  }
+}
+END_TEST
+
+Suite *s21_batch_suite(void) {
+  Suite *s = suite_create("batch");
+  TCase *tc = tcase_create("core");
+
+  tcase_add_test(tc, test_batch_invalid);
+  tcase_add_test(tc, test_batch_determinant);
+  tcase_add_test(tc, test_batch_inverse);
+  tcase_add_test(tc, test_batch_inverse_singular);
+  tcase_add_test(tc, test_batch_mult);
+
+  suite_add_tcase(s, tc);
+  return s;
+}
@@ -268,6 +268,82 @@ START_TEST(test_calc_complements_6x6_diagonal) {
 }
 END_TEST
 
+START_TEST(test_calc_complements_singular_3x3) {
+  matrix_t A, result;
+  _alloc_matrix(&A, 3, 3);
+  double v = 1.0;
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j) A.matrix[i][j] = v++;
+
+  int rc = s21_calc_complements(&A, &result);
+  ck_assert_int_eq(rc, S21_OK);
+
+  double expected[3][3] = {
+      {-3.0, 6.0, -3.0}, {6.0, -12.0, 6.0}, {-3.0, 6.0, -3.0}};
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j)
+      ck_assert_ldouble_eq_tol(result.matrix[i][j], expected[i][j], S21_EPS);
+
+  _free_matrix(&result);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_calc_complements_8x8_adjugate_property) {
+  const int n = 8;
+  matrix_t A, cof, adj, prod;
+  _alloc_matrix(&A, n, n);
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j)
+      A.matrix[i][j] = (i == j) ? 4.0 : cos((double)(3 * i + j));
+
+  double det = 0.0;
+  ck_assert_int_eq(s21_determinant(&A, &det), S21_OK);
+  ck_assert_int_eq(s21_calc_complements(&A, &cof), S21_OK);
+  ck_assert_int_eq(s21_transpose(&cof, &adj), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix(&A, &adj, &prod), S21_OK);
+
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j)
+      ck_assert_ldouble_eq_tol(prod.matrix[i][j] / det, i == j ? 1.0 : 0.0,
+                               S21_EPS);
+
+  _free_matrix(&prod);
+  _free_matrix(&adj);
+  _free_matrix(&cof);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_calc_complements_small_closed_form) {
+  for (int n = 3; n <= 4; ++n) {
+    matrix_t A, result;
+    _alloc_matrix(&A, n, n);
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j < n; ++j)
+        A.matrix[i][j] = sin(1.7 * i + 0.9 * j + n) + (i == j) * 0.5;
+
+    A.matrix[1][0] = A.matrix[0][0] * 2.0;
+    A.matrix[1][1] = A.matrix[0][1] * 2.0;
+    ck_assert_int_eq(s21_calc_complements(&A, &result), S21_OK);
+
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        s21_view_t minor;
+        double det;
+        ck_assert_int_eq(s21_view_minor(&A, i, j, &minor), S21_OK);
+        ck_assert_int_eq(s21_view_determinant(&minor, &det), S21_OK);
+        ck_assert_double_eq_tol(result.matrix[i][j], (i + j) % 2 ? -det : det,
+                                1e-12);
+      }
+    }
+
+    _free_matrix(&result);
+    _free_matrix(&A);
+  }
+}
+END_TEST
+
 Suite *s21_calc_complements_suite(void) {
   Suite *s = suite_create("calc_complements");
   TCase *tc = tcase_create("core");
@@ -286,6 +362,10 @@ Suite *s21_calc_complements_suite(void) {
   tcase_add_test(tc, test_calc_complements_5x5_diagonal);
   tcase_add_test(tc, test_calc_complements_6x6_diagonal);
 
+  tcase_add_test(tc, test_calc_complements_singular_3x3);
+  tcase_add_test(tc, test_calc_complements_8x8_adjugate_property);
+
+  tcase_add_test(tc, test_calc_complements_small_closed_form);
   suite_add_tcase(s, tc);
   return s;
 }
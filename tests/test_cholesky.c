@@ -0,0 +1,245 @@
+#include <check.h>
+
+#include "../include/s21_matrix.h"
+#include "../include/s21_suites.h"
+#include "../include/test_helpers.h"
+
+/* A = M * M^T + n * I with M filled from sin, symmetric positive definite. */
+static void fill_spd(matrix_t *A) {
+  int n = A->rows;
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j <= i; ++j) {
+      double s = i == j ? n : 0.0;
+      for (int k = 0; k < n; ++k)
+        s += sin(i * 7 + k * 3 + 1) * sin(j * 7 + k * 3 + 1);
+      A->matrix[i][j] = s;
+      A->matrix[j][i] = s;
+    }
+}
+
+START_TEST(test_cholesky_invalid) {
+  matrix_t A, B, X;
+  s21_cholesky_t factor = {0, NULL};
+  double det;
+  _alloc_matrix(&A, 3, 4);
+
+  ck_assert_int_eq(s21_cholesky_factor(NULL, &factor), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_cholesky_factor(&A, NULL), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_cholesky_factor(&A, &factor), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_cholesky_determinant(&factor, &det),
+                   S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_cholesky_inverse(NULL, &X), S21_INCORRECT_MATRIX);
+  _free_matrix(&A);
+
+  _alloc_matrix(&A, 3, 3);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j) A.matrix[i][j] = i == j ? 1.0 : 2.0;
+  ck_assert_int_eq(s21_cholesky_factor(&A, &factor), S21_CALC_ERROR);
+  ck_assert_ptr_null(factor.l);
+
+  fill_spd(&A);
+  _alloc_matrix(&B, 2, 1);
+  ck_assert_int_eq(s21_cholesky_factor(&A, &factor), S21_OK);
+  ck_assert_int_eq(s21_cholesky_solve(&factor, &B, &X), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_cholesky_solve_into(&factor, &B, &B), S21_CALC_ERROR);
+  s21_cholesky_free(&factor);
+  ck_assert_ptr_null(factor.l);
+  s21_cholesky_free(&factor);
+
+  ck_assert_int_eq(s21_set_spd_detection(2), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_get_spd_detection(), 1);
+
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_cholesky_factor) {
+  int sizes[] = {1, 2, 5, 63, 64, 65, 150};
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+    int n = sizes[s];
+    matrix_t A, L, LT, LLT;
+    s21_cholesky_t factor;
+    _alloc_matrix(&A, n, n);
+    _alloc_matrix(&L, n, n);
+    fill_spd(&A);
+
+    ck_assert_int_eq(s21_cholesky_factor(&A, &factor), S21_OK);
+    ck_assert_int_eq(factor.n, n);
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j <= i; ++j) L.matrix[i][j] = factor.l[i * n + j];
+    ck_assert_int_eq(s21_transpose(&L, &LT), S21_OK);
+    ck_assert_int_eq(s21_mult_matrix(&L, &LT, &LLT), S21_OK);
+    ck_assert_int_eq(s21_eq_matrix(&LLT, &A), SUCCESS);
+
+    s21_remove_matrix(&LLT);
+    s21_remove_matrix(&LT);
+    s21_cholesky_free(&factor);
+    _free_matrix(&L);
+    _free_matrix(&A);
+  }
+}
+END_TEST
+
+START_TEST(test_cholesky_solve_det_inverse) {
+  const int n = 70;
+  matrix_t A, B, X, AX, inv, expected;
+  s21_cholesky_t factor;
+  _alloc_matrix(&A, n, n);
+  fill_spd(&A);
+  ck_assert_int_eq(s21_cholesky_factor(&A, &factor), S21_OK);
+
+  for (int k = 1; k <= 3; k += 2) {
+    _alloc_matrix(&B, n, k);
+    _fill_rhs(&B, 1.0);
+    ck_assert_int_eq(s21_cholesky_solve(&factor, &B, &X), S21_OK);
+    ck_assert_int_eq(s21_mult_matrix(&A, &X, &AX), S21_OK);
+    ck_assert_int_eq(s21_eq_matrix(&AX, &B), SUCCESS);
+    s21_remove_matrix(&AX);
+    s21_remove_matrix(&X);
+    _free_matrix(&B);
+  }
+
+  ck_assert_int_eq(s21_create_matrix(n, 1, &B), S21_OK);
+  _fill_rhs(&B, 1.0);
+  ck_assert_int_eq(s21_cholesky_solve(&factor, &B, &X), S21_OK);
+  ck_assert_int_eq(s21_cholesky_solve_into(&factor, &B, &B), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&B, &X), SUCCESS);
+  s21_remove_matrix(&X);
+  s21_remove_matrix(&B);
+
+  ck_assert_int_eq(s21_set_spd_detection(0), S21_OK);
+  double det = 0.0, expected_det = 0.0;
+  ck_assert_int_eq(s21_cholesky_determinant(&factor, &det), S21_OK);
+  ck_assert_int_eq(s21_determinant(&A, &expected_det), S21_OK);
+  ck_assert_double_eq_tol(det, expected_det, 1e-9 * fabs(expected_det));
+
+  ck_assert_int_eq(s21_cholesky_inverse(&factor, &inv), S21_OK);
+  ck_assert_int_eq(s21_inverse_matrix(&A, &expected), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&inv, &expected), SUCCESS);
+  ck_assert_int_eq(s21_set_spd_detection(1), S21_OK);
+
+  s21_remove_matrix(&expected);
+  s21_remove_matrix(&inv);
+  s21_cholesky_free(&factor);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_cholesky_auto_detection) {
+  const int n = 40;
+  matrix_t A, B, inv_spd, inv_lu, x_spd, x_lu;
+  double det_spd = 0.0, det_lu = 0.0;
+  _alloc_matrix(&A, n, n);
+  _alloc_matrix(&B, n, 2);
+  fill_spd(&A);
+  _fill_rhs(&B, 1.0);
+
+  ck_assert_int_eq(s21_get_spd_detection(), 1);
+  ck_assert_int_eq(s21_determinant(&A, &det_spd), S21_OK);
+  ck_assert_int_eq(s21_inverse_matrix(&A, &inv_spd), S21_OK);
+  ck_assert_int_eq(s21_solve(&A, &B, &x_spd), S21_OK);
+
+  ck_assert_int_eq(s21_set_spd_detection(0), S21_OK);
+  ck_assert_int_eq(s21_get_spd_detection(), 0);
+  ck_assert_int_eq(s21_determinant(&A, &det_lu), S21_OK);
+  ck_assert_int_eq(s21_inverse_matrix(&A, &inv_lu), S21_OK);
+  ck_assert_int_eq(s21_solve(&A, &B, &x_lu), S21_OK);
+  ck_assert_int_eq(s21_set_spd_detection(1), S21_OK);
+
+  ck_assert_double_eq_tol(det_spd, det_lu, 1e-9 * fabs(det_lu));
+  ck_assert_int_eq(s21_eq_matrix(&inv_spd, &inv_lu), SUCCESS);
+  ck_assert_int_eq(s21_eq_matrix(&x_spd, &x_lu), SUCCESS);
+
+  s21_remove_matrix(&x_lu);
+  s21_remove_matrix(&x_spd);
+  s21_remove_matrix(&inv_lu);
+  s21_remove_matrix(&inv_spd);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_cholesky_auto_fallback) {
+  const int n = 40;
+  matrix_t A, inv, check;
+  _alloc_matrix(&A, n, n);
+  for (int i = 0; i < n; ++i) {
+    A.matrix[i][i] = 1.0;
+    if (i > 0) A.matrix[i][i - 1] = A.matrix[i - 1][i] = 2.0;
+  }
+
+  double det = 0.0;
+  ck_assert_int_eq(s21_determinant(&A, &det), S21_OK);
+  ck_assert_int_eq(s21_set_spd_detection(0), S21_OK);
+  double expected = 0.0;
+  ck_assert_int_eq(s21_determinant(&A, &expected), S21_OK);
+  ck_assert_int_eq(s21_set_spd_detection(1), S21_OK);
+  ck_assert_double_eq_tol(det, expected, 1e-9 * fabs(expected));
+
+  ck_assert_int_eq(s21_inverse_matrix(&A, &inv), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix(&A, &inv, &check), S21_OK);
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j)
+      ck_assert_double_eq_tol(check.matrix[i][j], i == j ? 1.0 : 0.0, 1e-9);
+
+  s21_remove_matrix(&check);
+  s21_remove_matrix(&inv);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_cholesky_log_determinant) {
+  const int n = 300;
+  matrix_t A;
+  s21_cholesky_t factor;
+  _alloc_matrix(&A, n, n);
+  for (int i = 0; i < n; ++i) {
+    A.matrix[i][i] = 1e-4;
+    if (i > 0) A.matrix[i][i - 1] = A.matrix[i - 1][i] = 1e-6;
+  }
+  ck_assert_int_eq(s21_cholesky_factor(&A, &factor), S21_OK);
+
+  double det = 1.0, log_det = 0.0;
+  ck_assert_int_eq(s21_cholesky_log_determinant(NULL, &log_det),
+                   S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_cholesky_determinant(&factor, &det), S21_OK);
+  ck_assert_double_eq(det, 0.0);
+  ck_assert_int_eq(s21_cholesky_log_determinant(&factor, &log_det), S21_OK);
+  double expected = 0.0, ratio = 1e-4;
+  for (int k = 0; k < n; ++k) {
+    if (k > 0) ratio = 1e-4 - 1e-12 / ratio;
+    expected += log(ratio);
+  }
+  ck_assert_double_eq_tol(log_det, expected, 1e-9);
+
+  int sign = 0;
+  double generic = 0.0;
+  ck_assert_int_eq(s21_log_determinant(&A, &sign, &generic), S21_OK);
+  ck_assert_int_eq(sign, 1);
+  ck_assert_double_eq_tol(generic, log_det, 1e-9);
+
+  matrix_t inverse;
+  ck_assert_int_eq(s21_inverse_matrix(&A, &inverse), S21_OK);
+  ck_assert_double_eq_tol(inverse.matrix[0][0], 1e4, 2.0);
+  s21_remove_matrix(&inverse);
+
+  s21_cholesky_free(&factor);
+  _free_matrix(&A);
+}
+END_TEST
+
+Suite *s21_cholesky_suite(void) {
+  Suite *s = suite_create("cholesky");
+  TCase *tc = tcase_create("core");
+
+  tcase_add_test(tc, test_cholesky_invalid);
+  tcase_add_test(tc, test_cholesky_factor);
+  tcase_add_test(tc, test_cholesky_solve_det_inverse);
+  tcase_add_test(tc, test_cholesky_auto_detection);
+  tcase_add_test(tc, test_cholesky_auto_fallback);
+
+  tcase_add_test(tc, test_cholesky_log_determinant);
+  suite_add_tcase(s, tc);
+  return s;
+}
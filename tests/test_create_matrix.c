@@ -1,4 +1,6 @@
 #include <check.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #include "../include/s21_matrix.h"
 #include "../include/s21_suites.h"
@@ -72,6 +74,130 @@ START_TEST(test_create_matrix_one_by_one_assign_and_remove) {
 }
 END_TEST
 
+START_TEST(test_create_matrix_contiguous_rows) {
+  matrix_t m;
+  int rc = s21_create_matrix(4, 3, &m);
+  ck_assert_int_eq(rc, 0);
+
+  for (int i = 1; i < m.rows; ++i) {
+    ck_assert(m.matrix[i] == m.matrix[i - 1] + m.columns);
+  }
+
+  double *flat = m.matrix[0];
+  for (int k = 0; k < m.rows * m.columns; ++k) flat[k] = (double)k;
+  ck_assert_double_eq_tol(m.matrix[2][1], 7.0, S21_EPS);
+  ck_assert_double_eq_tol(m.matrix[3][2], 11.0, S21_EPS);
+
+  s21_remove_matrix(&m);
+  ck_assert_ptr_null(m.matrix);
+}
+END_TEST
+
+START_TEST(test_create_matrix_large_zeroed) {
+  matrix_t m;
+  int rc = s21_create_matrix(512, 257, &m);
+  ck_assert_int_eq(rc, 0);
+
+  const double *flat = m.matrix[0];
+  for (int k = 0; k < 512 * 257; ++k) {
+    ck_assert(flat[k] == 0.0);
+  }
+
+  s21_remove_matrix(&m);
+}
+END_TEST
+
+START_TEST(test_create_matrix_overflow_size) {
+  matrix_t m;
+  int rc = s21_create_matrix(2147483647, 2147483647, &m);
+  ck_assert_int_eq(rc, 1);
+  ck_assert_ptr_null(m.matrix);
+}
+END_TEST
+
+START_TEST(test_create_matrix_aligned_layout) {
+  int widths[] = {1, 7, 8, 13, 64, 1024, 2048};
+  for (int w = 0; w < 7; ++w) {
+    matrix_t m;
+    ck_assert_int_eq(s21_create_matrix_aligned(3, widths[w], &m), S21_OK);
+    ptrdiff_t stride = m.matrix[1] - m.matrix[0];
+    ck_assert_int_ge(stride, widths[w]);
+    ck_assert_int_eq(stride % 8, 0);
+    ck_assert_int_ne(stride % 64, 0);
+    for (int i = 0; i < 3; ++i) {
+      ck_assert_int_eq((int)((uintptr_t)m.matrix[i] % 64), 0);
+      ck_assert_ptr_eq(m.matrix[i], m.matrix[0] + i * stride);
+      for (int j = 0; j < widths[w]; ++j)
+        ck_assert_double_eq(m.matrix[i][j], 0.0);
+    }
+    s21_remove_matrix(&m);
+    ck_assert_ptr_null(m.matrix);
+  }
+
+  matrix_t m;
+  ck_assert_int_eq(s21_create_matrix_aligned(0, 4, &m), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_create_matrix_aligned(4, 4, NULL),
+                   S21_INCORRECT_MATRIX);
+}
+END_TEST
+
+START_TEST(test_create_matrix_alloc_mode) {
+  ck_assert_int_eq(s21_get_alloc_mode(), S21_ALLOC_PACKED);
+  ck_assert_int_eq(s21_set_alloc_mode(7), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_set_alloc_mode(S21_ALLOC_ALIGNED), S21_OK);
+  ck_assert_int_eq(s21_get_alloc_mode(), S21_ALLOC_ALIGNED);
+
+  int n = 64;
+  matrix_t A, B;
+  ck_assert_int_eq(s21_create_matrix(n, n, &A), S21_OK);
+  _alloc_matrix(&B, n, n);
+  ck_assert_int_eq(A.matrix[1] - A.matrix[0], n + 8);
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j) {
+      A.matrix[i][j] = (i == j) * 2.0 + 0.01 * (i - j);
+      B.matrix[i][j] = i + j;
+    }
+
+  matrix_t sum, scaled, product, transposed, inverse;
+  ck_assert_int_eq(s21_sum_matrix(&A, &A, &sum), S21_OK);
+  ck_assert_int_eq(s21_mult_number(&A, 2.0, &scaled), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&sum, &scaled), SUCCESS);
+  ck_assert_int_eq(s21_sum_matrix_into(&sum, &B, &sum), S21_OK);
+  ck_assert_double_eq_tol(sum.matrix[n - 1][n - 1], 4.0 + 2.0 * (n - 1),
+                          1e-12);
+
+  ck_assert_int_eq(s21_transpose(&B, &transposed), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&transposed, &B), SUCCESS);
+  ck_assert_int_eq(s21_inverse_matrix(&A, &inverse), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix(&A, &inverse, &product), S21_OK);
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j)
+      ck_assert_double_eq_tol(product.matrix[i][j], i == j, 1e-12);
+
+  ck_assert_int_eq(s21_set_alloc_mode(S21_ALLOC_PACKED), S21_OK);
+  _free_matrix(&inverse);
+  _free_matrix(&transposed);
+  _free_matrix(&product);
+  _free_matrix(&scaled);
+  _free_matrix(&sum);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_create_matrix_aligned_many) {
+  enum { COUNT = 300 };
+  matrix_t m[COUNT];
+  for (int k = 0; k < COUNT; ++k)
+    ck_assert_int_eq(s21_create_matrix_aligned(1 + k % 5, 3, &m[k]), S21_OK);
+  for (int k = 0; k < COUNT; ++k) {
+    int pick = (k * 7919) % COUNT;
+    s21_remove_matrix(&m[pick]);
+    ck_assert_ptr_null(m[pick].matrix);
+  }
+}
+END_TEST
+
 Suite *s21_create_matrix_suite(void) {
   Suite *s = suite_create("create_matrix");
   TCase *tc = tcase_create("core");
@@ -82,7 +208,13 @@ Suite *s21_create_matrix_suite(void) {
   tcase_add_test(tc, test_create_matrix_null_result);
   tcase_add_test(tc, test_remove_matrix_clears_fields);
   tcase_add_test(tc, test_create_matrix_one_by_one_assign_and_remove);
+  tcase_add_test(tc, test_create_matrix_contiguous_rows);
+  tcase_add_test(tc, test_create_matrix_large_zeroed);
+  tcase_add_test(tc, test_create_matrix_overflow_size);
 
+  tcase_add_test(tc, test_create_matrix_aligned_layout);
+  tcase_add_test(tc, test_create_matrix_alloc_mode);
+  tcase_add_test(tc, test_create_matrix_aligned_many);
   suite_add_tcase(s, tc);
   return s;
 }
\ No newline at end of file
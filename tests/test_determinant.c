@@ -186,6 +186,197 @@ START_TEST(test_det_with_nan_and_inf) {
 }
 END_TEST
 
+START_TEST(test_det_3x3_zero_leading_pivot) {
+  matrix_t A;
+  _alloc_matrix(&A, 3, 3);
+  A.matrix[0][0] = 0;
+  A.matrix[0][1] = 2;
+  A.matrix[0][2] = 1;
+  A.matrix[1][0] = 1;
+  A.matrix[1][1] = 1;
+  A.matrix[1][2] = 1;
+  A.matrix[2][0] = 2;
+  A.matrix[2][1] = 1;
+  A.matrix[2][2] = 0;
+  double det = NAN;
+  int rc = s21_determinant(&A, &det);
+  ck_assert_int_eq(rc, 0);
+  ck_assert_ldouble_eq_tol(det, 3.0, S21_EPS);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_det_permutation_sign) {
+  matrix_t A;
+  _alloc_matrix(&A, 4, 4);
+  A.matrix[0][3] = 1;
+  A.matrix[1][2] = 1;
+  A.matrix[2][1] = 1;
+  A.matrix[3][0] = 1;
+  double det = NAN;
+  int rc = s21_determinant(&A, &det);
+  ck_assert_int_eq(rc, 0);
+  ck_assert_ldouble_eq_tol(det, 1.0, S21_EPS);
+
+  A.matrix[2][1] = 0;
+  A.matrix[2][2] = 1;
+  A.matrix[1][2] = 0;
+  A.matrix[1][1] = 1;
+  rc = s21_determinant(&A, &det);
+  ck_assert_int_eq(rc, 0);
+  ck_assert_ldouble_eq_tol(det, -1.0, S21_EPS);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_det_12x12_tridiagonal) {
+  matrix_t A;
+  _alloc_matrix(&A, 12, 12);
+  for (int i = 0; i < 12; ++i) {
+    A.matrix[i][i] = 2.0;
+    if (i > 0) A.matrix[i][i - 1] = -1.0;
+    if (i < 11) A.matrix[i][i + 1] = -1.0;
+  }
+  double det = NAN;
+  int rc = s21_determinant(&A, &det);
+  ck_assert_int_eq(rc, 0);
+  ck_assert_ldouble_eq_tol(det, 13.0, S21_EPS);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_det_64x64_created_diagonal) {
+  matrix_t A;
+  int rc = s21_create_matrix(64, 64, &A);
+  ck_assert_int_eq(rc, 0);
+  for (int i = 0; i < 64; ++i) {
+    A.matrix[i][i] = (i % 2 == 0) ? 2.0 : 0.5;
+    A.matrix[i][(i + 1) % 64] += 1e-3 * (i % 3 == 0);
+  }
+  A.matrix[63][0] = 0.0;
+  double det = NAN;
+  rc = s21_determinant(&A, &det);
+  ck_assert_int_eq(rc, 0);
+  ck_assert_ldouble_eq_tol(det, 1.0, S21_EPS);
+  s21_remove_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_determinant_small_closed_form_matches_lu) {
+  for (int n = 2; n <= 4; ++n) {
+    matrix_t A;
+    _alloc_matrix(&A, n, n);
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j < n; ++j)
+        A.matrix[i][j] = sin(1.7 * i + 0.9 * j + n) + (i == j) * 0.5;
+
+    /* A view determinant of order >= 3 goes through LU. */
+    matrix_t big;
+    _alloc_matrix(&big, n + 1, n + 1);
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j < n; ++j) big.matrix[i + 1][j + 1] = A.matrix[i][j];
+    s21_view_t block;
+    ck_assert_int_eq(s21_view_block(&big, 1, 1, n, n, &block), S21_OK);
+
+    double closed, reference;
+    ck_assert_int_eq(s21_determinant(&A, &closed), S21_OK);
+    ck_assert_int_eq(s21_view_determinant(&block, &reference), S21_OK);
+    ck_assert_double_eq_tol(closed, reference, 1e-12);
+
+    _free_matrix(&big);
+    _free_matrix(&A);
+  }
+}
+END_TEST
+
+START_TEST(test_log_determinant_invalid) {
+  matrix_t A;
+  int sign = 0;
+  double value = 0.0;
+  _alloc_matrix(&A, 2, 3);
+
+  ck_assert_int_eq(s21_log_determinant(NULL, &sign, &value),
+                   S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_log_determinant(&A, NULL, &value),
+                   S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_log_determinant(&A, &sign, NULL),
+                   S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_log_determinant(&A, &sign, &value), S21_CALC_ERROR);
+
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_log_determinant_matches_determinant) {
+  int sizes[] = {1, 3, 4, 7, 40};
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+    int n = sizes[s];
+    matrix_t A;
+    _alloc_matrix(&A, n, n);
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j < n; ++j)
+        A.matrix[i][j] = sin(i * 5 + j * 3 + 1) + (i == j) * 2.0;
+
+    int sign = 0;
+    double det = 0.0, log_det = 0.0;
+    ck_assert_int_eq(s21_determinant(&A, &det), S21_OK);
+    ck_assert_int_eq(s21_log_determinant(&A, &sign, &log_det), S21_OK);
+    ck_assert_int_eq(sign, det > 0.0 ? 1 : -1);
+    ck_assert_double_eq_tol(log_det, log(fabs(det)), 1e-10);
+
+    for (int j = 0; j < n; ++j) A.matrix[n - 1][j] = A.matrix[0][j];
+    if (n > 4) {
+      ck_assert_int_eq(s21_log_determinant(&A, &sign, &log_det), S21_OK);
+      ck_assert_int_eq(sign, 0);
+      ck_assert(isinf(log_det) && log_det < 0.0);
+    }
+    _free_matrix(&A);
+  }
+}
+END_TEST
+
+START_TEST(test_log_determinant_beyond_double_range) {
+  const int n = 300;
+  matrix_t A;
+  _alloc_matrix(&A, n, n);
+  for (int i = 0; i < n; ++i) {
+    A.matrix[i][i] = i % 2 ? -1e-3 : 1e-3;
+    if (i > 0) A.matrix[i][i - 1] = 1e-5;
+  }
+
+  int sign = 0;
+  double det = 1.0, log_det = 0.0;
+  ck_assert_int_eq(s21_determinant(&A, &det), S21_OK);
+  ck_assert_double_eq(det, 0.0);
+  ck_assert_int_eq(s21_log_determinant(&A, &sign, &log_det), S21_OK);
+  ck_assert_int_eq(sign, 1);
+  ck_assert_double_eq_tol(log_det, n * log(1e-3), 1e-9);
+
+  for (int i = 0; i < n; ++i) A.matrix[i][i] *= 1e6;
+  ck_assert_int_eq(s21_determinant(&A, &det), S21_OK);
+  ck_assert(isinf(det));
+  ck_assert_int_eq(s21_log_determinant(&A, &sign, &log_det), S21_OK);
+  ck_assert_int_eq(sign, 1);
+  ck_assert_double_eq_tol(log_det, n * log(1e3), 1e-9);
+
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_determinant_scaled_product) {
+  const int n = 200;
+  matrix_t A;
+  _alloc_matrix(&A, n, n);
+  for (int i = 0; i < n; ++i) A.matrix[i][i] = i < n / 2 ? 1e10 : 1e-10;
+
+  double det = 0.0;
+  ck_assert_int_eq(s21_determinant(&A, &det), S21_OK);
+  ck_assert_double_eq_tol(det, 1.0, 1e-9);
+
+  _free_matrix(&A);
+}
+END_TEST
+
 Suite *s21_determinant_suite(void) {
   Suite *s = suite_create("determinant");
   TCase *tc = tcase_create("core");
@@ -203,7 +394,16 @@ Suite *s21_determinant_suite(void) {
   tcase_add_test(tc, test_det_upper_triangular_4x4);
   tcase_add_test(tc, test_det_fractional_precision);
   tcase_add_test(tc, test_det_with_nan_and_inf);
+  tcase_add_test(tc, test_det_3x3_zero_leading_pivot);
+  tcase_add_test(tc, test_det_permutation_sign);
+  tcase_add_test(tc, test_det_12x12_tridiagonal);
+  tcase_add_test(tc, test_det_64x64_created_diagonal);
 
+  tcase_add_test(tc, test_determinant_small_closed_form_matches_lu);
+  tcase_add_test(tc, test_log_determinant_invalid);
+  tcase_add_test(tc, test_log_determinant_matches_determinant);
+  tcase_add_test(tc, test_log_determinant_beyond_double_range);
+  tcase_add_test(tc, test_determinant_scaled_product);
   suite_add_tcase(s, tc);
   return s;
 }
@@ -1,3 +1,5 @@
+#include <math.h>
+
 #include "../include/test_helpers.h"
 
 void _alloc_matrix(matrix_t *m, int rows, int cols) {
@@ -13,13 +15,20 @@ void _alloc_matrix(matrix_t *m, int rows, int cols) {
 void _free_matrix(matrix_t *m) {
   if (!m) return;
   if (m->matrix) {
-    for (int i = 0; i < m->rows; ++i) {
-      free(m->matrix[i]);
-      m->matrix[i] = NULL;
-    }
-    free(m->matrix);
-    m->matrix = NULL;
+    s21_remove_matrix(m);
   }
   m->rows = 0;
   m->columns = 0;
 }
+
+void _fill_matrix(matrix_t *m, double shift) {
+  for (int i = 0; i < m->rows; ++i)
+    for (int j = 0; j < m->columns; ++j)
+      m->matrix[i][j] = sin(0.37 * i + 1.3 * j + shift);
+}
+
+void _fill_rhs(matrix_t *m, double shift) {
+  for (int i = 0; i < m->rows; ++i)
+    for (int j = 0; j < m->columns; ++j)
+      m->matrix[i][j] = cos(0.7 * i - 1.3 * j + shift);
+}
@@ -176,6 +176,96 @@ START_TEST(test_inverse_with_nan_inf) {
 }
 END_TEST
 
+START_TEST(test_inverse_3x3_zero_leading_pivot) {
+  matrix_t A, inv;
+  _alloc_matrix(&A, 3, 3);
+  A.matrix[0][1] = 1.0;
+  A.matrix[1][0] = 2.0;
+  A.matrix[2][2] = 4.0;
+
+  int rc = s21_inverse_matrix(&A, &inv);
+  ck_assert_int_eq(rc, S21_OK);
+
+  double expected[3][10] = {{0.0, 0.5, 0.0}, {1.0, 0.0, 0.0}, {0.0, 0.0, 0.25}};
+  assert_matrix_eq_expected(&inv, expected, 3, 3);
+
+  _free_matrix(&inv);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_inverse_200x200_identity_product) {
+  const int n = 200;
+  matrix_t A, inv, prod;
+  _alloc_matrix(&A, n, n);
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j)
+      A.matrix[i][j] = (i == j) ? (double)n : sin((double)(i * n + j));
+
+  int rc = s21_inverse_matrix(&A, &inv);
+  ck_assert_int_eq(rc, S21_OK);
+  rc = s21_mult_matrix(&A, &inv, &prod);
+  ck_assert_int_eq(rc, S21_OK);
+
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j)
+      ck_assert_ldouble_eq_tol(prod.matrix[i][j], i == j ? 1.0 : 0.0,
+                               S21_EPS);
+
+  _free_matrix(&prod);
+  _free_matrix(&inv);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_inverse_small_closed_form) {
+  for (int n = 1; n <= 4; ++n) {
+    matrix_t A, inverse, product;
+    _alloc_matrix(&A, n, n);
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j < n; ++j)
+        A.matrix[i][j] = sin(1.7 * i + 0.9 * j + n) + (i == j) * 0.5;
+
+    ck_assert_int_eq(s21_inverse_matrix(&A, &inverse), S21_OK);
+    ck_assert_int_eq(s21_mult_matrix(&A, &inverse, &product), S21_OK);
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j < n; ++j)
+        ck_assert_double_eq_tol(product.matrix[i][j], i == j, 1e-12);
+
+    _free_matrix(&product);
+    _free_matrix(&inverse);
+
+    for (int j = 0; j < n; ++j) A.matrix[n - 1][j] = A.matrix[0][j];
+    if (n > 1)
+      ck_assert_int_eq(s21_inverse_matrix(&A, &inverse), S21_CALC_ERROR);
+    _free_matrix(&A);
+  }
+}
+END_TEST
+
+START_TEST(test_inverse_independent_of_scale) {
+  int sizes[] = {2, 4, 8, 200};
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+    int n = sizes[s];
+    matrix_t A, inverse;
+    _alloc_matrix(&A, n, n);
+    for (int i = 0; i < n; ++i) {
+      A.matrix[i][i] = 1e-2;
+      if (i > 0) A.matrix[i][i - 1] = 1e-3;
+    }
+
+    ck_assert_int_eq(s21_inverse_matrix(&A, &inverse), S21_OK);
+    ck_assert_double_eq_tol(inverse.matrix[0][0], 100.0, 1e-9);
+    ck_assert_double_eq_tol(inverse.matrix[1][0], -10.0, 1e-9);
+    s21_remove_matrix(&inverse);
+
+    for (int j = 0; j < n; ++j) A.matrix[n - 1][j] = 1e-3 * A.matrix[0][j];
+    ck_assert_int_eq(s21_inverse_matrix(&A, &inverse), S21_CALC_ERROR);
+    _free_matrix(&A);
+  }
+}
+END_TEST
+
 Suite *s21_inverse_matrix_suite(void) {
   Suite *s = suite_create("inverse_matrix_manual");
   TCase *tc = tcase_create("core");
@@ -190,7 +280,11 @@ Suite *s21_inverse_matrix_suite(void) {
   tcase_add_test(tc, test_inverse_3x3_given_example);
   tcase_add_test(tc, test_inverse_preserve_original);
   tcase_add_test(tc, test_inverse_with_nan_inf);
+  tcase_add_test(tc, test_inverse_3x3_zero_leading_pivot);
+  tcase_add_test(tc, test_inverse_200x200_identity_product);
 
+  tcase_add_test(tc, test_inverse_small_closed_form);
+  tcase_add_test(tc, test_inverse_independent_of_scale);
   suite_add_tcase(s, tc);
   return s;
 }
@@ -0,0 +1,165 @@
+#include <check.h>
+
+#include "../include/s21_matrix.h"
+#include "../include/s21_suites.h"
+#include "../include/test_helpers.h"
+
+static const int isa_levels[] = {S21_ISA_SCALAR, S21_ISA_AVX2,
+                                 S21_ISA_AVX512};
+
+START_TEST(test_isa_invalid_level) {
+  int before = s21_get_isa();
+  ck_assert_int_eq(s21_set_isa(42), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_get_isa(), before);
+}
+END_TEST
+
+START_TEST(test_isa_scalar_always_available) {
+  ck_assert_int_eq(s21_set_isa(S21_ISA_SCALAR), S21_OK);
+  ck_assert_int_eq(s21_get_isa(), S21_ISA_SCALAR);
+  ck_assert_int_eq(s21_set_isa(S21_ISA_AUTO), S21_OK);
+}
+END_TEST
+
+START_TEST(test_isa_elementwise_all_levels) {
+  matrix_t A, B;
+  _alloc_matrix(&A, 7, 13);
+  _alloc_matrix(&B, 7, 13);
+  _fill_matrix(&A, 0.0);
+  _fill_matrix(&B, 1.0);
+
+  for (int l = 0; l < 3; ++l) {
+    if (s21_set_isa(isa_levels[l]) != S21_OK) continue;
+
+    matrix_t sum, sub, scaled;
+    ck_assert_int_eq(s21_sum_matrix(&A, &B, &sum), S21_OK);
+    ck_assert_int_eq(s21_sub_matrix(&A, &B, &sub), S21_OK);
+    ck_assert_int_eq(s21_mult_number(&A, -2.5, &scaled), S21_OK);
+    for (int i = 0; i < 7; ++i) {
+      for (int j = 0; j < 13; ++j) {
+        ck_assert_double_eq_tol(sum.matrix[i][j],
+                                A.matrix[i][j] + B.matrix[i][j], 1e-15);
+        ck_assert_double_eq_tol(sub.matrix[i][j],
+                                A.matrix[i][j] - B.matrix[i][j], 1e-15);
+        ck_assert_double_eq_tol(scaled.matrix[i][j], A.matrix[i][j] * -2.5,
+                                1e-15);
+      }
+    }
+
+    ck_assert_int_eq(s21_eq_matrix(&A, &A), SUCCESS);
+    ck_assert_int_eq(s21_eq_matrix(&A, &B), FAILURE);
+    double saved = A.matrix[6][12];
+    A.matrix[6][12] = NAN;
+    ck_assert_int_eq(s21_eq_matrix(&A, &A), FAILURE);
+    A.matrix[6][12] = saved;
+
+    _free_matrix(&scaled);
+    _free_matrix(&sub);
+    _free_matrix(&sum);
+  }
+
+  s21_set_isa(S21_ISA_AUTO);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_isa_mult_all_levels) {
+  const int m = 101, k = 67, n = 45;
+  matrix_t A, B;
+  _alloc_matrix(&A, m, k);
+  _alloc_matrix(&B, k, n);
+  _fill_matrix(&A, 0.5);
+  _fill_matrix(&B, 2.0);
+
+  for (int l = 0; l < 3; ++l) {
+    if (s21_set_isa(isa_levels[l]) != S21_OK) continue;
+
+    matrix_t C;
+    ck_assert_int_eq(s21_mult_matrix(&A, &B, &C), S21_OK);
+    for (int i = 0; i < m; ++i) {
+      for (int j = 0; j < n; ++j) {
+        double expected = 0.0;
+        for (int p = 0; p < k; ++p) expected += A.matrix[i][p] * B.matrix[p][j];
+        ck_assert_double_eq_tol(C.matrix[i][j], expected, 1e-9);
+      }
+    }
+    _free_matrix(&C);
+  }
+
+  s21_set_isa(S21_ISA_AUTO);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_isa_transpose_tiles) {
+  matrix_t A, T;
+  _alloc_matrix(&A, 70, 45);
+  _fill_matrix(&A, 3.0);
+
+  ck_assert_int_eq(s21_transpose(&A, &T), S21_OK);
+  ck_assert_int_eq(T.rows, 45);
+  ck_assert_int_eq(T.columns, 70);
+  for (int i = 0; i < 70; ++i)
+    for (int j = 0; j < 45; ++j)
+      ck_assert_double_eq_tol(T.matrix[j][i], A.matrix[i][j], 1e-15);
+
+  _free_matrix(&T);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_isa_gemv_all_levels) {
+  for (int l = 0; l < 3; ++l) {
+    if (s21_set_isa(isa_levels[l]) != S21_OK) continue;
+
+    /* Lengths 1..19 hit every vector tail of the dot4 and axpy4 kernels. */
+    for (int k = 1; k < 20; ++k) {
+      matrix_t A, x, w, y, z;
+      _alloc_matrix(&A, 9, k);
+      _alloc_matrix(&x, k, 1);
+      _alloc_matrix(&w, 1, 9);
+      _fill_matrix(&A, 0.5);
+      _fill_matrix(&x, 2.0);
+      _fill_matrix(&w, 4.0);
+
+      ck_assert_int_eq(s21_mult_matrix(&A, &x, &y), S21_OK);
+      ck_assert_int_eq(s21_mult_matrix(&w, &A, &z), S21_OK);
+      for (int i = 0; i < 9; ++i) {
+        double expected = 0.0;
+        for (int p = 0; p < k; ++p) expected += A.matrix[i][p] * x.matrix[p][0];
+        ck_assert_double_eq_tol(y.matrix[i][0], expected, 1e-12);
+      }
+      for (int j = 0; j < k; ++j) {
+        double expected = 0.0;
+        for (int p = 0; p < 9; ++p) expected += w.matrix[0][p] * A.matrix[p][j];
+        ck_assert_double_eq_tol(z.matrix[0][j], expected, 1e-12);
+      }
+
+      _free_matrix(&z);
+      _free_matrix(&y);
+      _free_matrix(&w);
+      _free_matrix(&x);
+      _free_matrix(&A);
+    }
+  }
+
+  s21_set_isa(S21_ISA_AUTO);
+}
+END_TEST
+
+Suite *s21_isa_suite(void) {
+  Suite *s = suite_create("isa");
+  TCase *tc = tcase_create("core");
+
+  tcase_add_test(tc, test_isa_invalid_level);
+  tcase_add_test(tc, test_isa_scalar_always_available);
+  tcase_add_test(tc, test_isa_elementwise_all_levels);
+  tcase_add_test(tc, test_isa_mult_all_levels);
+  tcase_add_test(tc, test_isa_transpose_tiles);
+
+  tcase_add_test(tc, test_isa_gemv_all_levels);
+  suite_add_tcase(s, tc);
+  return s;
+}
@@ -0,0 +1,162 @@
+#include <check.h>
+
+#include "../include/s21_matrix.h"
+#include "../include/s21_suites.h"
+#include "../include/test_helpers.h"
+
+START_TEST(test_matrix_pool_disabled_by_default) {
+  s21_matrix_pool_stats_t before, after;
+  s21_matrix_pool_stats(&before);
+
+  matrix_t A;
+  ck_assert_int_eq(s21_create_matrix(3, 3, &A), S21_OK);
+  s21_remove_matrix(&A);
+  ck_assert_int_eq(s21_create_matrix(3, 3, &A), S21_OK);
+  s21_remove_matrix(&A);
+
+  s21_matrix_pool_stats(&after);
+  ck_assert_uint_eq(after.hits, before.hits);
+  ck_assert_uint_eq(after.misses, before.misses);
+  ck_assert_uint_eq(after.retained_blocks, 0);
+}
+END_TEST
+
+START_TEST(test_matrix_pool_reuses_shape) {
+  s21_set_matrix_pool(1 << 20);
+  s21_matrix_pool_stats_t before, after;
+  s21_matrix_pool_stats(&before);
+
+  matrix_t A, B;
+  ck_assert_int_eq(s21_create_matrix(4, 5, &A), S21_OK);
+  double **block = A.matrix;
+  for (int i = 0; i < 4; ++i)
+    for (int j = 0; j < 5; ++j) A.matrix[i][j] = i + j + 1.0;
+  s21_remove_matrix(&A);
+
+  s21_matrix_pool_stats(&after);
+  ck_assert_uint_eq(after.retained_blocks, 1);
+
+  ck_assert_int_eq(s21_create_matrix(5, 4, &B), S21_OK);
+  ck_assert_ptr_ne(B.matrix, block);
+  ck_assert_int_eq(s21_create_matrix(4, 5, &A), S21_OK);
+  ck_assert_ptr_eq(A.matrix, block);
+  for (int i = 0; i < 4; ++i) {
+    ck_assert_ptr_eq(A.matrix[i], (double *)(A.matrix + 4) + i * 5);
+    for (int j = 0; j < 5; ++j) ck_assert_double_eq(A.matrix[i][j], 0.0);
+  }
+
+  s21_matrix_pool_stats(&after);
+  ck_assert_uint_eq(after.hits - before.hits, 1);
+  ck_assert_uint_eq(after.misses - before.misses, 2);
+  ck_assert_uint_eq(after.retained_blocks, 0);
+
+  s21_remove_matrix(&A);
+  s21_remove_matrix(&B);
+  s21_set_matrix_pool(0);
+  s21_matrix_pool_stats(&after);
+  ck_assert_uint_eq(after.retained_blocks, 0);
+  ck_assert_uint_eq(after.retained_bytes, 0);
+}
+END_TEST
+
+START_TEST(test_matrix_pool_uninit) {
+  s21_set_matrix_pool(1 << 20);
+
+  matrix_t A;
+  ck_assert_int_eq(s21_create_matrix_uninit(3, 2, &A), S21_OK);
+  double **block = A.matrix;
+  A.matrix[2][1] = 42.0;
+  s21_remove_matrix(&A);
+
+  ck_assert_int_eq(s21_create_matrix_uninit(3, 2, &A), S21_OK);
+  ck_assert_ptr_eq(A.matrix, block);
+  ck_assert_int_eq(A.rows, 3);
+  ck_assert_int_eq(A.columns, 2);
+  ck_assert_ptr_eq(A.matrix[2], A.matrix[0] + 4);
+
+  s21_remove_matrix(&A);
+  s21_set_matrix_pool(0);
+}
+END_TEST
+
+START_TEST(test_matrix_pool_respects_limit) {
+  size_t bytes = 10 * sizeof(double *) + 100 * sizeof(double);
+  s21_set_matrix_pool(2 * bytes);
+
+  matrix_t M[3];
+  for (int i = 0; i < 3; ++i)
+    ck_assert_int_eq(s21_create_matrix(10, 10, &M[i]), S21_OK);
+  for (int i = 0; i < 3; ++i) s21_remove_matrix(&M[i]);
+
+  s21_matrix_pool_stats_t stats;
+  s21_matrix_pool_stats(&stats);
+  ck_assert_uint_eq(stats.retained_blocks, 2);
+  ck_assert_uint_eq(stats.retained_bytes, 2 * bytes);
+
+  s21_set_matrix_pool(bytes);
+  s21_matrix_pool_stats(&stats);
+  ck_assert_uint_eq(stats.retained_bytes, 0);
+
+  s21_set_matrix_pool(2 * bytes);
+  ck_assert_int_eq(s21_create_matrix(10, 10, &M[0]), S21_OK);
+  s21_remove_matrix(&M[0]);
+  s21_matrix_pool_trim();
+  s21_matrix_pool_stats(&stats);
+  ck_assert_uint_eq(stats.retained_blocks, 0);
+
+  s21_set_matrix_pool(0);
+}
+END_TEST
+
+START_TEST(test_matrix_pool_operations) {
+  s21_set_matrix_pool(1 << 20);
+
+  matrix_t A, B;
+  _alloc_matrix(&A, 3, 3);
+  _alloc_matrix(&B, 3, 3);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j) {
+      A.matrix[i][j] = i * 3 + j;
+      B.matrix[i][j] = 1.0;
+    }
+
+  for (int round = 0; round < 3; ++round) {
+    matrix_t sum, product, transposed;
+    ck_assert_int_eq(s21_sum_matrix(&A, &B, &sum), S21_OK);
+    ck_assert_int_eq(s21_mult_matrix(&A, &B, &product), S21_OK);
+    ck_assert_int_eq(s21_transpose(&A, &transposed), S21_OK);
+    for (int i = 0; i < 3; ++i) {
+      for (int j = 0; j < 3; ++j) {
+        ck_assert_double_eq(sum.matrix[i][j], i * 3 + j + 1.0);
+        ck_assert_double_eq(product.matrix[i][j], 9.0 * i + 3.0);
+        ck_assert_double_eq(transposed.matrix[j][i], A.matrix[i][j]);
+      }
+    }
+    s21_remove_matrix(&transposed);
+    s21_remove_matrix(&product);
+    s21_remove_matrix(&sum);
+  }
+
+  s21_matrix_pool_stats_t stats;
+  s21_matrix_pool_stats(&stats);
+  ck_assert_uint_ge(stats.hits, 6);
+
+  _free_matrix(&B);
+  _free_matrix(&A);
+  s21_set_matrix_pool(0);
+}
+END_TEST
+
+Suite *s21_matrix_pool_suite(void) {
+  Suite *s = suite_create("matrix_pool");
+  TCase *tc = tcase_create("core");
+
+  tcase_add_test(tc, test_matrix_pool_disabled_by_default);
+  tcase_add_test(tc, test_matrix_pool_reuses_shape);
+  tcase_add_test(tc, test_matrix_pool_uninit);
+  tcase_add_test(tc, test_matrix_pool_respects_limit);
+  tcase_add_test(tc, test_matrix_pool_operations);
+
+  suite_add_tcase(s, tc);
+  return s;
+}
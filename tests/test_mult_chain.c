@@ -0,0 +1,129 @@
+#include <check.h>
+
+#include "../include/s21_matrix.h"
+#include "../include/s21_suites.h"
+#include "../include/test_helpers.h"
+
+/* Left-to-right product and its flop count, for reference. */
+static double left_to_right(int count, matrix_t *chain, matrix_t *result) {
+  double flops = 0.0;
+  matrix_t acc;
+  ck_assert_int_eq(s21_mult_matrix(&chain[0], &chain[1], &acc), S21_OK);
+  flops += 2.0 * chain[0].rows * chain[0].columns * chain[1].columns;
+  for (int i = 2; i < count; ++i) {
+    matrix_t next;
+    ck_assert_int_eq(s21_mult_matrix(&acc, &chain[i], &next), S21_OK);
+    flops += 2.0 * acc.rows * acc.columns * chain[i].columns;
+    _free_matrix(&acc);
+    acc = next;
+  }
+  *result = acc;
+  return flops;
+}
+
+static void check_chain(int count, const int *dims, double expected_flops) {
+  matrix_t chain[16], *ptrs[16], R, C;
+  for (int i = 0; i < count; ++i) {
+    _alloc_matrix(&chain[i], dims[i], dims[i + 1]);
+    _fill_matrix(&chain[i], 0.1 * i);
+    ptrs[i] = &chain[i];
+  }
+
+  double flops = -1.0;
+  ck_assert_int_eq(s21_mult_chain(count, ptrs, &R, &flops), S21_OK);
+  double naive = left_to_right(count, chain, &C);
+  if (expected_flops >= 0.0) ck_assert_double_eq(flops, expected_flops);
+  ck_assert(flops <= naive);
+  ck_assert_int_eq(R.rows, dims[0]);
+  ck_assert_int_eq(R.columns, dims[count]);
+  for (int i = 0; i < R.rows; ++i)
+    for (int j = 0; j < R.columns; ++j)
+      ck_assert_double_eq_tol(R.matrix[i][j], C.matrix[i][j],
+                              1e-9 * (1.0 + fabs(C.matrix[i][j])));
+
+  _free_matrix(&C);
+  _free_matrix(&R);
+  for (int i = 0; i < count; ++i) _free_matrix(&chain[i]);
+}
+
+START_TEST(test_mult_chain_textbook) {
+  /* (A1 A2) A3 costs 10*30*5 + 10*5*60 multiply-adds, A1 (A2 A3) six times
+     as many. */
+  const int dims[] = {10, 30, 5, 60};
+  check_chain(3, dims, 2.0 * (10 * 30 * 5 + 10 * 5 * 60));
+}
+END_TEST
+
+START_TEST(test_mult_chain_mixed_shapes) {
+  const int dims[] = {40, 3, 200, 1, 90, 17, 17, 250, 2, 64, 1};
+  check_chain(10, dims, -1.0);
+
+  const int wide[] = {1, 300, 20, 300, 5};
+  check_chain(4, wide, -1.0);
+
+  const int pair[] = {7, 9, 11};
+  check_chain(2, pair, 2.0 * 7 * 9 * 11);
+}
+END_TEST
+
+START_TEST(test_mult_chain_single) {
+  matrix_t A, R;
+  _alloc_matrix(&A, 3, 4);
+  _fill_matrix(&A, 0.5);
+  matrix_t *chain[] = {&A};
+  double flops = -1.0;
+  ck_assert_int_eq(s21_mult_chain(1, chain, &R, &flops), S21_OK);
+  ck_assert_double_eq(flops, 0.0);
+  ck_assert_int_eq(s21_eq_matrix(&A, &R), SUCCESS);
+  ck_assert_ptr_ne(R.matrix[0], A.matrix[0]);
+  _free_matrix(&R);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_mult_chain_flops_optional) {
+  matrix_t A, B, R;
+  _alloc_matrix(&A, 2, 3);
+  _alloc_matrix(&B, 3, 2);
+  _fill_matrix(&A, 0.0);
+  _fill_matrix(&B, 1.0);
+  matrix_t *chain[] = {&A, &B};
+  ck_assert_int_eq(s21_mult_chain(2, chain, &R, NULL), S21_OK);
+  ck_assert_int_eq(R.rows, 2);
+  ck_assert_int_eq(R.columns, 2);
+  _free_matrix(&R);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_mult_chain_invalid) {
+  matrix_t A, B, R;
+  _alloc_matrix(&A, 2, 3);
+  _alloc_matrix(&B, 2, 3);
+  matrix_t *chain[] = {&A, &B};
+  matrix_t *holes[] = {&A, NULL};
+  ck_assert_int_eq(s21_mult_chain(2, chain, &R, NULL), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_mult_chain(0, chain, &R, NULL), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_mult_chain(2, NULL, &R, NULL), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_mult_chain(2, holes, &R, NULL), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_mult_chain(2, chain, NULL, NULL),
+                   S21_INCORRECT_MATRIX);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+Suite *s21_mult_chain_suite(void) {
+  Suite *s = suite_create("mult_chain");
+  TCase *tc = tcase_create("core");
+
+  tcase_add_test(tc, test_mult_chain_textbook);
+  tcase_add_test(tc, test_mult_chain_mixed_shapes);
+  tcase_add_test(tc, test_mult_chain_single);
+  tcase_add_test(tc, test_mult_chain_flops_optional);
+  tcase_add_test(tc, test_mult_chain_invalid);
+
+  suite_add_tcase(s, tc);
+  return s;
+}
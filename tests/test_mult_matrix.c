@@ -242,6 +242,487 @@ START_TEST(test_mult_with_nan_and_inf) {
 }
 END_TEST
 
+START_TEST(test_mult_blocked_odd_sizes) {
+  const int m = 97, k = 300, n = 131;
+  matrix_t A, B, result;
+  _alloc_matrix(&A, m, k);
+  _alloc_matrix(&B, k, n);
+  for (int i = 0; i < m; ++i)
+    for (int p = 0; p < k; ++p) A.matrix[i][p] = sin((double)(i * k + p));
+  for (int p = 0; p < k; ++p)
+    for (int j = 0; j < n; ++j) B.matrix[p][j] = cos((double)(p * n + j));
+
+  int rc = s21_mult_matrix(&A, &B, &result);
+  ck_assert_int_eq(rc, 0);
+  ck_assert_int_eq(result.rows, m);
+  ck_assert_int_eq(result.columns, n);
+
+  for (int i = 0; i < m; ++i) {
+    for (int j = 0; j < n; ++j) {
+      double expected = 0.0;
+      for (int p = 0; p < k; ++p) expected += A.matrix[i][p] * B.matrix[p][j];
+      ck_assert_ldouble_eq_tol(result.matrix[i][j], expected, S21_EPS);
+    }
+  }
+
+  _free_matrix(&result);
+  _free_matrix(&A);
+  _free_matrix(&B);
+}
+END_TEST
+
+START_TEST(test_mult_into_overwrites_result) {
+  matrix_t A, B, result;
+  _alloc_matrix(&A, 2, 3);
+  _alloc_matrix(&B, 3, 2);
+  _alloc_matrix(&result, 2, 2);
+  for (int i = 0; i < 2; ++i)
+    for (int j = 0; j < 3; ++j) {
+      A.matrix[i][j] = i + j + 1;
+      B.matrix[j][i] = j - i;
+    }
+  for (int i = 0; i < 2; ++i)
+    for (int j = 0; j < 2; ++j) result.matrix[i][j] = 1e9;
+
+  matrix_t expected;
+  ck_assert_int_eq(s21_mult_matrix(&A, &B, &expected), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix_into(&A, &B, &result), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&result, &expected), SUCCESS);
+
+  matrix_t wrong;
+  _alloc_matrix(&wrong, 3, 3);
+  ck_assert_int_eq(s21_mult_matrix_into(&A, &B, &wrong), S21_CALC_ERROR);
+
+  _free_matrix(&wrong);
+  _free_matrix(&expected);
+  _free_matrix(&result);
+  _free_matrix(&A);
+  _free_matrix(&B);
+}
+END_TEST
+
+START_TEST(test_mult_into_aliased_operands) {
+  int n = 70;
+  matrix_t A, B, expected;
+  ck_assert_int_eq(s21_create_matrix(n, n, &A), S21_OK);
+  _alloc_matrix(&B, n, n);
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j) {
+      A.matrix[i][j] = sin(i * n + j);
+      B.matrix[i][j] = cos(i - 2.0 * j);
+    }
+
+  ck_assert_int_eq(s21_mult_matrix(&A, &B, &expected), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix_into(&A, &B, &A), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&A, &expected), SUCCESS);
+  _free_matrix(&expected);
+
+  ck_assert_int_eq(s21_mult_matrix(&B, &B, &expected), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix_into(&B, &B, &B), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&B, &expected), SUCCESS);
+
+  _free_matrix(&expected);
+  _free_matrix(&A);
+  _free_matrix(&B);
+}
+END_TEST
+
+START_TEST(test_mult_into_partial_overlap) {
+  /* X is rows 0 .. n - 1 of A and C rows 1 .. n: neither the row arrays
+     nor the first elements coincide, but the storage does. */
+  int n = 70;
+  matrix_t A, I, expected;
+  ck_assert_int_eq(s21_create_matrix(n + 1, n, &A), S21_OK);
+  ck_assert_int_eq(s21_create_matrix(n, n, &I), S21_OK);
+  for (int i = 0; i <= n; ++i)
+    for (int j = 0; j < n; ++j) A.matrix[i][j] = sin(i * n + j);
+  for (int i = 0; i < n; ++i) I.matrix[i][i] = 1.0;
+  matrix_t X = {A.matrix, n, n};
+  matrix_t C = {A.matrix + 1, n, n};
+
+  ck_assert_int_eq(s21_mult_matrix(&X, &I, &expected), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix_into(&X, &I, &C), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&C, &expected), SUCCESS);
+  _free_matrix(&expected);
+
+  ck_assert_int_eq(s21_mult_matrix(&C, &I, &expected), S21_OK);
+  ck_assert_int_eq(s21_gemm(1.0, &C, &I, 0.0, &X), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&X, &expected), SUCCESS);
+  _free_matrix(&expected);
+
+  _free_matrix(&I);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_mult_small_square) {
+  for (int n = 2; n <= 4; ++n) {
+    matrix_t A, B, result;
+    _alloc_matrix(&A, n, n);
+    _alloc_matrix(&B, n, n);
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j < n; ++j)
+        A.matrix[i][j] = sin(1.7 * i + 0.9 * j + n) + (i == j) * 0.5;
+
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j < n; ++j) B.matrix[i][j] = cos(i - 2.0 * j);
+
+    ck_assert_int_eq(s21_mult_matrix(&A, &B, &result), S21_OK);
+    for (int i = 0; i < n; ++i) {
+      for (int j = 0; j < n; ++j) {
+        double expected = 0.0;
+        for (int k = 0; k < n; ++k)
+          expected += A.matrix[i][k] * B.matrix[k][j];
+        ck_assert_double_eq_tol(result.matrix[i][j], expected, 1e-14);
+      }
+    }
+
+    ck_assert_int_eq(s21_mult_matrix_into(&A, &B, &A), S21_OK);
+    ck_assert_int_eq(s21_eq_matrix(&A, &result), SUCCESS);
+
+    _free_matrix(&result);
+    _free_matrix(&B);
+    _free_matrix(&A);
+  }
+}
+END_TEST
+
+START_TEST(test_gemm_alpha_beta) {
+  const int sizes[][3] = {{3, 4, 5}, {97, 300, 131}};
+  const double scales[][2] = {{1.0, 1.0}, {0.5, 1.0}, {-2.0, 0.0},
+                              {1.0, -0.25}, {0.0, 3.0}};
+  for (int s = 0; s < 2; ++s) {
+    int m = sizes[s][0], k = sizes[s][1], n = sizes[s][2];
+    matrix_t A, B, C, C0;
+    _alloc_matrix(&A, m, k);
+    _alloc_matrix(&B, k, n);
+    _alloc_matrix(&C, m, n);
+    _alloc_matrix(&C0, m, n);
+    _fill_matrix(&A, 0.1);
+    _fill_matrix(&B, 0.7);
+    _fill_matrix(&C0, 2.3);
+    for (int t = 0; t < 5; ++t) {
+      double alpha = scales[t][0], beta = scales[t][1];
+      for (int i = 0; i < m; ++i)
+        for (int j = 0; j < n; ++j) C.matrix[i][j] = C0.matrix[i][j];
+
+      ck_assert_int_eq(s21_gemm(alpha, &A, &B, beta, &C), S21_OK);
+      for (int i = 0; i < m; ++i) {
+        for (int j = 0; j < n; ++j) {
+          double ab = 0.0;
+          for (int p = 0; p < k; ++p) ab += A.matrix[i][p] * B.matrix[p][j];
+          double expected = alpha * ab + beta * C0.matrix[i][j];
+          ck_assert_double_eq_tol(C.matrix[i][j], expected, 1e-10);
+        }
+      }
+    }
+    _free_matrix(&C0);
+    _free_matrix(&C);
+    _free_matrix(&B);
+    _free_matrix(&A);
+  }
+}
+END_TEST
+
+START_TEST(test_gemm_beta_zero_ignores_c) {
+  const int sizes[] = {4, 150};
+  for (int s = 0; s < 2; ++s) {
+    int n = sizes[s];
+    matrix_t A, B, C, expected;
+    _alloc_matrix(&A, n, n);
+    _alloc_matrix(&B, n, n);
+    _alloc_matrix(&C, n, n);
+    _fill_matrix(&A, 0.4);
+    _fill_matrix(&B, 1.9);
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j < n; ++j) C.matrix[i][j] = NAN;
+
+    ck_assert_int_eq(s21_mult_matrix(&A, &B, &expected), S21_OK);
+    ck_assert_int_eq(s21_gemm(1.0, &A, &B, 0.0, &C), S21_OK);
+    ck_assert_int_eq(s21_eq_matrix(&C, &expected), SUCCESS);
+
+    _free_matrix(&expected);
+    _free_matrix(&C);
+    _free_matrix(&B);
+    _free_matrix(&A);
+  }
+}
+END_TEST
+
+START_TEST(test_gemm_aliased) {
+  int n = 70;
+  matrix_t A, B, expected;
+  ck_assert_int_eq(s21_create_matrix(n, n, &A), S21_OK);
+  _alloc_matrix(&B, n, n);
+  _fill_matrix(&A, 0.2);
+  _fill_matrix(&B, 1.1);
+
+  ck_assert_int_eq(s21_mult_matrix(&A, &B, &expected), S21_OK);
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j)
+      expected.matrix[i][j] = 2.0 * expected.matrix[i][j] - A.matrix[i][j];
+
+  ck_assert_int_eq(s21_gemm(2.0, &A, &B, -1.0, &A), S21_OK);
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j)
+      ck_assert_double_eq_tol(A.matrix[i][j], expected.matrix[i][j], 1e-12);
+
+  _free_matrix(&expected);
+  _free_matrix(&A);
+  _free_matrix(&B);
+}
+END_TEST
+
+START_TEST(test_gemm_invalid) {
+  matrix_t A, B, C, bad = {NULL, 2, 2};
+  _alloc_matrix(&A, 2, 3);
+  _alloc_matrix(&B, 3, 2);
+  _alloc_matrix(&C, 3, 3);
+
+  ck_assert_int_eq(s21_gemm(1.0, NULL, &B, 0.0, &C), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_gemm(1.0, &A, &B, 0.0, NULL), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_gemm(1.0, &A, &bad, 0.0, &C), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_gemm(1.0, &A, &B, 0.0, &C), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_gemm(1.0, &A, &A, 0.0, &C), S21_CALC_ERROR);
+
+  _free_matrix(&C);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_mult_trans_flags) {
+  const int sizes[][3] = {{3, 4, 5}, {97, 300, 131}};
+  for (int s = 0; s < 2; ++s) {
+    int m = sizes[s][0], k = sizes[s][1], n = sizes[s][2];
+    matrix_t A, B, At, Bt;
+    _alloc_matrix(&A, m, k);
+    _alloc_matrix(&B, k, n);
+    _fill_matrix(&A, 0.3);
+    _fill_matrix(&B, 1.7);
+    ck_assert_int_eq(s21_transpose(&A, &At), S21_OK);
+    ck_assert_int_eq(s21_transpose(&B, &Bt), S21_OK);
+
+    matrix_t expected;
+    ck_assert_int_eq(s21_mult_matrix(&A, &B, &expected), S21_OK);
+    for (int t = 0; t < 4; ++t) {
+      int trans_a = t & 1, trans_b = t >> 1;
+      matrix_t result;
+      ck_assert_int_eq(s21_mult_matrix_trans(trans_a ? &At : &A, trans_a,
+                                             trans_b ? &Bt : &B, trans_b,
+                                             &result),
+                       S21_OK);
+      ck_assert_int_eq(result.rows, m);
+      ck_assert_int_eq(result.columns, n);
+      for (int i = 0; i < m; ++i)
+        for (int j = 0; j < n; ++j)
+          ck_assert_double_eq_tol(result.matrix[i][j], expected.matrix[i][j],
+                                  1e-10);
+      _free_matrix(&result);
+    }
+
+    _free_matrix(&expected);
+    _free_matrix(&Bt);
+    _free_matrix(&At);
+    _free_matrix(&B);
+    _free_matrix(&A);
+  }
+}
+END_TEST
+
+START_TEST(test_gemm_trans_gram) {
+  int rows = 300, n = 70;
+  matrix_t X, G, Xt, expected;
+  ck_assert_int_eq(s21_create_matrix(rows, n, &X), S21_OK);
+  _alloc_matrix(&G, n, n);
+  _fill_matrix(&X, 0.9);
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j) G.matrix[i][j] = i == j;
+
+  ck_assert_int_eq(s21_transpose(&X, &Xt), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix(&Xt, &X, &expected), S21_OK);
+  ck_assert_int_eq(
+      s21_gemm_trans(S21_TRANS, S21_NO_TRANS, 0.5, &X, &X, 2.0, &G), S21_OK);
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j)
+      ck_assert_double_eq_tol(G.matrix[i][j],
+                              0.5 * expected.matrix[i][j] + 2.0 * (i == j),
+                              1e-10);
+
+  /* X * X^T written back over a square operand. */
+  matrix_t S, St;
+  _alloc_matrix(&S, n, n);
+  _fill_matrix(&S, 0.2);
+  ck_assert_int_eq(s21_transpose(&S, &St), S21_OK);
+  _free_matrix(&expected);
+  ck_assert_int_eq(s21_mult_matrix(&S, &St, &expected), S21_OK);
+  ck_assert_int_eq(
+      s21_gemm_trans(S21_NO_TRANS, S21_TRANS, 1.0, &S, &S, 0.0, &S), S21_OK);
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j)
+      ck_assert_double_eq_tol(S.matrix[i][j], expected.matrix[i][j], 1e-10);
+
+  _free_matrix(&St);
+  _free_matrix(&S);
+  _free_matrix(&expected);
+  _free_matrix(&Xt);
+  _free_matrix(&G);
+  _free_matrix(&X);
+}
+END_TEST
+
+START_TEST(test_mult_trans_invalid) {
+  matrix_t A, B, C, result;
+  _alloc_matrix(&A, 2, 3);
+  _alloc_matrix(&B, 2, 3);
+  _alloc_matrix(&C, 3, 3);
+
+  ck_assert_int_eq(s21_mult_matrix_trans(NULL, 0, &B, 0, &result),
+                   S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_mult_matrix_trans(&A, 0, &B, 0, NULL),
+                   S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_mult_matrix_trans(&A, 0, &B, 0, &result),
+                   S21_CALC_ERROR);
+  ck_assert_int_eq(s21_mult_matrix_trans(&A, 2, &B, 1, &result),
+                   S21_CALC_ERROR);
+  ck_assert_int_eq(s21_gemm_trans(0, -1, 1.0, &A, &B, 0.0, &C),
+                   S21_CALC_ERROR);
+  ck_assert_int_eq(s21_gemm_trans(1, 0, 1.0, &A, &B, 0.0, &C), S21_OK);
+  ck_assert_int_eq(s21_gemm_trans(0, 1, 1.0, &A, &B, 0.0, &C),
+                   S21_CALC_ERROR);
+  ck_assert_int_eq(s21_gemm_trans(0, 1, 1.0, &A, &B, 0.0, NULL),
+                   S21_INCORRECT_MATRIX);
+
+  _free_matrix(&C);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+/* Reference op(A) * op(B) element for the vector tests. */
+static double _ref_product(const matrix_t *A, int trans_a, const matrix_t *B,
+                           int trans_b, int i, int j, int k) {
+  double sum = 0.0;
+  for (int p = 0; p < k; ++p) {
+    double a = trans_a ? A->matrix[p][i] : A->matrix[i][p];
+    double b = trans_b ? B->matrix[j][p] : B->matrix[p][j];
+    sum += a * b;
+  }
+  return sum;
+}
+
+START_TEST(test_mult_matrix_vector) {
+  const int sizes[][2] = {{1, 1}, {3, 7}, {13, 33}, {517, 300}, {64, 4099}};
+  for (int s = 0; s < 5; ++s) {
+    int m = sizes[s][0], k = sizes[s][1];
+    for (int dense = 0; dense < 2; ++dense) {
+      matrix_t A, x, y;
+      if (dense) {
+        ck_assert_int_eq(s21_create_matrix(m, k, &A), S21_OK);
+        ck_assert_int_eq(s21_create_matrix(k, 1, &x), S21_OK);
+      } else {
+        _alloc_matrix(&A, m, k);
+        _alloc_matrix(&x, k, 1);
+      }
+      _fill_matrix(&A, 0.5);
+      _fill_matrix(&x, 1.5);
+
+      ck_assert_int_eq(s21_mult_matrix(&A, &x, &y), S21_OK);
+      ck_assert_int_eq(y.rows, m);
+      ck_assert_int_eq(y.columns, 1);
+      for (int i = 0; i < m; ++i)
+        ck_assert_double_eq_tol(y.matrix[i][0],
+                                _ref_product(&A, 0, &x, 0, i, 0, k), 1e-10);
+
+      /* y = 2 A x - y into a row-allocated y. */
+      matrix_t z;
+      _alloc_matrix(&z, m, 1);
+      for (int i = 0; i < m; ++i) z.matrix[i][0] = y.matrix[i][0];
+      ck_assert_int_eq(s21_gemm(2.0, &A, &x, -1.0, &z), S21_OK);
+      for (int i = 0; i < m; ++i)
+        ck_assert_double_eq_tol(z.matrix[i][0], y.matrix[i][0], 1e-10);
+
+      _free_matrix(&z);
+      _free_matrix(&y);
+      _free_matrix(&x);
+      _free_matrix(&A);
+    }
+  }
+}
+END_TEST
+
+START_TEST(test_mult_vector_matrix) {
+  const int sizes[][2] = {{5, 3}, {300, 1100}, {2500, 9}};
+  for (int s = 0; s < 3; ++s) {
+    int k = sizes[s][0], n = sizes[s][1];
+    matrix_t x, B, y;
+    _alloc_matrix(&x, 1, k);
+    _alloc_matrix(&B, k, n);
+    _fill_matrix(&x, 0.1);
+    _fill_matrix(&B, 2.1);
+
+    ck_assert_int_eq(s21_mult_matrix(&x, &B, &y), S21_OK);
+    ck_assert_int_eq(y.rows, 1);
+    ck_assert_int_eq(y.columns, n);
+    for (int j = 0; j < n; ++j)
+      ck_assert_double_eq_tol(y.matrix[0][j],
+                              _ref_product(&x, 0, &B, 0, 0, j, k), 1e-10);
+
+    /* A stale NaN in C is not read with beta == 0. */
+    for (int j = 0; j < n; ++j) y.matrix[0][j] = NAN;
+    ck_assert_int_eq(s21_gemm(-1.0, &x, &B, 0.0, &y), S21_OK);
+    for (int j = 0; j < n; ++j)
+      ck_assert_double_eq_tol(y.matrix[0][j],
+                              -_ref_product(&x, 0, &B, 0, 0, j, k), 1e-10);
+
+    _free_matrix(&y);
+    _free_matrix(&B);
+    _free_matrix(&x);
+  }
+}
+END_TEST
+
+START_TEST(test_mult_vector_trans_flags) {
+  const int m = 70, k = 301;
+  matrix_t M, Mt, v, vt;
+  _alloc_matrix(&M, m, k);
+  _alloc_matrix(&v, k, 1);
+  _fill_matrix(&M, 0.8);
+  _fill_matrix(&v, 0.3);
+  ck_assert_int_eq(s21_transpose(&M, &Mt), S21_OK);
+  ck_assert_int_eq(s21_transpose(&v, &vt), S21_OK);
+
+  /* Every flag combination of M v and v^T M^T, column and row results. */
+  for (int t = 0; t < 4; ++t) {
+    int trans_a = t & 1, trans_b = t >> 1;
+    matrix_t *A = trans_a ? &Mt : &M, *B = trans_b ? &vt : &v;
+    matrix_t col, row;
+    ck_assert_int_eq(s21_mult_matrix_trans(A, trans_a, B, trans_b, &col),
+                     S21_OK);
+    ck_assert_int_eq(col.rows, m);
+    ck_assert_int_eq(col.columns, 1);
+
+    matrix_t *X = trans_b ? &v : &vt, *Y = trans_a ? &M : &Mt;
+    ck_assert_int_eq(s21_mult_matrix_trans(X, trans_b, Y, trans_a, &row),
+                     S21_OK);
+    ck_assert_int_eq(row.rows, 1);
+    ck_assert_int_eq(row.columns, m);
+    for (int i = 0; i < m; ++i) {
+      double expected = _ref_product(&M, 0, &v, 0, i, 0, k);
+      ck_assert_double_eq_tol(col.matrix[i][0], expected, 1e-10);
+      ck_assert_double_eq_tol(row.matrix[0][i], expected, 1e-10);
+    }
+    _free_matrix(&row);
+    _free_matrix(&col);
+  }
+
+  _free_matrix(&vt);
+  _free_matrix(&v);
+  _free_matrix(&Mt);
+  _free_matrix(&M);
+}
+END_TEST
+
 Suite *s21_mult_matrix_suite(void) {
   Suite *s = suite_create("mult_matrix");
   TCase *tc = tcase_create("core");
@@ -260,7 +741,22 @@ Suite *s21_mult_matrix_suite(void) {
   tcase_add_test(tc, test_mult_with_zero_matrix);
 
   tcase_add_test(tc, test_mult_with_nan_and_inf);
-
+  tcase_add_test(tc, test_mult_blocked_odd_sizes);
+
+  tcase_add_test(tc, test_mult_into_overwrites_result);
+  tcase_add_test(tc, test_mult_into_aliased_operands);
+  tcase_add_test(tc, test_mult_into_partial_overlap);
+  tcase_add_test(tc, test_mult_small_square);
+  tcase_add_test(tc, test_gemm_alpha_beta);
+  tcase_add_test(tc, test_gemm_beta_zero_ignores_c);
+  tcase_add_test(tc, test_gemm_aliased);
+  tcase_add_test(tc, test_gemm_invalid);
+  tcase_add_test(tc, test_mult_trans_flags);
+  tcase_add_test(tc, test_gemm_trans_gram);
+  tcase_add_test(tc, test_mult_trans_invalid);
+  tcase_add_test(tc, test_mult_matrix_vector);
+  tcase_add_test(tc, test_mult_vector_matrix);
+  tcase_add_test(tc, test_mult_vector_trans_flags);
   suite_add_tcase(s, tc);
   return s;
 }
@@ -122,6 +122,27 @@ START_TEST(test_mult_number_nan_and_inf) {
 }
 END_TEST
 
+START_TEST(test_mult_number_into_in_place) {
+  matrix_t A;
+  ck_assert_int_eq(s21_create_matrix(3, 4, &A), S21_OK);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j) A.matrix[i][j] = i - j;
+
+  ck_assert_int_eq(s21_mult_number_into(&A, -3.0, &A), S21_OK);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j)
+      ck_assert_double_eq(A.matrix[i][j], -3.0 * (i - j));
+
+  matrix_t wrong;
+  _alloc_matrix(&wrong, 4, 3);
+  ck_assert_int_eq(s21_mult_number_into(&A, 2.0, &wrong), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_mult_number_into(NULL, 2.0, &A), S21_INCORRECT_MATRIX);
+
+  _free_matrix(&wrong);
+  _free_matrix(&A);
+}
+END_TEST
+
 Suite *s21_mult_number_suite(void) {
   Suite *s = suite_create("mult_number");
   TCase *tc = tcase_create("core");
@@ -135,6 +156,7 @@ Suite *s21_mult_number_suite(void) {
   tcase_add_test(tc, test_mult_number_negative_and_fraction);
   tcase_add_test(tc, test_mult_number_nan_and_inf);
 
+  tcase_add_test(tc, test_mult_number_into_in_place);
   suite_add_tcase(s, tc);
   return s;
 }
\ No newline at end of file
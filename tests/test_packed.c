@@ -0,0 +1,357 @@
+#include <check.h>
+
+#include "../include/s21_matrix.h"
+#include "../include/s21_suites.h"
+#include "../include/test_helpers.h"
+
+static const int kinds[] = {S21_PACKED_SYMMETRIC, S21_PACKED_TRIANGULAR,
+                            S21_PACKED_UNIT_TRIANGULAR};
+static const int uplos[] = {S21_PACKED_LOWER, S21_PACKED_UPPER};
+
+/* Dense matrix with the structure of a packed one: mirrored, or zero
+   outside the triangle, with a unit diagonal when asked. Entries decay away
+   from the diagonal, which is shifted by `shift` to keep triangular solves
+   well conditioned. */
+static void fill_structured(matrix_t *M, int kind, int uplo, double shift) {
+  int n = M->rows;
+  for (int i = 0; i < n; i++)
+    for (int j = 0; j < n; j++) {
+      int r = uplo == S21_PACKED_LOWER ? (i > j ? i : j) : (i < j ? i : j);
+      int c = uplo == S21_PACKED_LOWER ? (i > j ? j : i) : (i < j ? j : i);
+      double d = 1.0 + abs(i - j);
+      double v = sin(0.37 * r + 1.1 * c + 0.2) / (d * d);
+      int stored = uplo == S21_PACKED_LOWER ? j <= i : j >= i;
+      if (i == j) v += shift;
+      if (kind != S21_PACKED_SYMMETRIC && !stored) v = 0.0;
+      if (kind == S21_PACKED_UNIT_TRIANGULAR && i == j) v = 1.0;
+      M->matrix[i][j] = v;
+    }
+}
+
+static void assert_close(matrix_t *A, matrix_t *B, double tol) {
+  ck_assert_int_eq(A->rows, B->rows);
+  ck_assert_int_eq(A->columns, B->columns);
+  for (int i = 0; i < A->rows; ++i)
+    for (int j = 0; j < A->columns; ++j)
+      ck_assert_double_eq_tol(A->matrix[i][j], B->matrix[i][j], tol);
+}
+
+START_TEST(test_packed_storage) {
+  s21_packed_t S, L, U;
+  double value = 0.0;
+
+  ck_assert_int_eq(
+      s21_packed_create(4, S21_PACKED_SYMMETRIC, S21_PACKED_UPPER, &S),
+      S21_OK);
+  ck_assert_int_eq(s21_packed_set(&S, 3, 1, 2.5), S21_OK);
+  ck_assert_int_eq(s21_packed_get(&S, 1, 3, &value), S21_OK);
+  ck_assert_double_eq(value, 2.5);
+  ck_assert_int_eq(s21_packed_get(&S, 3, 1, &value), S21_OK);
+  ck_assert_double_eq(value, 2.5);
+  ck_assert_int_eq(s21_packed_get(&S, 4, 1, &value), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_packed_set(&S, 0, -1, 1.0), S21_CALC_ERROR);
+
+  ck_assert_int_eq(
+      s21_packed_create(4, S21_PACKED_TRIANGULAR, S21_PACKED_LOWER, &L),
+      S21_OK);
+  ck_assert_int_eq(s21_packed_set(&L, 2, 1, -3.0), S21_OK);
+  ck_assert_int_eq(s21_packed_set(&L, 1, 2, 1.0), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_packed_get(&L, 1, 2, &value), S21_OK);
+  ck_assert_double_eq(value, 0.0);
+  ck_assert_int_eq(s21_packed_get(&L, 2, 1, &value), S21_OK);
+  ck_assert_double_eq(value, -3.0);
+
+  ck_assert_int_eq(
+      s21_packed_create(3, S21_PACKED_UNIT_TRIANGULAR, S21_PACKED_UPPER, &U),
+      S21_OK);
+  ck_assert_int_eq(s21_packed_set(&U, 1, 1, 5.0), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_packed_set(&U, 0, 2, 5.0), S21_OK);
+  ck_assert_int_eq(s21_packed_get(&U, 2, 2, &value), S21_OK);
+  ck_assert_double_eq(value, 1.0);
+
+  s21_packed_free(&U);
+  s21_packed_free(&L);
+  s21_packed_free(&S);
+  ck_assert_ptr_null(S.data);
+
+  ck_assert_int_eq(
+      s21_packed_create(0, S21_PACKED_SYMMETRIC, S21_PACKED_LOWER, &S),
+      S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_packed_create(3, 3, S21_PACKED_LOWER, &S),
+                   S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_packed_create(3, S21_PACKED_SYMMETRIC, 2, &S),
+                   S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_packed_get(NULL, 0, 0, &value), S21_INCORRECT_MATRIX);
+}
+END_TEST
+
+START_TEST(test_packed_dense_round_trip) {
+  for (int k = 0; k < 3; k++)
+    for (int u = 0; u < 2; u++) {
+      matrix_t D, R;
+      s21_packed_t P;
+      _alloc_matrix(&D, 11, 11);
+      fill_structured(&D, kinds[k], uplos[u], 0.0);
+      ck_assert_int_eq(s21_packed_from_dense(&D, kinds[k], uplos[u], &P),
+                       S21_OK);
+      ck_assert_int_eq(s21_packed_to_dense(&P, &R), S21_OK);
+      ck_assert_int_eq(s21_eq_matrix(&D, &R), SUCCESS);
+      for (int i = 0; i < 11; i++)
+        for (int j = 0; j < 11; j++) {
+          double value = 0.0;
+          ck_assert_int_eq(s21_packed_get(&P, i, j, &value), S21_OK);
+          ck_assert_double_eq(value, D.matrix[i][j]);
+        }
+      _free_matrix(&R);
+      s21_packed_free(&P);
+      _free_matrix(&D);
+    }
+
+  matrix_t W;
+  s21_packed_t P;
+  _alloc_matrix(&W, 3, 4);
+  ck_assert_int_eq(
+      s21_packed_from_dense(&W, S21_PACKED_SYMMETRIC, S21_PACKED_LOWER, &P),
+      S21_CALC_ERROR);
+  _free_matrix(&W);
+}
+END_TEST
+
+START_TEST(test_packed_mult_dense) {
+  /* 300 spans two 256-row blocks, so both GEMM passes are exercised. */
+  const int orders[] = {7, 300};
+  const int widths[] = {1, 5};
+  for (int o = 0; o < 2; o++)
+    for (int w = 0; w < 2; w++)
+      for (int k = 0; k < 3; k++)
+        for (int u = 0; u < 2; u++)
+          for (int trans = 0; trans <= 1; trans++) {
+            int n = orders[o];
+            matrix_t D, B, ref, C;
+            s21_packed_t P;
+            _alloc_matrix(&D, n, n);
+            ck_assert_int_eq(s21_create_matrix(n, widths[w], &B), S21_OK);
+            fill_structured(&D, kinds[k], uplos[u], 0.0);
+            _fill_rhs(&B, 0.3);
+            ck_assert_int_eq(s21_packed_from_dense(&D, kinds[k], uplos[u], &P),
+                             S21_OK);
+            ck_assert_int_eq(s21_mult_matrix_trans(&D, trans, &B, 0, &ref),
+                             S21_OK);
+            ck_assert_int_eq(s21_packed_mult_dense(&P, trans, &B, &C), S21_OK);
+            assert_close(&C, &ref, 1e-11);
+            _free_matrix(&C);
+            _free_matrix(&ref);
+            s21_packed_free(&P);
+            _free_matrix(&B);
+            _free_matrix(&D);
+          }
+
+  matrix_t B, C;
+  s21_packed_t P;
+  ck_assert_int_eq(
+      s21_packed_create(4, S21_PACKED_SYMMETRIC, S21_PACKED_LOWER, &P),
+      S21_OK);
+  _alloc_matrix(&B, 3, 2);
+  ck_assert_int_eq(s21_packed_mult_dense(&P, 0, &B, &C), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_packed_mult_dense(&P, 0, NULL, &C),
+                   S21_INCORRECT_MATRIX);
+  _free_matrix(&B);
+  s21_packed_free(&P);
+}
+END_TEST
+
+START_TEST(test_packed_trsm) {
+  /* 20 right-hand sides take the blocked path, 1 the plain substitution. */
+  const int widths[] = {1, 20};
+  const int n = 150;
+  for (int w = 0; w < 2; w++)
+    for (int k = 1; k < 3; k++)
+      for (int u = 0; u < 2; u++)
+        for (int trans = 0; trans <= 1; trans++) {
+          matrix_t D, B, X, AX;
+          s21_packed_t P;
+          _alloc_matrix(&D, n, n);
+          _alloc_matrix(&B, n, widths[w]);
+          fill_structured(&D, kinds[k], uplos[u], 4.0);
+          _fill_rhs(&B, 1.1);
+          ck_assert_int_eq(s21_packed_from_dense(&D, kinds[k], uplos[u], &P),
+                           S21_OK);
+          ck_assert_int_eq(s21_packed_trsm(&P, trans, &B, &X), S21_OK);
+          ck_assert_int_eq(s21_mult_matrix_trans(&D, trans, &X, 0, &AX),
+                           S21_OK);
+          assert_close(&AX, &B, 1e-9);
+          _free_matrix(&AX);
+          _free_matrix(&X);
+          s21_packed_free(&P);
+          _free_matrix(&B);
+          _free_matrix(&D);
+        }
+}
+END_TEST
+
+START_TEST(test_packed_trsm_errors) {
+  s21_packed_t P;
+  matrix_t B, X;
+  _alloc_matrix(&B, 3, 1);
+
+  ck_assert_int_eq(
+      s21_packed_create(3, S21_PACKED_SYMMETRIC, S21_PACKED_LOWER, &P),
+      S21_OK);
+  s21_packed_set(&P, 0, 0, 1.0);
+  s21_packed_set(&P, 1, 1, 1.0);
+  s21_packed_set(&P, 2, 2, 1.0);
+  ck_assert_int_eq(s21_packed_trsm(&P, 0, &B, &X), S21_CALC_ERROR);
+  s21_packed_free(&P);
+
+  ck_assert_int_eq(
+      s21_packed_create(3, S21_PACKED_TRIANGULAR, S21_PACKED_UPPER, &P),
+      S21_OK);
+  s21_packed_set(&P, 0, 0, 1.0);
+  s21_packed_set(&P, 2, 2, 1.0);
+  ck_assert_int_eq(s21_packed_trsm(&P, 0, &B, &X), S21_CALC_ERROR);
+  s21_packed_free(&P);
+
+  /* A unit diagonal is never singular, whatever is stored. */
+  ck_assert_int_eq(
+      s21_packed_create(3, S21_PACKED_UNIT_TRIANGULAR, S21_PACKED_UPPER, &P),
+      S21_OK);
+  ck_assert_int_eq(s21_packed_trsm(&P, 1, &B, &X), S21_OK);
+  _free_matrix(&X);
+  ck_assert_int_eq(s21_packed_trsm(&P, 2, &B, &X), S21_CALC_ERROR);
+  s21_packed_free(&P);
+
+  ck_assert_int_eq(
+      s21_packed_create(4, S21_PACKED_TRIANGULAR, S21_PACKED_LOWER, &P),
+      S21_OK);
+  ck_assert_int_eq(s21_packed_trsm(&P, 0, &B, &X), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_packed_trsm(&P, 0, &B, NULL), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_packed_trsm(NULL, 0, &B, &X), S21_INCORRECT_MATRIX);
+  s21_packed_free(&P);
+  _free_matrix(&B);
+}
+END_TEST
+
+START_TEST(test_packed_factors) {
+  const int n = 120;
+  matrix_t A, S, B, X, Y, ref;
+  _alloc_matrix(&A, n, n);
+  _alloc_matrix(&B, n, 12);
+  fill_structured(&A, S21_PACKED_TRIANGULAR, S21_PACKED_LOWER, 0.0);
+  for (int i = 0; i < n; i++)
+    for (int j = i + 1; j < n; j++) A.matrix[i][j] = cos(0.5 * i + 0.8 * j);
+  _fill_rhs(&B, 0.4);
+
+  /* L * U * X = P * B: permute B as the factorization did, then two TRSMs. */
+  s21_lu_t lu;
+  s21_packed_t L, U;
+  ck_assert_int_eq(s21_lu_factor(&A, &lu), S21_OK);
+  ck_assert_int_eq(s21_packed_from_lu(&lu, &L, &U), S21_OK);
+  ck_assert_int_eq(L.kind, S21_PACKED_UNIT_TRIANGULAR);
+  ck_assert_int_eq(U.uplo, S21_PACKED_UPPER);
+  for (int k = 0; k < n; k++) {
+    double *tmp = B.matrix[k];
+    B.matrix[k] = B.matrix[lu.pivots[k]];
+    B.matrix[lu.pivots[k]] = tmp;
+  }
+  ck_assert_int_eq(s21_packed_trsm(&L, 0, &B, &Y), S21_OK);
+  ck_assert_int_eq(s21_packed_trsm(&U, 0, &Y, &X), S21_OK);
+  for (int k = n - 1; k >= 0; k--) {
+    double *tmp = B.matrix[k];
+    B.matrix[k] = B.matrix[lu.pivots[k]];
+    B.matrix[lu.pivots[k]] = tmp;
+  }
+  ck_assert_int_eq(s21_lu_solve(&lu, &B, &ref), S21_OK);
+  assert_close(&X, &ref, 1e-9);
+  _free_matrix(&ref);
+  _free_matrix(&X);
+  _free_matrix(&Y);
+  s21_packed_free(&U);
+  s21_packed_free(&L);
+  s21_lu_free(&lu);
+
+  /* L * L^T * X = B for S = A * A^T + n * I. */
+  s21_cholesky_t chol;
+  ck_assert_int_eq(s21_mult_matrix_trans(&A, 0, &A, 1, &S), S21_OK);
+  for (int i = 0; i < n; i++) S.matrix[i][i] += n;
+  ck_assert_int_eq(s21_cholesky_factor(&S, &chol), S21_OK);
+  ck_assert_int_eq(s21_packed_from_cholesky(&chol, &L), S21_OK);
+  ck_assert_int_eq(s21_packed_trsm(&L, 0, &B, &Y), S21_OK);
+  ck_assert_int_eq(s21_packed_trsm(&L, 1, &Y, &X), S21_OK);
+  ck_assert_int_eq(s21_cholesky_solve(&chol, &B, &ref), S21_OK);
+  assert_close(&X, &ref, 1e-10);
+  _free_matrix(&ref);
+  _free_matrix(&X);
+  _free_matrix(&Y);
+  s21_packed_free(&L);
+  s21_cholesky_free(&chol);
+
+  ck_assert_int_eq(s21_packed_from_cholesky(NULL, &L), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_packed_from_lu(NULL, &L, &U), S21_INCORRECT_MATRIX);
+  _free_matrix(&S);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_blocked_factor_solves) {
+  /* Many right-hand sides route the dense LU and Cholesky substitutions
+     through the blocked TRSM; compare with one column at a time. */
+  const int n = 200;
+  matrix_t A, B, X, x, b;
+  _alloc_matrix(&A, n, n);
+  _alloc_matrix(&B, n, 30);
+  fill_structured(&A, S21_PACKED_SYMMETRIC, S21_PACKED_LOWER, 0.0);
+  for (int i = 0; i < n; i++) A.matrix[i][i] += n / 4;
+  _fill_rhs(&B, 0.9);
+  ck_assert_int_eq(s21_create_matrix(n, 1, &b), S21_OK);
+
+  s21_lu_t lu;
+  s21_cholesky_t chol;
+  A.matrix[0][1] += 0.5;
+  ck_assert_int_eq(s21_lu_factor(&A, &lu), S21_OK);
+  A.matrix[0][1] -= 0.5;
+  ck_assert_int_eq(s21_cholesky_factor(&A, &chol), S21_OK);
+
+  for (int pass = 0; pass < 2; pass++) {
+    if (pass == 0) {
+      ck_assert_int_eq(s21_lu_solve(&lu, &B, &X), S21_OK);
+    } else {
+      ck_assert_int_eq(s21_cholesky_solve(&chol, &B, &X), S21_OK);
+    }
+    for (int j = 0; j < B.columns; j += 7) {
+      for (int i = 0; i < n; i++) b.matrix[i][0] = B.matrix[i][j];
+      if (pass == 0) {
+        ck_assert_int_eq(s21_lu_solve(&lu, &b, &x), S21_OK);
+      } else {
+        ck_assert_int_eq(s21_cholesky_solve(&chol, &b, &x), S21_OK);
+      }
+      for (int i = 0; i < n; i++)
+        ck_assert_double_eq_tol(X.matrix[i][j], x.matrix[i][0], 1e-10);
+      _free_matrix(&x);
+    }
+    _free_matrix(&X);
+  }
+
+  s21_cholesky_free(&chol);
+  s21_lu_free(&lu);
+  _free_matrix(&b);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+Suite *s21_packed_suite(void) {
+  Suite *s = suite_create("packed");
+  TCase *tc = tcase_create("core");
+
+  tcase_add_test(tc, test_packed_storage);
+  tcase_add_test(tc, test_packed_dense_round_trip);
+  tcase_add_test(tc, test_packed_mult_dense);
+  tcase_add_test(tc, test_packed_trsm);
+  tcase_add_test(tc, test_packed_trsm_errors);
+  tcase_add_test(tc, test_packed_factors);
+  tcase_add_test(tc, test_blocked_factor_solves);
+
+  suite_add_tcase(s, tc);
+  return s;
+}
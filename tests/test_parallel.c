@@ -0,0 +1,127 @@
+#include <check.h>
+
+#include "../include/s21_matrix.h"
+#include "../include/s21_suites.h"
+#include "../include/test_helpers.h"
+
+START_TEST(test_parallel_num_threads_config) {
+  ck_assert_int_eq(s21_set_num_threads(-1), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_set_num_threads(3), S21_OK);
+  ck_assert_int_eq(s21_get_num_threads(), 3);
+  ck_assert_int_eq(s21_set_num_threads(0), S21_OK);
+  ck_assert_int_ge(s21_get_num_threads(), 1);
+}
+END_TEST
+
+START_TEST(test_parallel_threshold_config) {
+  ck_assert_int_eq(s21_set_parallel_threshold(-5), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_set_parallel_threshold(0), S21_OK);
+  ck_assert_int_eq(s21_set_parallel_threshold(128LL * 128LL * 128LL), S21_OK);
+}
+END_TEST
+
+START_TEST(test_parallel_mult_matches_serial) {
+  const int m = 211, k = 150, n = 533;
+  matrix_t A, B, serial, parallel;
+  _alloc_matrix(&A, m, k);
+  _alloc_matrix(&B, k, n);
+  _fill_matrix(&A, 0.0);
+  _fill_matrix(&B, 1.0);
+
+  ck_assert_int_eq(s21_set_num_threads(1), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix(&A, &B, &serial), S21_OK);
+
+  ck_assert_int_eq(s21_set_num_threads(4), S21_OK);
+  ck_assert_int_eq(s21_set_parallel_threshold(0), S21_OK);
+  for (int round = 0; round < 3; ++round) {
+    ck_assert_int_eq(s21_mult_matrix(&A, &B, &parallel), S21_OK);
+    for (int i = 0; i < m; ++i)
+      for (int j = 0; j < n; ++j)
+        ck_assert_double_eq_tol(parallel.matrix[i][j], serial.matrix[i][j],
+                                1e-12);
+    _free_matrix(&parallel);
+  }
+
+  s21_set_parallel_threshold(128LL * 128LL * 128LL);
+  s21_set_num_threads(0);
+  _free_matrix(&serial);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_parallel_resize_between_calls) {
+  const int n = 160;
+  matrix_t A, I, C;
+  _alloc_matrix(&A, n, n);
+  _alloc_matrix(&I, n, n);
+  _fill_matrix(&A, 2.0);
+  for (int i = 0; i < n; ++i) I.matrix[i][i] = 1.0;
+
+  s21_set_parallel_threshold(0);
+  for (int threads = 1; threads <= 5; ++threads) {
+    ck_assert_int_eq(s21_set_num_threads(threads), S21_OK);
+    ck_assert_int_eq(s21_mult_matrix(&A, &I, &C), S21_OK);
+    ck_assert_int_eq(s21_eq_matrix(&A, &C), SUCCESS);
+    _free_matrix(&C);
+  }
+
+  s21_set_parallel_threshold(128LL * 128LL * 128LL);
+  s21_set_num_threads(0);
+  _free_matrix(&I);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_parallel_gemv_matches_serial) {
+  const int m = 1031, k = 517;
+  matrix_t A, x, w, serial, serial_w, parallel;
+  _alloc_matrix(&A, m, k);
+  _alloc_matrix(&x, k, 1);
+  _alloc_matrix(&w, 1, m);
+  _fill_matrix(&A, 0.5);
+  _fill_matrix(&x, 1.5);
+  _fill_matrix(&w, 2.5);
+
+  ck_assert_int_eq(s21_set_num_threads(1), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix(&A, &x, &serial), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix(&w, &A, &serial_w), S21_OK);
+
+  ck_assert_int_eq(s21_set_num_threads(4), S21_OK);
+  ck_assert_int_eq(s21_set_parallel_threshold(0), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix(&A, &x, &parallel), S21_OK);
+  for (int i = 0; i < m; ++i)
+    ck_assert_double_eq_tol(parallel.matrix[i][0], serial.matrix[i][0],
+                            1e-12);
+  _free_matrix(&parallel);
+
+  /* w A splits the columns of the result across tasks. */
+  ck_assert_int_eq(s21_mult_matrix(&w, &A, &parallel), S21_OK);
+  for (int j = 0; j < k; ++j)
+    ck_assert_double_eq_tol(parallel.matrix[0][j], serial_w.matrix[0][j],
+                            1e-12);
+
+  s21_set_parallel_threshold(128LL * 128LL * 128LL);
+  s21_set_num_threads(0);
+  _free_matrix(&parallel);
+  _free_matrix(&serial_w);
+  _free_matrix(&serial);
+  _free_matrix(&w);
+  _free_matrix(&x);
+  _free_matrix(&A);
+}
+END_TEST
+
+Suite *s21_parallel_suite(void) {
+  Suite *s = suite_create("parallel");
+  TCase *tc = tcase_create("core");
+
+  tcase_add_test(tc, test_parallel_num_threads_config);
+  tcase_add_test(tc, test_parallel_threshold_config);
+  tcase_add_test(tc, test_parallel_mult_matches_serial);
+  tcase_add_test(tc, test_parallel_resize_between_calls);
+
+  tcase_add_test(tc, test_parallel_gemv_matches_serial);
+  suite_add_tcase(s, tc);
+  return s;
+}
@@ -74,6 +74,21 @@ START_TEST(test_remove_matrix_idempotent) {
 }
 END_TEST
 
+START_TEST(test_remove_matrix_created_block) {
+  matrix_t m;
+  int rc = s21_create_matrix(3, 5, &m);
+  ck_assert_int_eq(rc, 0);
+
+  m.matrix[2][4] = 1.5;
+
+  s21_remove_matrix(&m);
+
+  ck_assert_ptr_null(m.matrix);
+  ck_assert_int_eq(m.rows, 0);
+  ck_assert_int_eq(m.columns, 0);
+}
+END_TEST
+
 Suite *s21_remove_matrix_suite(void) {
   Suite *s = suite_create("remove_matrix");
   TCase *tc_core = tcase_create("core");
@@ -83,6 +98,7 @@ Suite *s21_remove_matrix_suite(void) {
   tcase_add_test(tc_core, test_remove_matrix_free_allocated);
   tcase_add_test(tc_core, test_remove_matrix_partial_allocation);
   tcase_add_test(tc_core, test_remove_matrix_idempotent);
+  tcase_add_test(tc_core, test_remove_matrix_created_block);
 
   suite_add_tcase(s, tc_core);
   return s;
@@ -0,0 +1,203 @@
+#include <check.h>
+
+#include "../include/s21_matrix.h"
+#include "../include/s21_suites.h"
+#include "../include/test_helpers.h"
+
+static void fill_system(matrix_t *A) {
+  for (int i = 0; i < A->rows; ++i)
+    for (int j = 0; j < A->columns; ++j)
+      A->matrix[i][j] = sin(i * 13 + j * 7 + 1) + (i == j ? A->rows : 0.0);
+}
+
+/* Checks A * X == B. */
+static void assert_solution(matrix_t *A, matrix_t *X, matrix_t *B) {
+  matrix_t AX;
+  ck_assert_int_eq(s21_mult_matrix(A, X, &AX), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&AX, B), SUCCESS);
+  s21_remove_matrix(&AX);
+}
+
+START_TEST(test_solve_invalid) {
+  matrix_t A, B, R, X;
+  s21_lu_t lu;
+  _alloc_matrix(&A, 3, 4);
+  _alloc_matrix(&B, 3, 1);
+  _alloc_matrix(&R, 4, 1);
+
+  ck_assert_int_eq(s21_lu_factor(NULL, &lu), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_lu_factor(&A, NULL), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_lu_factor(&A, &lu), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_solve(&A, &B, &X), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_solve(&A, NULL, &X), S21_INCORRECT_MATRIX);
+
+  s21_lu_t empty = {0, 1, NULL, NULL};
+  double det;
+  ck_assert_int_eq(s21_lu_solve(&empty, &B, &X), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_lu_determinant(&empty, &det), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_lu_inverse(NULL, &X), S21_INCORRECT_MATRIX);
+
+  _free_matrix(&A);
+  _alloc_matrix(&A, 3, 3);
+  fill_system(&A);
+  ck_assert_int_eq(s21_lu_factor(&A, &lu), S21_OK);
+  ck_assert_int_eq(s21_lu_solve(&lu, &R, &X), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_lu_solve_into(&lu, &B, &R), S21_CALC_ERROR);
+  s21_lu_free(&lu);
+  ck_assert_ptr_null(lu.lu);
+  s21_lu_free(&lu);
+
+  _free_matrix(&R);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_solve_one_shot) {
+  int sizes[] = {1, 2, 3, 5, 17, 64};
+  for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s) {
+    int n = sizes[s];
+    for (int k = 1; k <= 3; k += 2) {
+      matrix_t A, B, X;
+      _alloc_matrix(&A, n, n);
+      _alloc_matrix(&B, n, k);
+      fill_system(&A);
+      _fill_rhs(&B, n);
+
+      ck_assert_int_eq(s21_solve(&A, &B, &X), S21_OK);
+      ck_assert_int_eq(X.rows, n);
+      ck_assert_int_eq(X.columns, k);
+      assert_solution(&A, &X, &B);
+
+      s21_remove_matrix(&X);
+      _free_matrix(&B);
+      _free_matrix(&A);
+    }
+  }
+}
+END_TEST
+
+START_TEST(test_solve_matches_inverse) {
+  matrix_t A, B, X, inv, expected;
+  _alloc_matrix(&A, 6, 6);
+  ck_assert_int_eq(s21_create_matrix(6, 1, &B), S21_OK);
+  fill_system(&A);
+  _fill_rhs(&B, 2);
+
+  ck_assert_int_eq(s21_solve(&A, &B, &X), S21_OK);
+  ck_assert_int_eq(s21_inverse_matrix(&A, &inv), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix(&inv, &B, &expected), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&X, &expected), SUCCESS);
+
+  s21_remove_matrix(&expected);
+  s21_remove_matrix(&inv);
+  s21_remove_matrix(&X);
+  s21_remove_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_solve_singular) {
+  matrix_t A, B, X;
+  s21_lu_t lu;
+  _alloc_matrix(&A, 3, 3);
+  _alloc_matrix(&B, 3, 1);
+  _fill_rhs(&B, 0);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j) A.matrix[i][j] = i * 3 + j + 1;
+
+  ck_assert_int_eq(s21_solve(&A, &B, &X), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_lu_factor(&A, &lu), S21_OK);
+  double det = 1.0;
+  ck_assert_int_eq(s21_lu_determinant(&lu, &det), S21_OK);
+  ck_assert_double_eq_tol(det, 0.0, 1e-9);
+  ck_assert_int_eq(s21_lu_solve(&lu, &B, &X), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_lu_inverse(&lu, &X), S21_CALC_ERROR);
+
+  s21_lu_free(&lu);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_lu_reuse) {
+  const int n = 20;
+  matrix_t A, B, X, inv, expected;
+  s21_lu_t lu;
+  _alloc_matrix(&A, n, n);
+  fill_system(&A);
+  ck_assert_int_eq(s21_lu_factor(&A, &lu), S21_OK);
+  ck_assert_int_eq(lu.n, n);
+
+  double det = 0.0, expected_det = 0.0;
+  ck_assert_int_eq(s21_lu_determinant(&lu, &det), S21_OK);
+  ck_assert_int_eq(s21_determinant(&A, &expected_det), S21_OK);
+  ck_assert_double_eq_tol(det, expected_det, 1e-9 * fabs(expected_det));
+
+  ck_assert_int_eq(s21_lu_inverse(&lu, &inv), S21_OK);
+  ck_assert_int_eq(s21_inverse_matrix(&A, &expected), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&inv, &expected), SUCCESS);
+  s21_remove_matrix(&expected);
+  s21_remove_matrix(&inv);
+
+  ck_assert_int_eq(s21_create_matrix(n, 1, &B), S21_OK);
+  ck_assert_int_eq(s21_create_matrix(n, 1, &X), S21_OK);
+  for (int seed = 0; seed < 10; ++seed) {
+    _fill_rhs(&B, seed);
+    ck_assert_int_eq(s21_lu_solve_into(&lu, &B, &X), S21_OK);
+    assert_solution(&A, &X, &B);
+  }
+
+  ck_assert_int_eq(s21_lu_solve_into(&lu, &X, &X), S21_OK);
+  ck_assert_int_eq(s21_lu_solve(&lu, &B, &expected), S21_OK);
+  ck_assert_int_eq(s21_lu_solve(&lu, &expected, &inv), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&X, &inv), SUCCESS);
+
+  s21_remove_matrix(&inv);
+  s21_remove_matrix(&expected);
+  s21_remove_matrix(&X);
+  s21_remove_matrix(&B);
+  s21_lu_free(&lu);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_lu_log_determinant) {
+  const int n = 12;
+  matrix_t A;
+  s21_lu_t lu;
+  _alloc_matrix(&A, n, n);
+  fill_system(&A);
+  A.matrix[0][0] = -A.matrix[0][0];
+  ck_assert_int_eq(s21_lu_factor(&A, &lu), S21_OK);
+
+  int sign = 0;
+  double det = 0.0, log_det = 0.0;
+  ck_assert_int_eq(s21_lu_log_determinant(NULL, &sign, &log_det),
+                   S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_lu_log_determinant(&lu, NULL, &log_det),
+                   S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_lu_determinant(&lu, &det), S21_OK);
+  ck_assert_int_eq(s21_lu_log_determinant(&lu, &sign, &log_det), S21_OK);
+  ck_assert_int_eq(sign, det > 0.0 ? 1 : -1);
+  ck_assert_double_eq_tol(log_det, log(fabs(det)), 1e-10);
+
+  s21_lu_free(&lu);
+  _free_matrix(&A);
+}
+END_TEST
+
+Suite *s21_solve_suite(void) {
+  Suite *s = suite_create("solve");
+  TCase *tc = tcase_create("core");
+
+  tcase_add_test(tc, test_solve_invalid);
+  tcase_add_test(tc, test_solve_one_shot);
+  tcase_add_test(tc, test_solve_matches_inverse);
+  tcase_add_test(tc, test_solve_singular);
+  tcase_add_test(tc, test_lu_reuse);
+
+  tcase_add_test(tc, test_lu_log_determinant);
+  suite_add_tcase(s, tc);
+  return s;
+}
@@ -0,0 +1,366 @@
+#include <check.h>
+
+#include "../include/s21_matrix.h"
+#include "../include/s21_suites.h"
+#include "../include/test_helpers.h"
+
+/* Dense matrix with roughly `percent` percent non-zero elements. */
+static void fill_sparse(matrix_t *M, int percent, unsigned seed) {
+  for (int i = 0; i < M->rows; ++i)
+    for (int j = 0; j < M->columns; ++j) {
+      seed = seed * 1103515245u + 12345u;
+      int keep = (int)((seed >> 16) % 100) < percent;
+      M->matrix[i][j] = keep ? (double)((seed >> 8) % 199) / 17.0 - 5.0 : 0.0;
+    }
+}
+
+static void assert_sparse_eq_dense(const s21_sparse_t *S, const matrix_t *D,
+                                   double tol) {
+  matrix_t R;
+  ck_assert_int_eq(s21_sparse_to_dense(S, &R), S21_OK);
+  ck_assert_int_eq(R.rows, D->rows);
+  ck_assert_int_eq(R.columns, D->columns);
+  for (int i = 0; i < D->rows; ++i)
+    for (int j = 0; j < D->columns; ++j)
+      ck_assert_double_eq_tol(R.matrix[i][j], D->matrix[i][j], tol);
+  _free_matrix(&R);
+}
+
+/* Indices strictly ascending within every compressed slot. */
+static void assert_sorted(const s21_sparse_t *S) {
+  int major = S->format == S21_SPARSE_CSR ? S->rows : S->columns;
+  ck_assert_int_eq(S->offsets[0], 0);
+  ck_assert_int_eq(S->offsets[major], S->nnz);
+  for (int i = 0; i < major; ++i)
+    for (int p = S->offsets[i] + 1; p < S->offsets[i + 1]; ++p)
+      ck_assert_int_lt(S->indices[p - 1], S->indices[p]);
+}
+
+START_TEST(test_sparse_dense_round_trip) {
+  matrix_t D;
+  _alloc_matrix(&D, 13, 29);
+  fill_sparse(&D, 20, 7u);
+  int nonzero = 0;
+  for (int i = 0; i < D.rows; ++i)
+    for (int j = 0; j < D.columns; ++j) nonzero += D.matrix[i][j] != 0.0;
+
+  for (int format = S21_SPARSE_CSR; format <= S21_SPARSE_CSC; ++format) {
+    s21_sparse_t S;
+    ck_assert_int_eq(s21_sparse_from_dense(&D, format, &S), S21_OK);
+    ck_assert_int_eq(S.format, format);
+    ck_assert_int_eq(S.nnz, nonzero);
+    assert_sorted(&S);
+    assert_sparse_eq_dense(&S, &D, 1e-15);
+
+    double value = -1.0;
+    for (int i = 0; i < D.rows; ++i)
+      for (int j = 0; j < D.columns; ++j) {
+        ck_assert_int_eq(s21_sparse_get(&S, i, j, &value), S21_OK);
+        ck_assert_double_eq(value, D.matrix[i][j]);
+      }
+    ck_assert_int_eq(s21_sparse_get(&S, 13, 0, &value), S21_CALC_ERROR);
+    ck_assert_int_eq(s21_sparse_get(&S, 0, -1, &value), S21_CALC_ERROR);
+    s21_sparse_free(&S);
+    ck_assert_ptr_null(S.values);
+  }
+  _free_matrix(&D);
+}
+END_TEST
+
+START_TEST(test_sparse_triplets_duplicates) {
+  const int rows[] = {2, 0, 2, 1, 0, 2, 3, 0};
+  const int cols[] = {1, 4, 1, 0, 0, 3, 4, 4};
+  const double vals[] = {1.5, 2.0, 0.5, -3.0, 4.0, 7.0, 1.0, -1.0};
+  matrix_t D;
+  _alloc_matrix(&D, 4, 5);
+  for (int t = 0; t < 8; ++t) D.matrix[rows[t]][cols[t]] += vals[t];
+
+  for (int format = S21_SPARSE_CSR; format <= S21_SPARSE_CSC; ++format) {
+    s21_sparse_t S;
+    ck_assert_int_eq(
+        s21_sparse_from_triplets(4, 5, 8, rows, cols, vals, format, &S),
+        S21_OK);
+    ck_assert_int_eq(S.nnz, 6);
+    assert_sorted(&S);
+    assert_sparse_eq_dense(&S, &D, 1e-15);
+    s21_sparse_free(&S);
+  }
+
+  s21_sparse_t E;
+  ck_assert_int_eq(
+      s21_sparse_from_triplets(3, 3, 0, NULL, NULL, NULL, S21_SPARSE_CSR, &E),
+      S21_OK);
+  ck_assert_int_eq(E.nnz, 0);
+  double value = 1.0;
+  ck_assert_int_eq(s21_sparse_get(&E, 2, 2, &value), S21_OK);
+  ck_assert_double_eq(value, 0.0);
+  s21_sparse_free(&E);
+  _free_matrix(&D);
+}
+END_TEST
+
+START_TEST(test_sparse_triplets_invalid) {
+  const int rows[] = {0, 3};
+  const int cols[] = {0, 1};
+  const double vals[] = {1.0, 2.0};
+  s21_sparse_t S;
+  ck_assert_int_eq(
+      s21_sparse_from_triplets(3, 3, 2, rows, cols, vals, S21_SPARSE_CSR, &S),
+      S21_CALC_ERROR);
+  ck_assert_int_eq(
+      s21_sparse_from_triplets(0, 3, 2, rows, cols, vals, S21_SPARSE_CSR, &S),
+      S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(
+      s21_sparse_from_triplets(4, 3, 2, NULL, cols, vals, S21_SPARSE_CSR, &S),
+      S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_sparse_from_triplets(4, 3, 2, rows, cols, vals, 5, &S),
+                   S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(
+      s21_sparse_from_triplets(4, 3, 2, rows, cols, vals, S21_SPARSE_CSC, NULL),
+      S21_INCORRECT_MATRIX);
+}
+END_TEST
+
+START_TEST(test_sparse_convert_transpose) {
+  matrix_t D, T;
+  _alloc_matrix(&D, 17, 11);
+  _alloc_matrix(&T, 11, 17);
+  fill_sparse(&D, 30, 3u);
+  for (int i = 0; i < 17; ++i)
+    for (int j = 0; j < 11; ++j) T.matrix[j][i] = D.matrix[i][j];
+
+  for (int format = S21_SPARSE_CSR; format <= S21_SPARSE_CSC; ++format) {
+    s21_sparse_t S, C, X;
+    ck_assert_int_eq(s21_sparse_from_dense(&D, format, &S), S21_OK);
+    for (int target = S21_SPARSE_CSR; target <= S21_SPARSE_CSC; ++target) {
+      ck_assert_int_eq(s21_sparse_convert(&S, target, &C), S21_OK);
+      ck_assert_int_eq(C.format, target);
+      assert_sorted(&C);
+      assert_sparse_eq_dense(&C, &D, 1e-15);
+      s21_sparse_free(&C);
+    }
+    ck_assert_int_eq(s21_sparse_transpose(&S, &X), S21_OK);
+    ck_assert_int_eq(X.format, format);
+    ck_assert_int_eq(X.rows, 11);
+    assert_sorted(&X);
+    assert_sparse_eq_dense(&X, &T, 1e-15);
+    s21_sparse_free(&X);
+    s21_sparse_free(&S);
+  }
+  _free_matrix(&T);
+  _free_matrix(&D);
+}
+END_TEST
+
+START_TEST(test_sparse_sum_sub_number) {
+  matrix_t A, B, S, D, N;
+  _alloc_matrix(&A, 9, 14);
+  _alloc_matrix(&B, 9, 14);
+  fill_sparse(&A, 25, 11u);
+  fill_sparse(&B, 25, 12u);
+  ck_assert_int_eq(s21_sum_matrix(&A, &B, &S), S21_OK);
+  ck_assert_int_eq(s21_sub_matrix(&A, &B, &D), S21_OK);
+  ck_assert_int_eq(s21_mult_number(&A, -2.5, &N), S21_OK);
+
+  for (int fa = S21_SPARSE_CSR; fa <= S21_SPARSE_CSC; ++fa)
+    for (int fb = S21_SPARSE_CSR; fb <= S21_SPARSE_CSC; ++fb) {
+      s21_sparse_t a, b, r;
+      ck_assert_int_eq(s21_sparse_from_dense(&A, fa, &a), S21_OK);
+      ck_assert_int_eq(s21_sparse_from_dense(&B, fb, &b), S21_OK);
+      ck_assert_int_eq(s21_sparse_sum(&a, &b, &r), S21_OK);
+      ck_assert_int_eq(r.format, fa);
+      assert_sorted(&r);
+      assert_sparse_eq_dense(&r, &S, 1e-12);
+      s21_sparse_free(&r);
+      ck_assert_int_eq(s21_sparse_sub(&a, &b, &r), S21_OK);
+      assert_sorted(&r);
+      assert_sparse_eq_dense(&r, &D, 1e-12);
+      s21_sparse_free(&r);
+      ck_assert_int_eq(s21_sparse_mult_number(&a, -2.5, &r), S21_OK);
+      ck_assert_int_eq(r.nnz, a.nnz);
+      assert_sparse_eq_dense(&r, &N, 1e-12);
+      s21_sparse_free(&r);
+      s21_sparse_free(&b);
+      s21_sparse_free(&a);
+    }
+
+  s21_sparse_t a, c;
+  matrix_t C;
+  _alloc_matrix(&C, 14, 9);
+  ck_assert_int_eq(s21_sparse_from_dense(&A, S21_SPARSE_CSR, &a), S21_OK);
+  ck_assert_int_eq(s21_sparse_from_dense(&C, S21_SPARSE_CSR, &c), S21_OK);
+  s21_sparse_t r;
+  ck_assert_int_eq(s21_sparse_sum(&a, &c, &r), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_sparse_sub(&a, NULL, &r), S21_INCORRECT_MATRIX);
+  s21_sparse_free(&c);
+  s21_sparse_free(&a);
+  _free_matrix(&C);
+  _free_matrix(&N);
+  _free_matrix(&D);
+  _free_matrix(&S);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_sparse_mult_dense) {
+  const int widths[] = {1, 3, 8};
+  matrix_t A;
+  _alloc_matrix(&A, 37, 23);
+  fill_sparse(&A, 15, 5u);
+
+  for (int w = 0; w < 3; ++w) {
+    matrix_t B, ref, C;
+    _alloc_matrix(&B, 23, widths[w]);
+    fill_sparse(&B, 100, 9u + w);
+    ck_assert_int_eq(s21_mult_matrix(&A, &B, &ref), S21_OK);
+    for (int format = S21_SPARSE_CSR; format <= S21_SPARSE_CSC; ++format) {
+      s21_sparse_t S;
+      ck_assert_int_eq(s21_sparse_from_dense(&A, format, &S), S21_OK);
+      ck_assert_int_eq(s21_sparse_mult_dense(&S, &B, &C), S21_OK);
+      ck_assert_int_eq(C.rows, 37);
+      ck_assert_int_eq(C.columns, widths[w]);
+      for (int i = 0; i < 37; ++i)
+        for (int j = 0; j < widths[w]; ++j)
+          ck_assert_double_eq_tol(C.matrix[i][j], ref.matrix[i][j], 1e-10);
+      _free_matrix(&C);
+      s21_sparse_free(&S);
+    }
+    _free_matrix(&ref);
+    _free_matrix(&B);
+  }
+
+  /* Contiguous single columns take the vector path. */
+  matrix_t x, ref, y;
+  ck_assert_int_eq(s21_create_matrix(23, 1, &x), S21_OK);
+  fill_sparse(&x, 100, 17u);
+  ck_assert_int_eq(s21_mult_matrix(&A, &x, &ref), S21_OK);
+  for (int format = S21_SPARSE_CSR; format <= S21_SPARSE_CSC; ++format) {
+    s21_sparse_t S;
+    ck_assert_int_eq(s21_sparse_from_dense(&A, format, &S), S21_OK);
+    ck_assert_int_eq(s21_sparse_mult_dense(&S, &x, &y), S21_OK);
+    for (int i = 0; i < 37; ++i)
+      ck_assert_double_eq_tol(y.matrix[i][0], ref.matrix[i][0], 1e-10);
+    _free_matrix(&y);
+    s21_sparse_free(&S);
+  }
+  _free_matrix(&ref);
+  _free_matrix(&x);
+
+  s21_sparse_t S;
+  matrix_t B, C;
+  _alloc_matrix(&B, 22, 2);
+  ck_assert_int_eq(s21_sparse_from_dense(&A, S21_SPARSE_CSR, &S), S21_OK);
+  ck_assert_int_eq(s21_sparse_mult_dense(&S, &B, &C), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_sparse_mult_dense(NULL, &B, &C), S21_INCORRECT_MATRIX);
+  s21_sparse_free(&S);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+static void check_spgemm(int m, int k, int n, int percent) {
+  matrix_t A, B, ref;
+  _alloc_matrix(&A, m, k);
+  _alloc_matrix(&B, k, n);
+  fill_sparse(&A, percent, 21u);
+  fill_sparse(&B, percent, 22u);
+  ck_assert_int_eq(s21_mult_matrix(&A, &B, &ref), S21_OK);
+
+  for (int fa = S21_SPARSE_CSR; fa <= S21_SPARSE_CSC; ++fa)
+    for (int fb = S21_SPARSE_CSR; fb <= S21_SPARSE_CSC; ++fb) {
+      s21_sparse_t a, b, c;
+      ck_assert_int_eq(s21_sparse_from_dense(&A, fa, &a), S21_OK);
+      ck_assert_int_eq(s21_sparse_from_dense(&B, fb, &b), S21_OK);
+      ck_assert_int_eq(s21_sparse_mult(&a, &b, &c), S21_OK);
+      ck_assert_int_eq(c.format, fa);
+      ck_assert_int_eq(c.rows, m);
+      ck_assert_int_eq(c.columns, n);
+      assert_sorted(&c);
+      assert_sparse_eq_dense(&c, &ref, 1e-10);
+      s21_sparse_free(&c);
+      s21_sparse_free(&b);
+      s21_sparse_free(&a);
+    }
+
+  _free_matrix(&ref);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+
+START_TEST(test_sparse_mult_sparse) {
+  check_spgemm(19, 31, 24, 10);
+  check_spgemm(1, 40, 1, 50);
+  check_spgemm(12, 12, 12, 0);
+
+  matrix_t A;
+  s21_sparse_t a, c;
+  _alloc_matrix(&A, 3, 4);
+  ck_assert_int_eq(s21_sparse_from_dense(&A, S21_SPARSE_CSR, &a), S21_OK);
+  ck_assert_int_eq(s21_sparse_mult(&a, &a, &c), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_sparse_mult(&a, &a, NULL), S21_INCORRECT_MATRIX);
+  s21_sparse_free(&a);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_sparse_parallel_matches_serial) {
+  matrix_t A, B, ref, C;
+  _alloc_matrix(&A, 301, 257);
+  _alloc_matrix(&B, 257, 5);
+  fill_sparse(&A, 4, 31u);
+  fill_sparse(&B, 100, 32u);
+  ck_assert_int_eq(s21_mult_matrix(&A, &B, &ref), S21_OK);
+
+  ck_assert_int_eq(s21_set_num_threads(4), S21_OK);
+  ck_assert_int_eq(s21_set_parallel_threshold(0), S21_OK);
+  for (int format = S21_SPARSE_CSR; format <= S21_SPARSE_CSC; ++format) {
+    s21_sparse_t S, P;
+    ck_assert_int_eq(s21_sparse_from_dense(&A, format, &S), S21_OK);
+    ck_assert_int_eq(s21_sparse_mult_dense(&S, &B, &C), S21_OK);
+    for (int i = 0; i < 301; ++i)
+      for (int j = 0; j < 5; ++j)
+        ck_assert_double_eq_tol(C.matrix[i][j], ref.matrix[i][j], 1e-10);
+    _free_matrix(&C);
+
+    s21_sparse_t T;
+    matrix_t AT, AAT;
+    ck_assert_int_eq(s21_sparse_transpose(&S, &T), S21_OK);
+    ck_assert_int_eq(s21_sparse_mult(&S, &T, &P), S21_OK);
+    ck_assert_int_eq(s21_transpose(&A, &AT), S21_OK);
+    s21_set_num_threads(1);
+    ck_assert_int_eq(s21_mult_matrix(&A, &AT, &AAT), S21_OK);
+    s21_set_num_threads(4);
+    assert_sorted(&P);
+    assert_sparse_eq_dense(&P, &AAT, 1e-10);
+    _free_matrix(&AAT);
+    _free_matrix(&AT);
+    s21_sparse_free(&P);
+    s21_sparse_free(&T);
+    s21_sparse_free(&S);
+  }
+
+  s21_set_parallel_threshold(128LL * 128LL * 128LL);
+  s21_set_num_threads(0);
+  _free_matrix(&ref);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+Suite *s21_sparse_suite(void) {
+  Suite *s = suite_create("sparse");
+  TCase *tc = tcase_create("core");
+
+  tcase_add_test(tc, test_sparse_dense_round_trip);
+  tcase_add_test(tc, test_sparse_triplets_duplicates);
+  tcase_add_test(tc, test_sparse_triplets_invalid);
+  tcase_add_test(tc, test_sparse_convert_transpose);
+  tcase_add_test(tc, test_sparse_sum_sub_number);
+  tcase_add_test(tc, test_sparse_mult_dense);
+  tcase_add_test(tc, test_sparse_mult_sparse);
+  tcase_add_test(tc, test_sparse_parallel_matches_serial);
+
+  suite_add_tcase(s, tc);
+  return s;
+}
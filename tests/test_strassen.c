@@ -0,0 +1,115 @@
+#include <check.h>
+
+#include "../include/s21_matrix.h"
+#include "../include/s21_suites.h"
+#include "../include/test_helpers.h"
+
+START_TEST(test_strassen_recursive_odd) {
+  const int m = 1539, k = 1537, n = 1541;
+  matrix_t A, B, C, W;
+  ck_assert_int_eq(s21_create_matrix(m, k, &A), S21_OK);
+  ck_assert_int_eq(s21_create_matrix(k, n, &B), S21_OK);
+  _fill_matrix(&A, 0.3);
+  _fill_matrix(&B, 1.1);
+
+  ck_assert_int_eq(s21_mult_matrix(&A, &B, &C), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix_strassen(&A, &B, &W), S21_OK);
+  ck_assert_int_eq(W.rows, m);
+  ck_assert_int_eq(W.columns, n);
+  for (int i = 0; i < m; ++i)
+    for (int j = 0; j < n; ++j)
+      ck_assert_double_eq_tol(W.matrix[i][j], C.matrix[i][j], 1e-10);
+
+  _free_matrix(&W);
+  _free_matrix(&C);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_strassen_threshold_config) {
+  ck_assert_int_eq(s21_get_strassen_threshold(), 0);
+  ck_assert_int_eq(s21_set_strassen_threshold(-1), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_get_strassen_threshold(), 0);
+  ck_assert_int_eq(s21_set_strassen_threshold(2048), S21_OK);
+  ck_assert_int_eq(s21_get_strassen_threshold(), 2048);
+  ck_assert_int_eq(s21_set_strassen_threshold(0), S21_OK);
+}
+END_TEST
+
+START_TEST(test_strassen_cutover) {
+  ck_assert_int_eq(s21_get_strassen_cutover(), 768);
+  ck_assert_int_eq(s21_set_strassen_cutover(0), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_get_strassen_cutover(), 768);
+
+  /* A small cutover recurses three levels with odd edges on the way. */
+  matrix_t A, B, C, W;
+  _alloc_matrix(&A, 67, 83);
+  _alloc_matrix(&B, 83, 71);
+  _fill_matrix(&A, 0.4);
+  _fill_matrix(&B, 1.9);
+  ck_assert_int_eq(s21_set_strassen_cutover(8), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix_strassen(&A, &B, &W), S21_OK);
+  ck_assert_int_eq(s21_set_strassen_cutover(768), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix(&A, &B, &C), S21_OK);
+  for (int i = 0; i < 67; ++i)
+    for (int j = 0; j < 71; ++j)
+      ck_assert_double_eq_tol(W.matrix[i][j], C.matrix[i][j], 1e-11);
+
+  _free_matrix(&W);
+  _free_matrix(&C);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_strassen_auto_dispatch) {
+  matrix_t A, B, C, W;
+  ck_assert_int_eq(s21_create_matrix(7, 5, &A), S21_OK);
+  ck_assert_int_eq(s21_create_matrix(5, 9, &B), S21_OK);
+  _fill_matrix(&A, 0.7);
+  _fill_matrix(&B, 2.3);
+
+  ck_assert_int_eq(s21_mult_matrix(&A, &B, &C), S21_OK);
+  ck_assert_int_eq(s21_set_strassen_threshold(1), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix(&A, &B, &W), S21_OK);
+  ck_assert_int_eq(s21_set_strassen_threshold(0), S21_OK);
+  for (int i = 0; i < 7; ++i)
+    for (int j = 0; j < 9; ++j)
+      ck_assert_double_eq_tol(W.matrix[i][j], C.matrix[i][j], 1e-12);
+
+  _free_matrix(&W);
+  _free_matrix(&C);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_strassen_invalid) {
+  matrix_t A, B, C;
+  ck_assert_int_eq(s21_create_matrix(2, 3, &A), S21_OK);
+  ck_assert_int_eq(s21_create_matrix(2, 3, &B), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix_strassen(&A, &B, &C), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_mult_matrix_strassen(NULL, &B, &C),
+                   S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_mult_matrix_strassen(&A, &B, NULL),
+                   S21_INCORRECT_MATRIX);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+Suite *s21_strassen_suite(void) {
+  Suite *s = suite_create("strassen");
+  TCase *tc = tcase_create("core");
+
+  tcase_set_timeout(tc, 60);
+  tcase_add_test(tc, test_strassen_recursive_odd);
+  tcase_add_test(tc, test_strassen_threshold_config);
+  tcase_add_test(tc, test_strassen_cutover);
+  tcase_add_test(tc, test_strassen_auto_dispatch);
+  tcase_add_test(tc, test_strassen_invalid);
+
+  suite_add_tcase(s, tc);
+  return s;
+}
@@ -171,6 +171,32 @@ START_TEST(test_sub_with_nan_and_inf) {
 }
 END_TEST
 
+START_TEST(test_sub_into_aliases_second_operand) {
+  matrix_t A, B;
+  _alloc_matrix(&A, 2, 2);
+  _alloc_matrix(&B, 2, 2);
+  for (int i = 0; i < 2; ++i) {
+    for (int j = 0; j < 2; ++j) {
+      A.matrix[i][j] = 5.0;
+      B.matrix[i][j] = i - j;
+    }
+  }
+
+  ck_assert_int_eq(s21_sub_matrix_into(&A, &B, &B), S21_OK);
+  for (int i = 0; i < 2; ++i)
+    for (int j = 0; j < 2; ++j)
+      ck_assert_double_eq(B.matrix[i][j], 5.0 - (i - j));
+
+  matrix_t wrong;
+  _alloc_matrix(&wrong, 3, 2);
+  ck_assert_int_eq(s21_sub_matrix_into(&A, &B, &wrong), S21_CALC_ERROR);
+
+  _free_matrix(&wrong);
+  _free_matrix(&A);
+  _free_matrix(&B);
+}
+END_TEST
+
 Suite *s21_sub_matrix_suite(void) {
   Suite *s = suite_create("sub_matrix");
   TCase *tc = tcase_create("core");
@@ -187,6 +213,7 @@ Suite *s21_sub_matrix_suite(void) {
   tcase_add_test(tc, test_sub_with_negative_and_fraction);
   tcase_add_test(tc, test_sub_with_nan_and_inf);
 
+  tcase_add_test(tc, test_sub_into_aliases_second_operand);
   suite_add_tcase(s, tc);
   return s;
 }
@@ -171,6 +171,72 @@ START_TEST(test_sum_with_nan_and_inf) {
 }
 END_TEST
 
+START_TEST(test_sum_into_existing_result) {
+  matrix_t A, B, result;
+  _alloc_matrix(&A, 2, 3);
+  _alloc_matrix(&B, 2, 3);
+  _alloc_matrix(&result, 2, 3);
+  double **storage = result.matrix;
+  for (int i = 0; i < 2; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      A.matrix[i][j] = i + j;
+      B.matrix[i][j] = 10.0 * (i + 1);
+      result.matrix[i][j] = 99.0;
+    }
+  }
+
+  ck_assert_int_eq(s21_sum_matrix_into(&A, &B, &result), S21_OK);
+  ck_assert_ptr_eq(result.matrix, storage);
+  for (int i = 0; i < 2; ++i)
+    for (int j = 0; j < 3; ++j)
+      ck_assert_double_eq(result.matrix[i][j], i + j + 10.0 * (i + 1));
+
+  _free_matrix(&result);
+  _free_matrix(&A);
+  _free_matrix(&B);
+}
+END_TEST
+
+START_TEST(test_sum_into_in_place) {
+  matrix_t A, B;
+  ck_assert_int_eq(s21_create_matrix(3, 3, &A), S21_OK);
+  _alloc_matrix(&B, 3, 3);
+  for (int i = 0; i < 3; ++i) {
+    for (int j = 0; j < 3; ++j) {
+      A.matrix[i][j] = i * 3 + j;
+      B.matrix[i][j] = 0.5;
+    }
+  }
+
+  for (int step = 0; step < 4; ++step)
+    ck_assert_int_eq(s21_sum_matrix_into(&A, &B, &A), S21_OK);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 3; ++j)
+      ck_assert_double_eq(A.matrix[i][j], i * 3 + j + 2.0);
+
+  _free_matrix(&A);
+  _free_matrix(&B);
+}
+END_TEST
+
+START_TEST(test_sum_into_invalid) {
+  matrix_t A, B, result;
+  _alloc_matrix(&A, 2, 2);
+  _alloc_matrix(&B, 2, 2);
+  _alloc_matrix(&result, 2, 3);
+
+  ck_assert_int_eq(s21_sum_matrix_into(&A, &B, &result), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_sum_matrix_into(&A, &B, NULL), S21_INCORRECT_MATRIX);
+  matrix_t empty = {NULL, 2, 2};
+  ck_assert_int_eq(s21_sum_matrix_into(&A, &B, &empty),
+                   S21_INCORRECT_MATRIX);
+
+  _free_matrix(&result);
+  _free_matrix(&A);
+  _free_matrix(&B);
+}
+END_TEST
+
 Suite *s21_sum_matrix_suite(void) {
   Suite *s = suite_create("sum_matrix");
   TCase *tc = tcase_create("core");
@@ -187,6 +253,9 @@ Suite *s21_sum_matrix_suite(void) {
   tcase_add_test(tc, test_sum_with_negative_and_fraction);
   tcase_add_test(tc, test_sum_with_nan_and_inf);
 
+  tcase_add_test(tc, test_sum_into_existing_result);
+  tcase_add_test(tc, test_sum_into_in_place);
+  tcase_add_test(tc, test_sum_into_invalid);
   suite_add_tcase(s, tc);
   return s;
 }
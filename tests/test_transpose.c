@@ -172,6 +172,71 @@ START_TEST(test_transpose_with_nan_and_inf) {
 }
 END_TEST
 
+START_TEST(test_transpose_into_existing_result) {
+  matrix_t A, result;
+  _alloc_matrix(&A, 2, 3);
+  _alloc_matrix(&result, 3, 2);
+  for (int i = 0; i < 2; ++i)
+    for (int j = 0; j < 3; ++j) A.matrix[i][j] = i * 3 + j;
+
+  ck_assert_int_eq(s21_transpose_into(&A, &result), S21_OK);
+  for (int i = 0; i < 2; ++i)
+    for (int j = 0; j < 3; ++j)
+      ck_assert_double_eq(result.matrix[j][i], A.matrix[i][j]);
+
+  ck_assert_int_eq(s21_transpose_into(&A, &A), S21_CALC_ERROR);
+
+  _free_matrix(&result);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_transpose_into_in_place) {
+  int n = 45;
+  matrix_t A;
+  ck_assert_int_eq(s21_create_matrix(n, n, &A), S21_OK);
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j) A.matrix[i][j] = i * n + j;
+
+  ck_assert_int_eq(s21_transpose_into(&A, &A), S21_OK);
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j)
+      ck_assert_double_eq(A.matrix[i][j], j * n + i);
+
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_transpose_into_overlap) {
+  matrix_t A, B;
+  ck_assert_int_eq(s21_create_matrix(2, 3, &A), S21_OK);
+  for (int i = 0; i < 2; ++i)
+    for (int j = 0; j < 3; ++j) A.matrix[i][j] = i * 3 + j;
+
+  /* A 3 x 2 result laid over the same six doubles. */
+  double *rows[3] = {A.matrix[0], A.matrix[0] + 2, A.matrix[0] + 4};
+  matrix_t result = {rows, 3, 2};
+  ck_assert_int_eq(s21_transpose_into(&A, &result), S21_OK);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 2; ++j) ck_assert_double_eq(rows[i][j], j * 3 + i);
+
+  /* Square, but shifted by one row. */
+  ck_assert_int_eq(s21_create_matrix(3, 2, &B), S21_OK);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 2; ++j) B.matrix[i][j] = i * 2 + j;
+  matrix_t top = {B.matrix, 2, 2};
+  matrix_t bottom = {B.matrix + 1, 2, 2};
+  ck_assert_int_eq(s21_transpose_into(&top, &bottom), S21_OK);
+  const double expected[3][2] = {{0, 1}, {0, 2}, {1, 3}};
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 2; ++j)
+      ck_assert_double_eq(B.matrix[i][j], expected[i][j]);
+
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
 Suite *s21_transpose_suite(void) {
   Suite *s = suite_create("transpose");
   TCase *tc = tcase_create("core");
@@ -187,6 +252,9 @@ Suite *s21_transpose_suite(void) {
   tcase_add_test(tc, test_transpose_preserves_original);
   tcase_add_test(tc, test_transpose_with_nan_and_inf);
 
+  tcase_add_test(tc, test_transpose_into_existing_result);
+  tcase_add_test(tc, test_transpose_into_in_place);
+  tcase_add_test(tc, test_transpose_into_overlap);
   suite_add_tcase(s, tc);
   return s;
 }
@@ -0,0 +1,220 @@
+#include <check.h>
+
+#include "../include/s21_matrix.h"
+#include "../include/s21_suites.h"
+#include "../include/test_helpers.h"
+
+static void fill(matrix_t *M) {
+  for (int i = 0; i < M->rows; ++i)
+    for (int j = 0; j < M->columns; ++j) M->matrix[i][j] = i * 100 + j;
+}
+
+START_TEST(test_view_invalid) {
+  matrix_t A;
+  s21_view_t view;
+  _alloc_matrix(&A, 4, 5);
+
+  ck_assert_int_eq(s21_view_matrix(NULL, &view), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_view_matrix(&A, NULL), S21_INCORRECT_MATRIX);
+  ck_assert_int_eq(s21_view_block(&A, 2, 0, 3, 5, &view), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_view_block(&A, 0, -1, 1, 1, &view), S21_CALC_ERROR);
+  ck_assert_int_eq(s21_view_strided(&A, 0, 0, 3, 1, 2, 1, &view),
+                   S21_CALC_ERROR);
+  ck_assert_int_eq(s21_view_minor(&A, 4, 0, &view), S21_CALC_ERROR);
+  int bad[] = {0, 5};
+  ck_assert_int_eq(s21_view_indexed(&A, 4, NULL, 2, bad, &view),
+                   S21_CALC_ERROR);
+
+  ck_assert_int_eq(s21_view_block(&A, 1, 1, 2, 2, &view), S21_OK);
+  double value;
+  ck_assert_int_eq(s21_view_get(&view, 2, 0, &value), S21_CALC_ERROR);
+
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_view_block_and_strided) {
+  matrix_t A;
+  _alloc_matrix(&A, 6, 7);
+  fill(&A);
+
+  s21_view_t view;
+  double value;
+  ck_assert_int_eq(s21_view_block(&A, 2, 3, 3, 4, &view), S21_OK);
+  ck_assert_int_eq(view.rows, 3);
+  ck_assert_int_eq(view.columns, 4);
+  ck_assert_int_eq(s21_view_get(&view, 2, 3, &value), S21_OK);
+  ck_assert_double_eq(value, 406.0);
+
+  ck_assert_int_eq(s21_view_strided(&A, 5, 0, 3, 4, -2, 2, &view), S21_OK);
+  matrix_t copy;
+  ck_assert_int_eq(s21_view_copy(&view, &copy), S21_OK);
+  for (int i = 0; i < 3; ++i)
+    for (int j = 0; j < 4; ++j)
+      ck_assert_double_eq(copy.matrix[i][j], (5 - 2 * i) * 100 + 2 * j);
+
+  /* A view sees later writes to the viewed matrix. */
+  A.matrix[5][6] = -1.0;
+  ck_assert_int_eq(s21_view_get(&view, 0, 3, &value), S21_OK);
+  ck_assert_double_eq(value, -1.0);
+
+  _free_matrix(&copy);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_view_minor_determinant) {
+  matrix_t A;
+  _alloc_matrix(&A, 4, 4);
+  double data[4][4] = {
+      {2, -1, 0, 3}, {1, 4, -2, 0}, {0, 5, 1, -1}, {3, 0, 2, 1}};
+  for (int i = 0; i < 4; ++i)
+    for (int j = 0; j < 4; ++j) A.matrix[i][j] = data[i][j];
+
+  for (int r = 0; r < 4; ++r) {
+    for (int c = 0; c < 4; ++c) {
+      s21_view_t minor;
+      ck_assert_int_eq(s21_view_minor(&A, r, c, &minor), S21_OK);
+
+      matrix_t copy;
+      double expected, actual;
+      ck_assert_int_eq(s21_view_copy(&minor, &copy), S21_OK);
+      ck_assert_int_eq(s21_determinant(&copy, &expected), S21_OK);
+      ck_assert_int_eq(s21_view_determinant(&minor, &actual), S21_OK);
+      ck_assert_double_eq_tol(actual, expected, 1e-12);
+      _free_matrix(&copy);
+    }
+  }
+
+  s21_view_t whole;
+  double det, expected;
+  ck_assert_int_eq(s21_view_matrix(&A, &whole), S21_OK);
+  ck_assert_int_eq(s21_view_determinant(&whole, &det), S21_OK);
+  ck_assert_int_eq(s21_determinant(&A, &expected), S21_OK);
+  ck_assert_double_eq_tol(det, expected, 1e-12);
+
+  s21_view_t block;
+  ck_assert_int_eq(s21_view_block(&A, 0, 0, 2, 3, &block), S21_OK);
+  ck_assert_int_eq(s21_view_determinant(&block, &det), S21_CALC_ERROR);
+
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_view_transpose_and_eq) {
+  matrix_t A, T;
+  _alloc_matrix(&A, 3, 5);
+  fill(&A);
+  ck_assert_int_eq(s21_transpose(&A, &T), S21_OK);
+
+  s21_view_t a, t, at;
+  ck_assert_int_eq(s21_view_matrix(&A, &a), S21_OK);
+  ck_assert_int_eq(s21_view_matrix(&T, &t), S21_OK);
+  ck_assert_int_eq(s21_view_transpose(&a, &at), S21_OK);
+  ck_assert_int_eq(at.rows, 5);
+  ck_assert_int_eq(at.columns, 3);
+  ck_assert_int_eq(s21_view_eq(&at, &t), SUCCESS);
+  ck_assert_int_eq(s21_view_eq(&a, &t), FAILURE);
+  ck_assert_int_eq(s21_view_transpose(&at, &at), S21_OK);
+  ck_assert_int_eq(s21_view_eq(&at, &a), SUCCESS);
+
+  int rows[] = {2, 0};
+  int cols[] = {4, 4, 1};
+  s21_view_t picked;
+  ck_assert_int_eq(s21_view_indexed(&A, 2, rows, 3, cols, &picked), S21_OK);
+  double value;
+  ck_assert_int_eq(s21_view_get(&picked, 0, 1, &value), S21_OK);
+  ck_assert_double_eq(value, 204.0);
+  ck_assert_int_eq(s21_view_get(&picked, 1, 2, &value), S21_OK);
+  ck_assert_double_eq(value, 1.0);
+
+  _free_matrix(&T);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_view_mult_matrix) {
+  matrix_t A, B;
+  _alloc_matrix(&A, 40, 50);
+  _alloc_matrix(&B, 50, 40);
+  for (int i = 0; i < 40; ++i)
+    for (int j = 0; j < 50; ++j) {
+      A.matrix[i][j] = sin(i + 0.1 * j);
+      B.matrix[j][i] = cos(0.3 * i - j);
+    }
+
+  /* A block multiplied in place by a column-strided (gathered) B. */
+  s21_view_t a, b;
+  ck_assert_int_eq(s21_view_block(&A, 5, 10, 20, 30, &a), S21_OK);
+  ck_assert_int_eq(s21_view_strided(&B, 10, 0, 30, 20, 1, 2, &b), S21_OK);
+
+  matrix_t a_copy, b_copy, expected, result;
+  ck_assert_int_eq(s21_view_copy(&a, &a_copy), S21_OK);
+  ck_assert_int_eq(s21_view_copy(&b, &b_copy), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix(&a_copy, &b_copy, &expected), S21_OK);
+  ck_assert_int_eq(s21_view_mult_matrix(&a, &b, &result), S21_OK);
+  ck_assert_int_eq(s21_eq_matrix(&result, &expected), SUCCESS);
+
+  s21_view_t mismatched;
+  ck_assert_int_eq(s21_view_block(&B, 0, 0, 10, 10, &mismatched), S21_OK);
+  ck_assert_int_eq(s21_view_mult_matrix(&a, &mismatched, &result),
+                   S21_CALC_ERROR);
+
+  _free_matrix(&result);
+  _free_matrix(&expected);
+  _free_matrix(&b_copy);
+  _free_matrix(&a_copy);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+START_TEST(test_view_mult_transposed) {
+  matrix_t A, B;
+  _alloc_matrix(&A, 120, 90);
+  _alloc_matrix(&B, 80, 100);
+  for (int i = 0; i < 120; ++i)
+    for (int j = 0; j < 90; ++j) A.matrix[i][j] = sin(0.2 * i + j);
+  for (int i = 0; i < 80; ++i)
+    for (int j = 0; j < 100; ++j) B.matrix[i][j] = cos(i - 0.7 * j);
+
+  /* (A block)^T * (B block)^T: both read transposed while packing. */
+  s21_view_t a, b, at, bt;
+  ck_assert_int_eq(s21_view_block(&A, 10, 5, 70, 60, &a), S21_OK);
+  ck_assert_int_eq(s21_view_block(&B, 3, 20, 65, 70, &b), S21_OK);
+  ck_assert_int_eq(s21_view_transpose(&a, &at), S21_OK);
+  ck_assert_int_eq(s21_view_transpose(&b, &bt), S21_OK);
+
+  matrix_t at_copy, bt_copy, expected, result;
+  ck_assert_int_eq(s21_view_copy(&at, &at_copy), S21_OK);
+  ck_assert_int_eq(s21_view_copy(&bt, &bt_copy), S21_OK);
+  ck_assert_int_eq(s21_mult_matrix(&at_copy, &bt_copy, &expected), S21_OK);
+  ck_assert_int_eq(s21_view_mult_matrix(&at, &bt, &result), S21_OK);
+  for (int i = 0; i < expected.rows; ++i)
+    for (int j = 0; j < expected.columns; ++j)
+      ck_assert_double_eq_tol(result.matrix[i][j], expected.matrix[i][j],
+                              1e-12);
+
+  _free_matrix(&result);
+  _free_matrix(&expected);
+  _free_matrix(&bt_copy);
+  _free_matrix(&at_copy);
+  _free_matrix(&B);
+  _free_matrix(&A);
+}
+END_TEST
+
+Suite *s21_view_suite(void) {
+  Suite *s = suite_create("view");
+  TCase *tc = tcase_create("core");
+
+  tcase_add_test(tc, test_view_invalid);
+  tcase_add_test(tc, test_view_block_and_strided);
+  tcase_add_test(tc, test_view_minor_determinant);
+  tcase_add_test(tc, test_view_transpose_and_eq);
+  tcase_add_test(tc, test_view_mult_matrix);
+
+  tcase_add_test(tc, test_view_mult_transposed);
+  suite_add_tcase(s, tc);
+  return s;
+}